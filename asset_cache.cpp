@@ -0,0 +1,64 @@
+#include "asset_cache.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr const char *kImmutableCacheControl = "public, max-age=31536000, immutable";
+constexpr const char *kRevalidateCacheControl = "no-cache";
+
+bool isListBlank(char c) {
+  return c == ' ' || c == '\t';
+}
+
+// Comparaison faible (RFC 9110, If-None-Match) : le préfixe W/ est ignoré.
+bool etagListContains(const char *list, const char *etag) {
+  const size_t etagLength = strlen(etag);
+  const char *cursor = list;
+  while (*cursor != '\0') {
+    while (isListBlank(*cursor) || *cursor == ',') {
+      ++cursor;
+    }
+    const char *end = cursor;
+    while (*end != '\0' && *end != ',') {
+      ++end;
+    }
+    const char *last = end;
+    while (last > cursor && isListBlank(last[-1])) {
+      --last;
+    }
+
+    const char *candidate = cursor;
+    if (last - candidate > 2 && candidate[0] == 'W' && candidate[1] == '/') {
+      candidate += 2;
+    }
+    const size_t length = static_cast<size_t>(last - candidate);
+    if ((length == 1 && *candidate == '*') || (length == etagLength && memcmp(candidate, etag, length) == 0)) {
+      return true;
+    }
+    cursor = end;
+  }
+  return false;
+}
+
+}  // namespace
+
+bool parseAssetManifestLine(const String &line, CompressedAsset &asset) {
+  const int first = line.indexOf('\t');
+  const int second = first < 0 ? -1 : line.indexOf('\t', first + 1);
+  const int third = second < 0 ? -1 : line.indexOf('\t', second + 1);
+  if (third < 0) {
+    return false;
+  }
+  asset.path = line.substring(0, first);
+  asset.etag = "\"" + line.substring(first + 1, second) + "\"";
+  asset.immutable = line.substring(second + 1, third) == "1";
+  asset.contentType = line.substring(third + 1);
+  asset.contentType.trim();
+  return asset.path.startsWith("/");
+}
+
+AssetCacheDecision decideAssetCache(const char *ifNoneMatch, const char *etag, bool immutable) {
+  return AssetCacheDecision{ifNoneMatch != nullptr && etagListContains(ifNoneMatch, etag),
+                            immutable ? kImmutableCacheControl : kRevalidateCacheControl};
+}
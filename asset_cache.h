@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Ressource compressée décrite par une ligne de assets.manifest (tools/build_assets.py) : le
+// fichier n'existe qu'en variante .gz.
+struct CompressedAsset {
+  String path;
+  String etag;  // Entre guillemets, prêt pour l'en-tête ETag.
+  String contentType;
+  bool immutable = false;
+};
+
+// Ligne "chemin<TAB>empreinte<TAB>immuable(0/1)<TAB>type MIME" ; false si elle est mal formée.
+bool parseAssetManifestLine(const String &line, CompressedAsset &asset);
+
+// Les fichiers à empreinte changent de nom à chaque modification : ils sont immuables. Les pages
+// gardent leur URL et sont revalidées à chaque chargement (304 tant que l'ETag correspond).
+struct AssetCacheDecision {
+  bool notModified;          // Répondre 304 sans corps.
+  const char *cacheControl;  // Valeur de l'en-tête Cache-Control.
+};
+
+// `ifNoneMatch` : valeur de l'en-tête If-None-Match (nullptr s'il est absent), liste d'ETags
+// séparés par des virgules, éventuellement faibles (W/), ou "*". `etag` est entre guillemets.
+AssetCacheDecision decideAssetCache(const char *ifNoneMatch, const char *etag, bool immutable);
@@ -0,0 +1,124 @@
+#include "binary_protocol.h"
+
+#include <string.h>
+
+namespace {
+
+size_t writeHeader(uint8_t *out, size_t capacity, BinaryOpcode opcode, uint8_t cue, uint8_t flags) {
+  if (out == nullptr || capacity < BINARY_HEADER_SIZE) {
+    return 0;
+  }
+  out[0] = static_cast<uint8_t>(opcode);
+  out[1] = cue;
+  out[2] = flags;
+  return BINARY_HEADER_SIZE;
+}
+
+void writeU32(uint8_t *out, uint32_t value) {
+  for (size_t i = 0; i < 4; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+size_t writeText(uint8_t *out, size_t capacity, const char *text, size_t textLength) {
+  const size_t length = textLength > 0xFF ? 0xFF : textLength;
+  if (out == nullptr || capacity < length + 1) {
+    return 0;
+  }
+  out[0] = static_cast<uint8_t>(length);
+  if (length > 0) {
+    memcpy(out + 1, text, length);
+  }
+  return length + 1;
+}
+
+}  // namespace
+
+bool decodeBinaryCommand(const uint8_t *data, size_t length, BinaryCommand &command) {
+  if (data == nullptr || length < BINARY_HEADER_SIZE) {
+    return false;
+  }
+
+  command.opcode = static_cast<BinaryOpcode>(data[0]);
+  command.cue = data[1];
+  command.flags = data[2];
+  command.text = nullptr;
+  command.textLength = 0;
+
+  switch (command.opcode) {
+    case BinaryOpcode::Trigger:
+    case BinaryOpcode::SetText:
+      break;
+    case BinaryOpcode::Ping:
+      return length == BINARY_HEADER_SIZE;
+    default:
+      return false;
+  }
+
+  if (!command.hasText()) {
+    return length == BINARY_HEADER_SIZE;
+  }
+
+  if (length < BINARY_HEADER_SIZE + 1) {
+    return false;
+  }
+  const uint8_t textLength = data[BINARY_HEADER_SIZE];
+  if (length != BINARY_HEADER_SIZE + 1 + static_cast<size_t>(textLength)) {
+    return false;
+  }
+
+  command.text = reinterpret_cast<const char *>(data + BINARY_HEADER_SIZE + 1);
+  command.textLength = textLength;
+  return true;
+}
+
+size_t writeBinaryCueState(uint8_t *out, size_t capacity, uint8_t cue, uint8_t flags, const char *text,
+                           size_t textLength) {
+  if (capacity < binaryCueStateSize(textLength)) {
+    return 0;
+  }
+  const size_t header = writeHeader(out, capacity, BinaryOpcode::CueState, cue, flags);
+  return header + writeText(out + header, capacity - header, text, textLength);
+}
+
+size_t writeBinarySnapshotHeader(uint8_t *out, size_t capacity, BinaryOpcode opcode, uint8_t cueCount,
+                                 uint32_t sequence, uint32_t epoch) {
+  if (capacity < BINARY_SNAPSHOT_HEADER_SIZE) {
+    return 0;
+  }
+  writeHeader(out, capacity, opcode, cueCount, 0);
+  writeU32(out + BINARY_HEADER_SIZE, sequence);
+  writeU32(out + BINARY_HEADER_SIZE + 4, epoch);
+  return BINARY_SNAPSHOT_HEADER_SIZE;
+}
+
+size_t writeBinaryBatchHeader(uint8_t *out, size_t capacity, uint8_t cueCount, uint32_t sequence) {
+  if (capacity < BINARY_BATCH_HEADER_SIZE) {
+    return 0;
+  }
+  writeHeader(out, capacity, BinaryOpcode::Batch, cueCount, 0);
+  writeU32(out + BINARY_HEADER_SIZE, sequence);
+  return BINARY_BATCH_HEADER_SIZE;
+}
+
+size_t writeBinarySnapshotEntry(uint8_t *out, size_t capacity, uint8_t cue, uint8_t flags, const char *text,
+                                size_t textLength) {
+  if (out == nullptr || capacity < 2) {
+    return 0;
+  }
+  const size_t written = writeText(out + 2, capacity - 2, text, textLength);
+  if (written == 0) {
+    return 0;
+  }
+  out[0] = cue;
+  out[1] = flags;
+  return written + 2;
+}
+
+size_t writeBinaryPong(uint8_t *out, size_t capacity) {
+  return writeHeader(out, capacity, BinaryOpcode::Pong, 0, 0);
+}
+
+size_t writeBinaryError(uint8_t *out, size_t capacity, BinaryErrorCode code) {
+  return writeHeader(out, capacity, BinaryOpcode::Error, 0, static_cast<uint8_t>(code));
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Protocole WebSocket binaire compact (optionnel, négocié via /ws?proto=bin).
+// -----------------------------------------------------------------------------
+// Trame : [opcode:u8][cue:u8][flags:u8] puis, selon l'opcode, [longueur:u8][texte UTF-8].
+// Les champs multi-octets éventuels sont codés en little-endian.
+
+enum class BinaryOpcode : uint8_t {
+  Trigger = 0x01,   // client -> serveur : déclenche un cue (texte optionnel).
+  SetText = 0x02,   // client -> serveur : modifie le texte d'un cue.
+  Ping = 0x03,      // client -> serveur.
+  Pong = 0x04,      // serveur -> client.
+  CueState = 0x10,  // serveur -> client : état d'un cue (texte toujours présent).
+  Snapshot = 0x11,  // serveur -> client : [0x11][nombre][0][séquence:u32][époque:u32]
+                    //                    puis nombre × [cue][flags][longueur][texte].
+  Batch = 0x12,     // serveur -> client : [0x12][nombre][0][séquence:u32] puis entrées comme Snapshot.
+  Delta = 0x13,     // serveur -> client : en-tête comme Snapshot, seuls les cues modifiés depuis ?since.
+  Error = 0x7F,     // serveur -> client : [0x7F][0][code].
+};
+
+// Drapeaux des commandes client.
+constexpr uint8_t BINARY_FLAG_PERSIST = 0x01;
+constexpr uint8_t BINARY_FLAG_HAS_TEXT = 0x02;
+
+// Drapeaux des états diffusés par le serveur.
+constexpr uint8_t BINARY_FLAG_ACTIVE = 0x01;
+constexpr uint8_t BINARY_FLAG_DISPLAY_READY = 0x02;
+
+enum class BinaryErrorCode : uint8_t {
+  InvalidFrame = 0x01,
+  InvalidCue = 0x02,
+};
+
+constexpr size_t BINARY_HEADER_SIZE = 3;
+constexpr size_t BINARY_BATCH_HEADER_SIZE = BINARY_HEADER_SIZE + 4;
+constexpr size_t BINARY_SNAPSHOT_HEADER_SIZE = BINARY_HEADER_SIZE + 8;
+
+// Commande décodée : `text` pointe directement dans la trame reçue (aucune copie).
+struct BinaryCommand {
+  BinaryOpcode opcode = BinaryOpcode::Ping;
+  uint8_t cue = 0;
+  uint8_t flags = 0;
+  const char *text = nullptr;
+  uint8_t textLength = 0;
+
+  bool hasText() const { return (flags & BINARY_FLAG_HAS_TEXT) != 0; }
+  bool persist() const { return (flags & BINARY_FLAG_PERSIST) != 0; }
+};
+
+// Décode une trame client en temps constant. Retourne false si la trame est mal formée.
+bool decodeBinaryCommand(const uint8_t *data, size_t length, BinaryCommand &command);
+
+// Taille d'une trame CueState portant `textLength` octets de texte.
+constexpr size_t binaryCueStateSize(size_t textLength) {
+  return BINARY_HEADER_SIZE + 1 + (textLength > 0xFF ? 0xFF : textLength);
+}
+
+// Taille d'une entrée [cue][flags][longueur][texte] de Snapshot / Batch.
+constexpr size_t binarySnapshotEntrySize(size_t textLength) {
+  return 3 + (textLength > 0xFF ? 0xFF : textLength);
+}
+
+// Les fonctions d'écriture retournent le nombre d'octets écrits, ou 0 si `capacity` est insuffisante.
+size_t writeBinaryCueState(uint8_t *out, size_t capacity, uint8_t cue, uint8_t flags, const char *text,
+                           size_t textLength);
+// `opcode` vaut Snapshot ou Delta.
+size_t writeBinarySnapshotHeader(uint8_t *out, size_t capacity, BinaryOpcode opcode, uint8_t cueCount,
+                                 uint32_t sequence, uint32_t epoch);
+size_t writeBinaryBatchHeader(uint8_t *out, size_t capacity, uint8_t cueCount, uint32_t sequence);
+size_t writeBinarySnapshotEntry(uint8_t *out, size_t capacity, uint8_t cue, uint8_t flags, const char *text,
+                                size_t textLength);
+size_t writeBinaryPong(uint8_t *out, size_t capacity);
+size_t writeBinaryError(uint8_t *out, size_t capacity, BinaryErrorCode code);
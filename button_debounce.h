@@ -0,0 +1,131 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "spsc_ring.h"
+
+// Front capturé dans l'ISR : niveau lu juste après le changement et instant précis.
+struct ButtonEdge {
+  uint8_t index;
+  uint8_t level;
+  uint32_t timestampUs;
+};
+
+// Anti-rebond d'un bouton, sans horloge ni accès matériel : l'appelant fournit les fronts et
+// l'instant courant. Un niveau est validé après `debounceUs` sans nouveau front ; l'appui est
+// daté du premier front de la rafale.
+class ButtonDebouncer {
+ public:
+  void configure(int level) {
+    configured_ = true;
+    settling = false;
+    reading_ = level;
+    stable = level;
+  }
+
+  bool configured() const { return configured_; }
+  int reading() const { return reading_; }
+
+  void recordEdge(int level, uint32_t timestampUs) {
+    if (!settling) {
+      firstEdgeUs = timestampUs;
+    }
+    settling = true;
+    reading_ = level;
+    lastEdgeUs = timestampUs;
+  }
+
+  // Valide le niveau courant s'il est resté stable `debounceUs` à l'instant `nowUs`. Renvoie true
+  // pour un appui (passage à `activeLevel`), daté dans `pressedAtUs`.
+  bool settle(uint32_t nowUs, uint32_t debounceUs, int activeLevel, uint32_t &pressedAtUs) {
+    // Différence signée : un front horodaté après `nowUs` (ISR concurrente) compte comme récent.
+    if (!settling || static_cast<int32_t>(nowUs - lastEdgeUs) < static_cast<int32_t>(debounceUs)) {
+      return false;
+    }
+
+    settling = false;
+    if (reading_ == stable) {
+      return false;
+    }
+
+    stable = reading_;
+    if (stable != activeLevel) {
+      return false;
+    }
+    pressedAtUs = firstEdgeUs;
+    return true;
+  }
+
+ private:
+  bool configured_ = false;
+  bool settling = false;     // Un front a été reçu, on attend `debounceUs` de stabilité.
+  int reading_ = 0;          // Dernier niveau observé.
+  int stable = 0;            // Niveau validé par l'anti-rebond.
+  uint32_t firstEdgeUs = 0;  // Début de la rafale de rebonds en cours.
+  uint32_t lastEdgeUs = 0;
+};
+
+// Boutons alimentés par une file de fronts (ISR -> loop()). Si la file déborde, les fronts
+// perdus sont remplacés par une lecture des niveaux au traitement suivant.
+template <size_t Count, size_t QueueSize>
+class DebouncedButtons {
+ public:
+  DebouncedButtons(uint32_t debounceUs, int activeLevel) : debounceUs(debounceUs), activeLevel(activeLevel) {}
+
+  void configure(size_t index, int level) { buttons[index].configure(level); }
+
+  // Appelable depuis une ISR.
+  void pushEdge(const ButtonEdge &edge) {
+    if (!edges.push(edge)) {
+      overflowed.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  // `readLevel(index)` lit le niveau d'un bouton ; `onPress(index, pressedAtUs)` reçoit les
+  // appuis validés. `pollLevels` force la lecture (pas d'interruptions).
+  template <typename ReadLevel, typename OnPress>
+  void process(uint32_t nowUs, bool pollLevels, ReadLevel &&readLevel, OnPress &&onPress) {
+    uint32_t pressedAtUs = 0;
+    ButtonEdge edge;
+    while (edges.pop(edge)) {
+      if (edge.index >= Count || !buttons[edge.index].configured()) {
+        continue;
+      }
+      // Les fronts sont rejoués dans l'ordre avec leur propre horodatage : un appui survenu
+      // pendant une boucle lente est daté et validé comme s'il avait été traité immédiatement.
+      ButtonDebouncer &button = buttons[edge.index];
+      if (button.settle(edge.timestampUs, debounceUs, activeLevel, pressedAtUs)) {
+        onPress(static_cast<size_t>(edge.index), pressedAtUs);
+      }
+      button.recordEdge(edge.level, edge.timestampUs);
+    }
+
+    if (overflowed.exchange(false, std::memory_order_relaxed) || pollLevels) {
+      for (size_t i = 0; i < Count; ++i) {
+        if (!buttons[i].configured()) {
+          continue;
+        }
+        const int level = readLevel(i);
+        if (level != buttons[i].reading()) {
+          buttons[i].recordEdge(level, nowUs);
+        }
+      }
+    }
+
+    for (size_t i = 0; i < Count; ++i) {
+      if (buttons[i].configured() && buttons[i].settle(nowUs, debounceUs, activeLevel, pressedAtUs)) {
+        onPress(i, pressedAtUs);
+      }
+    }
+  }
+
+ private:
+  const uint32_t debounceUs;
+  const int activeLevel;
+  ButtonDebouncer buttons[Count];
+  SpscRing<ButtonEdge, QueueSize> edges;
+  std::atomic<bool> overflowed{false};
+};
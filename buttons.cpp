@@ -0,0 +1,49 @@
+#include "buttons.h"
+
+#include "button_debounce.h"
+#include "config.h"
+
+namespace {
+
+constexpr uint32_t kDebounceUs = BUTTON_DEBOUNCE_MS * 1000UL;
+
+DebouncedButtons<CUE_COUNT, BUTTON_EDGE_QUEUE_SIZE> buttons(kDebounceUs, BUTTON_ACTIVE_STATE);
+bool interruptsAttached = false;
+
+void IRAM_ATTR onButtonEdge(void *arg) {
+  const size_t index = reinterpret_cast<size_t>(arg);
+  buttons.pushEdge({static_cast<uint8_t>(index), static_cast<uint8_t>(digitalRead(cueButtons[index])),
+                    static_cast<uint32_t>(micros())});
+}
+
+}  // namespace
+
+void initButtons() {
+  interruptsAttached = true;
+
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (cueButtons[i] < 0) {
+      continue;
+    }
+
+    pinMode(cueButtons[i], BUTTON_USE_PULLUP ? INPUT_PULLUP : INPUT);
+    buttons.configure(i, digitalRead(cueButtons[i]));
+
+#if defined(ESP_PLATFORM)
+    attachInterruptArg(digitalPinToInterrupt(cueButtons[i]), onButtonEdge, reinterpret_cast<void *>(i), CHANGE);
+#else
+    interruptsAttached = false;
+#endif
+  }
+}
+
+void processButtons(ButtonPressHandler onPress) {
+  // Sans interruptions, les fronts sont synthétisés par lecture des niveaux.
+  buttons.process(
+      micros(), !interruptsAttached, [](size_t index) { return digitalRead(cueButtons[index]); },
+      [onPress](size_t index, uint32_t pressedAtUs) {
+        if (onPress != nullptr) {
+          onPress(index, pressedAtUs);
+        }
+      });
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Appui validé par l'anti-rebond ; `pressedAtUs` est l'horodatage micros() du front initial.
+using ButtonPressHandler = void (*)(size_t index, uint32_t pressedAtUs);
+
+void initButtons();
+// Consomme les fronts capturés par interruption et applique l'anti-rebond.
+void processButtons(ButtonPressHandler onPress);
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Écart estimé entre l'horloge d'un contrôleur et l'horloge locale (cueClockUs()).
+struct ClockEstimate {
+  bool valid = false;
+  int64_t offsetUs = 0;        // Horloge distante - horloge locale.
+  uint32_t uncertaintyUs = 0;  // Demi aller-retour de l'échange retenu, majoré de la dérive depuis.
+};
+
+// Estimateur d'écart d'horloge à la manière de NTP. Chaque échange fournit l'émission de la sonde
+// (horloge locale), l'horodatage du contrôleur et la réception de sa réponse (horloge locale) ;
+// l'écart est mesuré au milieu de l'aller-retour. Parmi les Window derniers échanges, le filtre
+// retient celui dont l'incertitude est la plus faible : un aller-retour court est le moins
+// sensible à l'asymétrie du réseau, et l'incertitude d'un échange ancien croît avec la dérive
+// supposée des quartz. Aucune horloge : l'appelant fournit les instants, ce qui permet de piloter
+// l'estimateur avec une horloge simulée.
+template <size_t Window>
+class ClockOffsetEstimator {
+  static_assert(Window > 0, "Fenêtre vide");
+
+ public:
+  ClockOffsetEstimator(uint32_t maxRoundTripUs, uint32_t driftPpm)
+      : maxRoundTripUs(maxRoundTripUs), driftPpm(driftPpm) {}
+
+  // Retourne false si l'échange est rejeté (réponse antérieure à la sonde ou aller-retour trop long).
+  bool addSample(uint64_t sentAtUs, int64_t remoteUs, uint64_t receivedAtUs) {
+    if (receivedAtUs < sentAtUs || receivedAtUs - sentAtUs > maxRoundTripUs) {
+      return false;
+    }
+    Sample &sample = samples[head];
+    sample.roundTripUs = static_cast<uint32_t>(receivedAtUs - sentAtUs);
+    sample.measuredAtUs = sentAtUs + sample.roundTripUs / 2;
+    sample.offsetUs = remoteUs - static_cast<int64_t>(sample.measuredAtUs);
+    head = (head + 1) % Window;
+    if (count < Window) {
+      ++count;
+    }
+    return true;
+  }
+
+  ClockEstimate estimate(uint64_t nowUs) const {
+    ClockEstimate best;
+    uint64_t bestUncertainty = UINT64_MAX;
+    for (size_t i = 0; i < count; ++i) {
+      const Sample &sample = samples[i];
+      const uint64_t age = nowUs > sample.measuredAtUs ? nowUs - sample.measuredAtUs : 0;
+      const uint64_t uncertainty = sample.roundTripUs / 2 + age * driftPpm / 1000000ULL;
+      if (uncertainty < bestUncertainty) {
+        bestUncertainty = uncertainty;
+        best.valid = true;
+        best.offsetUs = sample.offsetUs;
+        best.uncertaintyUs = uncertainty > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(uncertainty);
+      }
+    }
+    return best;
+  }
+
+  size_t sampleCount() const { return count; }
+
+ private:
+  struct Sample {
+    int64_t offsetUs;
+    uint64_t measuredAtUs;
+    uint32_t roundTripUs;
+  };
+
+  Sample samples[Window] = {};
+  size_t head = 0;
+  size_t count = 0;
+  uint32_t maxRoundTripUs;
+  uint32_t driftPpm;
+};
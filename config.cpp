@@ -2,18 +2,77 @@
 
 const char API_AUTH_TOKEN[] = "stagecue-admin";
 const char DEVICE_NAME[] = "StageCue";
+const char NTP_SERVER[] = "pool.ntp.org";
 
+// Les entrées absentes (nullptr) prennent le texte "Cue N".
 const char *defaultCueTexts[CUE_COUNT] = {"Cue 1", "Cue 2", "Cue 3"};
 
-const uint8_t displayAddresses[CUE_COUNT] = {0x3C, 0x3D, 0x3E};
+const uint32_t cueActiveDurationsMs[CUE_COUNT] = {0, 0, 0};
+
+// Plusieurs appareils peuvent partager une position : un même datagramme les déclenche ensemble.
+const uint16_t multicastCuePositions[] = {1, 2, 3};
+
+// Un écran par canal d'un TCA9548A en 0x70. Sans multiplexeur, deux écrans au plus :
+// {DISPLAY_NO_MUX, 0, 0x3C}, {DISPLAY_NO_MUX, 0, 0x3D}.
+constexpr DisplayLocation displayLocations[] = {
+    {0x70, 0, 0x3C},
+    {0x70, 1, 0x3C},
+    {0x70, 2, 0x3C},
+};
+
+// Canaux 1 à 3 de l'univers DMX_UNIVERSE : déclenchement à mi-course.
+constexpr DmxCueMapping dmxCueMappings[] = {
+    {1, 128, DmxCueMode::Trigger},
+    {2, 128, DmxCueMode::Trigger},
+    {3, 128, DmxCueMode::Trigger},
+};
 
 // Broches par défaut pour un ESP32-C6 DevKitC : ajustez selon votre câblage.
-const int cueLEDs[CUE_COUNT] = {18, 19, 20};
-const int cueButtons[CUE_COUNT] = {1, 2, 3};
+// Une broche à -1 désactive la LED ou le bouton du cue correspondant.
+const int cueLEDs[] = {18, 19, 20};
+const int cueButtons[] = {1, 2, 3};
 
 static_assert(sizeof(cueLEDs) / sizeof(cueLEDs[0]) == CUE_COUNT,
               "cueLEDs doit contenir une entrée par cue");
 static_assert(sizeof(cueButtons) / sizeof(cueButtons[0]) == CUE_COUNT,
               "cueButtons doit contenir une entrée par cue");
-static_assert(sizeof(displayAddresses) / sizeof(displayAddresses[0]) == CUE_COUNT,
-              "displayAddresses doit contenir une entrée par cue");
+static_assert(sizeof(multicastCuePositions) / sizeof(multicastCuePositions[0]) == CUE_COUNT,
+              "multicastCuePositions doit contenir une entrée par cue");
+static_assert(sizeof(dmxCueMappings) / sizeof(dmxCueMappings[0]) == CUE_COUNT,
+              "dmxCueMappings doit contenir une entrée par cue");
+// Un seuil nul laisserait le canal au-dessus quel que soit le niveau (cue jamais relâché).
+constexpr bool dmxThresholdsValid() {
+  for (const DmxCueMapping &mapping : dmxCueMappings) {
+    if (mapping.channel != 0 && mapping.threshold == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(dmxThresholdsValid(), "Le seuil DMX d'un canal associé doit être supérieur à 0");
+static_assert(sizeof(displayLocations) / sizeof(displayLocations[0]) == CUE_COUNT,
+              "displayLocations doit contenir une entrée par cue");
+// Un SSD1306 ne répond qu'en 0x3C ou 0x3D ; un TCA9548A occupe 0x70-0x77 et offre huit canaux.
+// Deux écrans au même emplacement (bus direct ou même canal) se répondraient ensemble.
+constexpr bool displayLocationsValid() {
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    const DisplayLocation &location = displayLocations[i];
+    if (location.address != 0x3C && location.address != 0x3D) {
+      return false;
+    }
+    if (location.muxAddress != DISPLAY_NO_MUX &&
+        (location.muxAddress < 0x70 || location.muxAddress > 0x77 || location.muxChannel > 7)) {
+      return false;
+    }
+    for (size_t j = 0; j < i; ++j) {
+      const DisplayLocation &other = displayLocations[j];
+      if (other.address == location.address && other.muxAddress == location.muxAddress &&
+          (location.muxAddress == DISPLAY_NO_MUX || other.muxChannel == location.muxChannel)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+static_assert(displayLocationsValid(), "displayLocations : adresse SSD1306 (0x3C/0x3D), multiplexeur ou canal invalide, "
+                                       "ou deux écrans au même emplacement");
@@ -17,6 +17,12 @@
 constexpr uint32_t WIFI_CONNECT_TIMEOUT_MS = 15000;
 // Nombre maximal de tentatives complètes avant de basculer en mode portail.
 constexpr uint8_t WIFI_MAX_RETRIES = 3;
+// Délai accordé à la reconnexion directe sur le point d'accès et le canal mémorisés.
+constexpr uint32_t WIFI_FAST_CONNECT_TIMEOUT_MS = 4000;
+// Pause entre deux tentatives de connexion.
+constexpr uint32_t WIFI_RETRY_DELAY_MS = 250;
+// Durée pendant laquelle /scan renvoie le dernier balayage sans en relancer un.
+constexpr uint32_t WIFI_SCAN_CACHE_TTL_MS = 30000;
 // Désactive l'économie d'énergie Wi-Fi pour une latence minimale.
 constexpr bool WIFI_DISABLE_SLEEP = true;
 
@@ -25,11 +31,18 @@ constexpr bool WIFI_DISABLE_SLEEP = true;
 // -----------------------------------------------------------------------------
 extern const char API_AUTH_TOKEN[];  // Jeton partagé entre le firmware et le front-end.
 extern const char DEVICE_NAME[];     // Nom réseau annoncé par l'appareil.
+extern const char NTP_SERVER[];      // Heure murale utilisée pour dater les bundles OSC.
 
 // -----------------------------------------------------------------------------
 // Gestion matérielle – compatible ESP32-C6
 // -----------------------------------------------------------------------------
-constexpr size_t CUE_COUNT = 3;
+// Nombre de positions de cue (1 à 64) : écrans, LEDs, boutons et documents JSON en dépendent.
+// STAGECUE_CUE_COUNT permet de le fixer à la compilation (tests hôte à 64 cues).
+#ifndef STAGECUE_CUE_COUNT
+#define STAGECUE_CUE_COUNT 3
+#endif
+constexpr size_t CUE_COUNT = STAGECUE_CUE_COUNT;
+static_assert(CUE_COUNT > 0 && CUE_COUNT <= 64, "CUE_COUNT doit être compris entre 1 et 64");
 
 // Bus I2C utilisé pour les écrans OLED (brochage par défaut du DevKit ESP32-C6).
 constexpr int I2C_SDA_PIN = 23;
@@ -38,7 +51,39 @@ constexpr int I2C_SCL_PIN = 22;
 constexpr uint8_t SCREEN_WIDTH = 128;
 constexpr uint8_t SCREEN_HEIGHT = 64;
 
-extern const uint8_t displayAddresses[CUE_COUNT];
+// Emplacement d'un écran : directement sur le bus (muxAddress = DISPLAY_NO_MUX) ou derrière
+// un multiplexeur I2C type TCA9548A (adresses 0x70-0x77, canaux 0-7). Un SSD1306 n'offrant
+// que deux adresses (0x3C/0x3D), au-delà de deux écrans ils sont répartis par canal (config.cpp
+// vérifie adresses, canaux et doublons).
+constexpr uint8_t DISPLAY_NO_MUX = 0;
+
+// Les tables matérielles par cue sont déclarées sans taille : config.cpp vérifie qu'elles
+// comptent exactement CUE_COUNT entrées (une déclaration [CUE_COUNT] compléterait en silence
+// une table trop courte par des zéros).
+
+struct DisplayLocation {
+  uint8_t muxAddress;
+  uint8_t muxChannel;
+  uint8_t address;
+};
+
+extern const DisplayLocation displayLocations[];
+
+// Canal DMX associé à un cue : Trigger déclenche le cue quand le niveau franchit le seuil en
+// montant ; Hold le maintient actif tant que le niveau reste au-dessus (canal 0 = aucun).
+enum class DmxCueMode : uint8_t { Trigger, Hold };
+
+struct DmxCueMapping {
+  uint16_t channel;  // 1..512.
+  uint8_t threshold;  // 1..255.
+  DmxCueMode mode;
+};
+
+extern const DmxCueMapping dmxCueMappings[];
+
+// Tâche FreeRTOS dédiée au rendu des écrans (hors de la tâche AsyncTCP).
+constexpr uint32_t DISPLAY_TASK_STACK_SIZE = 4096;
+constexpr uint8_t DISPLAY_TASK_PRIORITY = 1;
 
 // -----------------------------------------------------------------------------
 // Gestion des cues
@@ -47,6 +92,8 @@ extern const char *defaultCueTexts[CUE_COUNT];
 
 // Durée pendant laquelle la LED d'un cue reste allumée (ms).
 constexpr uint32_t CUE_ACTIVE_DURATION_MS = 5000;
+// Durée propre à chaque cue (0 = CUE_ACTIVE_DURATION_MS).
+extern const uint32_t cueActiveDurationsMs[CUE_COUNT];
 // Taille maximale des textes affichés (caractères Unicode).
 constexpr size_t MAX_CUE_TEXT_LENGTH = 64;
 // Anti-rebond matériel des boutons (ms).
@@ -55,13 +102,79 @@ constexpr uint32_t BUTTON_DEBOUNCE_MS = 40;
 constexpr uint8_t BUTTON_ACTIVE_STATE = LOW;
 // Active la résistance de pull-up interne lorsque c'est possible.
 constexpr bool BUTTON_USE_PULLUP = true;
+// Capacité de la file des fronts capturés par interruption (puissance de deux).
+constexpr size_t BUTTON_EDGE_QUEUE_SIZE = 64;
 
+// Écriture différée des textes en NVS : délai de stabilité après la dernière modification,
+// puis délai maximal pendant une saisie continue.
+constexpr uint32_t CUE_PERSIST_DEBOUNCE_MS = 2000;
+constexpr uint32_t CUE_PERSIST_MAX_DELAY_MS = 10000;
+// Fenêtre de regroupement des changements d'état en une trame "batch" (0 = une par loop()).
+constexpr uint32_t CUE_BATCH_WINDOW_MS = 0;
+// Lot de commandes (/api/cues/batch et message WebSocket "batch") : opérations et corps HTTP maximaux.
+constexpr size_t CUE_BATCH_MAX_OPERATIONS = 32;
+constexpr size_t CUE_BATCH_MAX_BODY_SIZE = 4096;
+// Synchronisation d'horloge avec les contrôleurs (WebSocket clockSync / clockEcho) : échanges
+// conservés par client, aller-retour maximal accepté et dérive supposée des quartz (ppm).
+constexpr size_t CLOCK_SYNC_WINDOW = 8;
+constexpr uint32_t CLOCK_SYNC_MAX_ROUND_TRIP_US = 200000;
+constexpr uint32_t CLOCK_SYNC_DRIFT_PPM = 50;
+// Avance maximale d'un déclenchement programmé (triggerAt), pour écarter les erreurs d'unité.
+constexpr uint32_t TRIGGER_AT_MAX_LEAD_MS = 600000;
+// Déclenchement multicast UDP (multicast_protocol.h) : adresse et port d'écoute, groupe de
+// l'appareil et nombre d'émetteurs dont la séquence est suivie. Le protocole n'est pas
+// authentifié : à réserver au réseau de la régie.
+constexpr bool MULTICAST_TRIGGERS_ENABLED = true;
+constexpr uint8_t MULTICAST_ADDRESS[4] = {239, 255, 42, 42};
+constexpr uint16_t MULTICAST_PORT = 4210;
+constexpr uint16_t MULTICAST_GROUP_ID = 1;
+constexpr size_t MULTICAST_MAX_SENDERS = 8;
+// Position de scène de chaque cue local dans les datagrammes multicast (0 = non adressable).
+extern const uint16_t multicastCuePositions[];
+// Serveur OSC (osc_protocol.h) : /stagecue/cue/{n}/go et /stagecue/cue/{n}/text, n à partir de 1.
+// Non authentifié, comme le multicast : à réserver au réseau de la régie.
+constexpr bool OSC_SERVER_ENABLED = true;
+constexpr uint16_t OSC_PORT = 8000;
+// Entrée DMX sur IP (dmx_protocol.h) : protocole et univers écoutés (sACN 1..63999, Art-Net :
+// Port-Address 15 bits), hystérésis des seuils et durée maximale d'un cue maintenu par un canal.
+enum class DmxInputProtocol : uint8_t { Disabled, Sacn, ArtNet };
+constexpr DmxInputProtocol DMX_INPUT_PROTOCOL = DmxInputProtocol::Sacn;
+constexpr uint16_t DMX_UNIVERSE = 1;
+constexpr uint8_t DMX_THRESHOLD_HYSTERESIS = 8;
+constexpr uint32_t DMX_HOLD_MAX_DURATION_MS = 3600000;
+// Nombre d'émetteurs suivis pour l'arbitrage de priorité et le contrôle de séquence.
+constexpr size_t DMX_MAX_SOURCES = 4;
+// Listes de cues (cue_list.h) : pas et octets de textes d'une liste compilée, corps HTTP maximal
+// du téléversement et pas exécutés au plus par passage dans loop() (le reste suit au passage suivant).
+constexpr size_t CUE_LIST_MAX_STEPS = 128;
+constexpr size_t CUE_LIST_TEXT_POOL_SIZE = 4096;
+constexpr size_t CUE_LIST_MAX_BODY_SIZE = 16384;
+constexpr size_t CUE_LIST_STEPS_PER_SERVICE = 8;
+// Délai avant une nouvelle tentative d'ouverture d'un port UDP (multicast, OSC) après un échec.
+constexpr uint32_t UDP_LISTEN_RETRY_INTERVAL_MS = 5000;
+// Taille au-delà de laquelle les documents JSON sont alloués sur le tas plutôt que sur la pile.
+constexpr size_t JSON_STACK_CAPACITY_LIMIT = 1024;
+// Nombre de changements conservés pour la resynchronisation différentielle (?since=<version>).
+constexpr size_t CUE_JOURNAL_CAPACITY = 64;
+// Nombre maximal de clients WebSocket simultanés suivis par le serveur.
+constexpr size_t WS_MAX_CLIENTS = 16;
+// Contre-pression par client WebSocket (messages et octets diffusés encore en file). Au-delà du
+// seuil souple, les trames d'état ne sont plus empilées : un seul delta les remplace dès que la
+// file redescend. Au-delà du seuil dur, les autres diffusions sont écartées, et un client qui y
+// reste WS_CLIENT_STALL_TIMEOUT_MS est déconnecté (il se resynchronise en se reconnectant avec
+// ?since=). Le seuil dur reste sous WS_MAX_QUEUED_MESSAGES de la bibliothèque (32 par défaut).
+constexpr size_t WS_CLIENT_SOFT_QUEUE_DEPTH = 4;
+constexpr size_t WS_CLIENT_SOFT_QUEUE_BYTES = 4096;
+constexpr size_t WS_CLIENT_HARD_QUEUE_DEPTH = 16;
+constexpr size_t WS_CLIENT_HARD_QUEUE_BYTES = 16384;
+constexpr uint32_t WS_CLIENT_STALL_TIMEOUT_MS = 5000;
+static_assert(WS_CLIENT_SOFT_QUEUE_DEPTH < WS_CLIENT_HARD_QUEUE_DEPTH, "Seuil souple sous le seuil dur");
 // Intervalle minimal entre deux opérations de nettoyage des clients WebSocket.
 constexpr uint32_t WS_CLIENT_CLEANUP_INTERVAL_MS = 10000;
 
 // -----------------------------------------------------------------------------
 // Brochages matériels (adapter si nécessaire)
 // -----------------------------------------------------------------------------
-extern const int cueLEDs[CUE_COUNT];
-extern const int cueButtons[CUE_COUNT];
+extern const int cueLEDs[];
+extern const int cueButtons[];
 
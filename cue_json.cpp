@@ -0,0 +1,20 @@
+#include "cue_json.h"
+
+void fillCueEntry(JsonObject entry, const CueJsonState &state) {
+  entry["index"] = static_cast<uint8_t>(state.index);
+  entry["active"] = state.active;
+  // char * : dupliqué dans le document (un const char * n'y serait que référencé).
+  entry["text"] = const_cast<char *>(state.text.text);
+  entry["displayReady"] = state.displayReady;
+}
+
+String buildCueJson(const char *type, const CueJsonState &state) {
+  CueJsonDocument doc;
+  JsonObject root = doc.to<JsonObject>();
+  root["type"] = type;
+  fillCueEntry(root, state);
+
+  String payload;
+  serializeJson(doc, payload);
+  return payload;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include <type_traits>
+
+#include "config.h"
+#include "cue_store.h"
+
+// Capacités des documents JSON d'état des cues, calculées à la compilation à partir de CUE_COUNT.
+// Au-delà de JSON_STACK_CAPACITY_LIMIT, le document est alloué sur le tas (une seule fois, à la
+// bonne taille) pour préserver la pile de la tâche AsyncTCP.
+template <size_t Capacity>
+class HeapJsonDocument : public DynamicJsonDocument {
+ public:
+  HeapJsonDocument() : DynamicJsonDocument(Capacity) {}
+};
+
+template <size_t Capacity>
+using SizedJsonDocument = typename std::conditional<(Capacity <= JSON_STACK_CAPACITY_LIMIT),
+                                                    StaticJsonDocument<Capacity>, HeapJsonDocument<Capacity>>::type;
+
+// Les textes sont copiés dans le document (lus sous le verrou du magasin, puis dupliqués par
+// ArduinoJson) : un texte modifié par une autre tâche pendant la sérialisation reste intact.
+constexpr size_t CUE_TEXT_JSON_SIZE = JSON_STRING_SIZE(MAX_CUE_TEXT_LENGTH);
+// Un cue : type, index, actif, écran prêt, texte.
+constexpr size_t CUE_JSON_CAPACITY = JSON_OBJECT_SIZE(5) + CUE_TEXT_JSON_SIZE;
+
+// Snapshot ou delta : enveloppe de 5 champs, puis un objet de 4 champs et son texte par cue.
+constexpr size_t cueListJsonCapacity(size_t cueCount) {
+  return JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(cueCount) + cueCount * (JSON_OBJECT_SIZE(4) + CUE_TEXT_JSON_SIZE);
+}
+
+using CueJsonDocument = SizedJsonDocument<CUE_JSON_CAPACITY>;
+using CueListJsonDocument = SizedJsonDocument<cueListJsonCapacity(CUE_COUNT)>;
+
+// État d'un cue à sérialiser, lu au préalable (texte copié sous le verrou du magasin).
+struct CueJsonState {
+  size_t index;
+  bool active;
+  bool displayReady;
+  const CueTextCopy &text;
+};
+
+void fillCueEntry(JsonObject entry, const CueJsonState &state);
+// Document d'un cue ({"type": type, ...}) sérialisé ; séparé de cues.cpp pour être mesuré sur
+// l'hôte (tests/bench_hot_paths.cpp).
+String buildCueJson(const char *type, const CueJsonState &state);
@@ -0,0 +1,335 @@
+#include "cue_list.h"
+
+#include <ESPAsyncWebServer.h>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "config.h"
+#include "cue_sequence.h"
+#include "cue_timers.h"
+#include "cues.h"
+#include "latency_metrics.h"
+#include "web_server.h"
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#endif
+
+extern AsyncWebSocket ws;
+
+namespace {
+
+// Liste compilée, immuable une fois publiée : textes rangés bout à bout (terminés par NUL),
+// dédoublonnés et désignés par leur indice dans textOffsets.
+struct CompiledCueList {
+  std::vector<CueStep> steps;
+  std::vector<uint16_t> textOffsets;
+  std::vector<char> textPool;
+};
+
+constexpr size_t kNoStep = SIZE_MAX;
+
+// Les commandes arrivent de la tâche AsyncTCP, les échéances sont traitées dans loop() : le
+// moteur et la liste publiée sont protégés par listLock, les pas sont exécutés hors du verrou.
+std::shared_ptr<const CompiledCueList> activeList;
+CueSequence sequence;
+uint32_t listRevision = 0;
+size_t lastExecutedStep = kNoStep;
+std::atomic<bool> progressChanged{false};
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE listLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockList() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&listLock);
+#endif
+}
+
+void unlockList() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&listLock);
+#endif
+}
+
+bool parseStepAction(const char *name, CueStepAction &action) {
+  if (strcmp(name, "fire") == 0) {
+    action = CueStepAction::Fire;
+  } else if (strcmp(name, "text") == 0) {
+    action = CueStepAction::Text;
+  } else if (strcmp(name, "release") == 0) {
+    action = CueStepAction::Release;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Retourne l'identifiant du texte, en réutilisant un texte identique déjà rangé.
+const char *internText(CompiledCueList &list, const char *text, uint16_t &textId) {
+  for (size_t i = 0; i < list.textOffsets.size(); ++i) {
+    if (strcmp(list.textPool.data() + list.textOffsets[i], text) == 0) {
+      textId = static_cast<uint16_t>(i);
+      return nullptr;
+    }
+  }
+  const size_t length = strlen(text);
+  if (list.textPool.size() + length + 1 > CUE_LIST_TEXT_POOL_SIZE) {
+    return "text_pool_full";
+  }
+  textId = static_cast<uint16_t>(list.textOffsets.size());
+  list.textOffsets.push_back(static_cast<uint16_t>(list.textPool.size()));
+  list.textPool.insert(list.textPool.end(), text, text + length + 1);
+  return nullptr;
+}
+
+const char *compileStep(JsonObjectConst entry, CompiledCueList &list, CueStep &step) {
+  CueStepAction action = CueStepAction::Fire;
+  if (!parseStepAction(entry["action"] | "fire", action)) {
+    return "invalid_action";
+  }
+  JsonVariantConst cue = entry["cue"];
+  if (!cue.is<int>() || cue.as<int>() < 0 || static_cast<size_t>(cue.as<int>()) >= CUE_COUNT) {
+    return "invalid_cue";
+  }
+  const uint32_t durationMs = entry["duration"] | 0U;
+  if (durationMs > 0x7FFFFFFFUL) {
+    return "invalid_duration";
+  }
+
+  step = CueStep{};
+  step.action = action;
+  step.target = static_cast<uint8_t>(cue.as<int>());
+  step.textId = CUE_STEP_NO_TEXT;
+  step.delayMs = entry["delay"] | 0U;
+  step.durationMs = durationMs;
+  step.autoFollow = (entry["follow"] | false) ? 1 : 0;
+
+  const char *text = entry["text"].as<const char *>();
+  if (action == CueStepAction::Text && text == nullptr) {
+    return "missing_text";
+  }
+  if (action != CueStepAction::Release && text != nullptr) {
+    return internText(list, text, step.textId);
+  }
+  return nullptr;
+}
+
+std::shared_ptr<const CompiledCueList> compileCueList(JsonArrayConst entries, const char *&error) {
+  std::shared_ptr<CompiledCueList> list(new (std::nothrow) CompiledCueList());
+  if (!list) {
+    error = "out_of_memory";
+    return nullptr;
+  }
+  list->steps.reserve(entries.size());
+  for (JsonObjectConst entry : entries) {
+    CueStep step;
+    error = compileStep(entry, *list, step);
+    if (error != nullptr) {
+      return nullptr;
+    }
+    list->steps.push_back(step);
+  }
+  list->steps.shrink_to_fit();
+  list->textPool.shrink_to_fit();
+  list->textOffsets.shrink_to_fit();
+  return list;
+}
+
+// Les pas échus au même passage sont appliqués en un lot (LEDs allumées au même instant, une
+// seule trame "batch") ; le lot est vidé avant une extinction ou un second pas sur le même cue
+// pour conserver l'ordre de la liste.
+struct StepBatch {
+  CueOperation operations[CUE_COUNT];
+  bool queued[CUE_COUNT] = {false};
+  size_t count = 0;
+
+  void flush() {
+    if (count == 0) {
+      return;
+    }
+    applyCueBatch(operations, count);
+    memset(queued, 0, sizeof(queued));
+    count = 0;
+  }
+
+  void add(const CompiledCueList &list, const CueStep &step, uint32_t receivedAtUs) {
+    const size_t index = step.target;
+    if (queued[index]) {
+      flush();
+    }
+    CueOperation &operation = operations[count++];
+    operation = CueOperation{index, nullptr, 0, false, step.action == CueStepAction::Fire, step.durationMs};
+    if (step.textId != CUE_STEP_NO_TEXT) {
+      operation.text = list.textPool.data() + list.textOffsets[step.textId];
+      operation.textLength = strlen(operation.text);
+    }
+    if (operation.trigger) {
+      beginTriggerTrace(index, TriggerSource::CueList, receivedAtUs);
+    }
+    queued[index] = true;
+  }
+};
+
+void executeSteps(const CompiledCueList &list, const DueCueStep *due, size_t count, uint64_t nowUs) {
+  const uint32_t nowTraceUs = latencyTimestampUs();
+  StepBatch batch;
+  for (size_t i = 0; i < count; ++i) {
+    const CueStep &step = due[i].step;
+    if (step.action == CueStepAction::Release) {
+      batch.flush();
+      releaseCue(step.target);
+      continue;
+    }
+    // La trace part de l'échéance prévue : le retard pris par loop() compte dans la latence.
+    const uint32_t lateUs = static_cast<uint32_t>(nowUs - due[i].dueUs);
+    batch.add(list, step, nowTraceUs - lateUs);
+  }
+  batch.flush();
+}
+
+// À appeler sous listLock.
+void fillStatus(JsonDocument &doc, uint64_t nowUs) {
+  doc["type"] = "cueList";
+  doc["revision"] = listRevision;
+  doc["count"] = sequence.size();
+  doc["playhead"] = sequence.playhead();
+  doc["running"] = sequence.running();
+  if (lastExecutedStep == kNoStep) {
+    doc["executed"] = -1;
+  } else {
+    doc["executed"] = lastExecutedStep;
+  }
+  if (sequence.running()) {
+    const uint64_t dueUs = sequence.nextDueUs();
+    doc["nextInMs"] = dueUs > nowUs ? static_cast<uint32_t>((dueUs - nowUs) / 1000ULL) : 0U;
+  }
+}
+
+using StatusJsonDocument = StaticJsonDocument<JSON_OBJECT_SIZE(7)>;
+
+void broadcastProgress() {
+  if (countWebSocketClients(WsProtocol::Json) == 0) {
+    return;
+  }
+  StatusJsonDocument doc;
+  const uint64_t nowUs = cueClockUs();
+  lockList();
+  fillStatus(doc, nowUs);
+  unlockList();
+
+  const size_t length = measureJson(doc);
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(length);
+  if (buffer == nullptr) {
+    Serial.println("[Liste] ⚠️ Mémoire insuffisante pour diffuser la progression");
+    return;
+  }
+  serializeJson(doc, reinterpret_cast<char *>(buffer->get()), length + 1);
+  sendToWebSocketClients(WsProtocol::Json, buffer);
+}
+
+}  // namespace
+
+const char *loadCueList(JsonVariantConst root) {
+  JsonArrayConst entries = root["steps"];
+  if (entries.isNull() || entries.size() == 0) {
+    return "missing_steps";
+  }
+  if (entries.size() > CUE_LIST_MAX_STEPS) {
+    return "too_many_steps";
+  }
+
+  const char *error = nullptr;
+  std::shared_ptr<const CompiledCueList> list = compileCueList(entries, error);
+  if (!list) {
+    return error;
+  }
+
+  std::shared_ptr<const CompiledCueList> previous;
+  lockList();
+  previous = activeList;
+  activeList = list;
+  sequence.load(list->steps.data(), list->steps.size());
+  lastExecutedStep = kNoStep;
+  const uint32_t revision = ++listRevision;
+  unlockList();
+  // L'ancienne liste est libérée hors du verrou (ou plus tard par loop() s'il l'utilise encore).
+  previous.reset();
+  progressChanged.store(true, std::memory_order_release);
+
+  Serial.printf("[Liste] 📋 Liste #%lu chargée : %u pas, %u textes (%u octets)\n",
+                static_cast<unsigned long>(revision), static_cast<unsigned>(list->steps.size()),
+                static_cast<unsigned>(list->textOffsets.size()), static_cast<unsigned>(list->textPool.size()));
+  return nullptr;
+}
+
+void cueListGo() {
+  const uint64_t nowUs = cueClockUs();
+  lockList();
+  sequence.go(nowUs);
+  unlockList();
+  progressChanged.store(true, std::memory_order_release);
+}
+
+bool cueListBack() {
+  lockList();
+  const bool moved = sequence.back();
+  unlockList();
+  progressChanged.store(true, std::memory_order_release);
+  return moved;
+}
+
+bool cueListJump(size_t step) {
+  lockList();
+  const bool moved = sequence.jump(step);
+  unlockList();
+  if (moved) {
+    progressChanged.store(true, std::memory_order_release);
+  }
+  return moved;
+}
+
+void cueListStop() {
+  lockList();
+  sequence.stop();
+  unlockList();
+  progressChanged.store(true, std::memory_order_release);
+}
+
+void serviceCueList() {
+  DueCueStep due[CUE_LIST_STEPS_PER_SERVICE];
+  std::shared_ptr<const CompiledCueList> list;
+  const uint64_t nowUs = cueClockUs();
+
+  lockList();
+  const size_t count = sequence.poll(nowUs, due, CUE_LIST_STEPS_PER_SERVICE);
+  if (count > 0) {
+    list = activeList;
+    lastExecutedStep = due[count - 1].index;
+  }
+  unlockList();
+
+  if (count > 0) {
+    executeSteps(*list, due, count, nowUs);
+    progressChanged.store(true, std::memory_order_release);
+  }
+  if (progressChanged.exchange(false, std::memory_order_acq_rel)) {
+    broadcastProgress();
+  }
+}
+
+String buildCueListStatusJson() {
+  StatusJsonDocument doc;
+  const uint64_t nowUs = cueClockUs();
+  lockList();
+  fillStatus(doc, nowUs);
+  unlockList();
+
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
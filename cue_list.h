@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// -----------------------------------------------------------------------------
+// Listes de cues exécutées par l'appareil (cue_sequence.h)
+// -----------------------------------------------------------------------------
+// Une liste est téléversée une fois puis compilée en pas compacts ; la régie n'envoie ensuite
+// que GO / retour / saut, et les enchaînements automatiques sont minutés localement.
+//
+//   {"steps":[{"action":"text","cue":0,"text":"Attente"},
+//             {"cue":0,"text":"Entrée","duration":3000},
+//             {"action":"release","cue":0,"delay":1500,"follow":true}]}
+//
+// action : "fire" (défaut), "text" ou "release" ; delay (ms) avant exécution, depuis le GO ou le
+// pas précédent ; follow : enchaîne sur le pas précédent au lieu d'attendre un GO. Les textes
+// d'une liste ne sont pas persistés.
+
+// Compile et remplace la liste en cours (exécution arrêtée, curseur au premier pas).
+// Retourne nullptr si la liste est acceptée, sinon le code d'erreur.
+const char *loadCueList(JsonVariantConst root);
+void cueListGo();
+bool cueListBack();
+bool cueListJump(size_t step);
+void cueListStop();
+// Exécute les pas arrivés à échéance et diffuse la progression (appelé depuis loop()).
+void serviceCueList();
+// {"type":"cueList","revision","count","playhead","running","executed"[,"nextInMs"]}
+String buildCueListStatusJson();
@@ -0,0 +1,303 @@
+#include "cue_persistence.h"
+
+#include <Preferences.h>
+
+#include <atomic>
+
+#include "config.h"
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#endif
+
+namespace {
+
+constexpr const char *kCuePrefsNamespace = "cue_texts";
+constexpr const char *kBlobKey = "texts";
+
+// Blob : en-tête fixe puis, pour chaque cue, un octet de longueur (0xFF = absent) suivi du texte.
+//   u32 magic | u8 version | u8 cueCount | u16 payloadLength | u32 crc32(payload)
+constexpr uint32_t kBlobMagic = 0x45554353;  // "SCUE" en petit-boutiste.
+constexpr uint8_t kBlobVersion = 1;
+constexpr size_t kBlobHeaderSize = 12;
+constexpr uint8_t kAbsentLength = 0xFF;
+constexpr size_t kBlobCapacity = kBlobHeaderSize + CUE_COUNT * (1 + MAX_CUE_TEXT_LENGTH);
+
+static_assert(MAX_CUE_TEXT_LENGTH < kAbsentLength, "La longueur d'un texte doit tenir sur un octet");
+static_assert(kBlobCapacity - kBlobHeaderSize <= UINT16_MAX, "Le blob des textes dépasse 64 Ko");
+
+Preferences cuePrefs;
+bool prefsReady = false;
+
+// Textes à persister, indépendants du magasin des cues (CueStore) : une modification non
+// persistante ne doit jamais être écrite par un flush ultérieur.
+struct PersistedText {
+  bool present = false;
+  uint8_t length = 0;
+  char text[MAX_CUE_TEXT_LENGTH] = {0};
+};
+
+PersistedText persisted[CUE_COUNT];
+bool dirty[CUE_COUNT] = {false};
+bool anyDirty = false;
+uint32_t firstDirtyMs = 0;
+uint32_t lastEditMs = 0;
+
+// Tampon de sérialisation statique, réservé par `writing` le temps d'une écriture.
+uint8_t blob[kBlobCapacity];
+std::atomic<bool> writing{false};
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE persistLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockPersist() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&persistLock);
+#endif
+}
+
+void unlockPersist() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&persistLock);
+#endif
+}
+
+uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0U - (crc & 1U)));
+    }
+  }
+  return ~crc;
+}
+
+void writeU16(uint8_t *out, uint16_t value) {
+  out[0] = static_cast<uint8_t>(value);
+  out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void writeU32(uint8_t *out, uint32_t value) {
+  writeU16(out, static_cast<uint16_t>(value));
+  writeU16(out + 2, static_cast<uint16_t>(value >> 16));
+}
+
+uint16_t readU16(const uint8_t *in) {
+  return static_cast<uint16_t>(in[0] | in[1] << 8);
+}
+
+uint32_t readU32(const uint8_t *in) {
+  return readU16(in) | static_cast<uint32_t>(readU16(in + 2)) << 16;
+}
+
+void storeText(PersistedText &entry, const char *text, size_t length) {
+  if (length > MAX_CUE_TEXT_LENGTH) {
+    length = MAX_CUE_TEXT_LENGTH;
+  }
+  memcpy(entry.text, text, length);
+  entry.length = static_cast<uint8_t>(length);
+  entry.present = true;
+}
+
+// Sérialise les textes persistés dans `blob` (appelé sous verrou) et retourne la taille totale.
+size_t encodeBlob() {
+  size_t offset = kBlobHeaderSize;
+  for (const PersistedText &entry : persisted) {
+    if (!entry.present) {
+      blob[offset++] = kAbsentLength;
+      continue;
+    }
+    blob[offset++] = entry.length;
+    memcpy(blob + offset, entry.text, entry.length);
+    offset += entry.length;
+  }
+  return offset;
+}
+
+void finalizeBlobHeader(size_t length) {
+  const uint16_t payloadLength = static_cast<uint16_t>(length - kBlobHeaderSize);
+  writeU32(blob, kBlobMagic);
+  blob[4] = kBlobVersion;
+  blob[5] = static_cast<uint8_t>(CUE_COUNT);
+  writeU16(blob + 6, payloadLength);
+  writeU32(blob + 8, crc32(blob + kBlobHeaderSize, payloadLength));
+}
+
+// Décode le blob lu depuis la NVS. Un blob écrit avec un autre CUE_COUNT reste lisible tant qu'il
+// tient dans le tampon : les cues en trop sont ignorés, les cues manquants restent absents.
+bool decodeBlob(size_t length) {
+  if (length < kBlobHeaderSize || readU32(blob) != kBlobMagic || blob[4] != kBlobVersion) {
+    return false;
+  }
+  const uint16_t payloadLength = readU16(blob + 6);
+  if (kBlobHeaderSize + payloadLength != length || crc32(blob + kBlobHeaderSize, payloadLength) != readU32(blob + 8)) {
+    return false;
+  }
+
+  const size_t storedCount = blob[5];
+  size_t offset = kBlobHeaderSize;
+  for (size_t i = 0; i < storedCount; ++i) {
+    if (offset >= length) {
+      return false;
+    }
+    const uint8_t textLength = blob[offset++];
+    if (textLength == kAbsentLength) {
+      continue;
+    }
+    if (textLength > MAX_CUE_TEXT_LENGTH || offset + textLength > length) {
+      return false;
+    }
+    if (i < CUE_COUNT) {
+      storeText(persisted[i], reinterpret_cast<const char *>(blob + offset), textLength);
+    }
+    offset += textLength;
+  }
+  return true;
+}
+
+bool writeBlob() {
+  lockPersist();
+  const size_t length = encodeBlob();
+  unlockPersist();
+
+  finalizeBlobHeader(length);
+  return cuePrefs.putBytes(kBlobKey, blob, length) == length;
+}
+
+// Reprise des textes enregistrés par les versions précédentes (une clé "cueN" par cue).
+void migrateLegacyKeys() {
+  bool migrated = false;
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    const String key = "cue" + String(i);
+    if (!cuePrefs.isKey(key.c_str())) {
+      continue;
+    }
+    const String text = cuePrefs.getString(key.c_str());
+    storeText(persisted[i], text.c_str(), text.length());
+    migrated = true;
+  }
+
+  if (!migrated) {
+    return;
+  }
+
+  if (!writeBlob()) {
+    Serial.println("[Cue] ⚠️ Migration des textes vers le blob NVS impossible");
+    return;
+  }
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    const String key = "cue" + String(i);
+    cuePrefs.remove(key.c_str());
+  }
+  Serial.println("[Cue] ✅ Textes migrés vers le blob NVS");
+}
+
+// Prend les cues modifiés si l'écriture est due : saisie stable depuis CUE_PERSIST_DEBOUNCE_MS,
+// ou modifications en attente depuis CUE_PERSIST_MAX_DELAY_MS (saisie continue).
+bool takeDirty(uint32_t nowMs, bool force, bool *taken) {
+  lockPersist();
+  const bool due = anyDirty && (force || (nowMs - lastEditMs >= CUE_PERSIST_DEBOUNCE_MS) ||
+                                (nowMs - firstDirtyMs >= CUE_PERSIST_MAX_DELAY_MS));
+  if (due) {
+    anyDirty = false;
+    for (size_t i = 0; i < CUE_COUNT; ++i) {
+      taken[i] = dirty[i];
+      dirty[i] = false;
+    }
+  }
+  unlockPersist();
+  return due;
+}
+
+void markDirty(size_t index, uint32_t nowMs) {
+  if (!anyDirty) {
+    firstDirtyMs = nowMs;
+  }
+  anyDirty = true;
+  dirty[index] = true;
+  lastEditMs = nowMs;
+}
+
+void flushDirty(uint32_t nowMs, bool force) {
+  if (!prefsReady) {
+    return;
+  }
+  // Écriture en cours dans une autre tâche : le flush périodique passe son tour, le flush forcé
+  // attend qu'elle se termine (sinon les modifications suivantes seraient perdues au redémarrage).
+  while (writing.exchange(true, std::memory_order_acquire)) {
+    if (!force) {
+      return;
+    }
+    delay(1);
+  }
+
+  bool taken[CUE_COUNT];
+  if (takeDirty(nowMs, force, taken) && !writeBlob()) {
+    Serial.println("[Cue] ⚠️ Échec d'écriture du blob des textes, nouvel essai différé");
+    lockPersist();
+    for (size_t i = 0; i < CUE_COUNT; ++i) {
+      if (taken[i]) {
+        markDirty(i, nowMs);
+      }
+    }
+    unlockPersist();
+  }
+  writing.store(false, std::memory_order_release);
+}
+
+}  // namespace
+
+void initCuePersistence() {
+  prefsReady = cuePrefs.begin(kCuePrefsNamespace, false);
+  if (!prefsReady) {
+    Serial.println("[Cue] ⚠️ Impossible d'ouvrir l'espace de préférences 'cue_texts'.");
+    return;
+  }
+
+  const size_t length = cuePrefs.getBytesLength(kBlobKey);
+  if (length > 0 && length <= kBlobCapacity && cuePrefs.getBytes(kBlobKey, blob, length) == length &&
+      decodeBlob(length)) {
+    return;
+  }
+
+  if (length > 0) {
+    Serial.println("[Cue] ⚠️ Blob des textes invalide (CRC ou format), textes par défaut");
+    for (PersistedText &entry : persisted) {
+      entry = PersistedText();
+    }
+  }
+  migrateLegacyKeys();
+}
+
+bool loadPersistedCueText(size_t index, char *text, size_t &length) {
+  if (index >= CUE_COUNT || !persisted[index].present) {
+    return false;
+  }
+  lockPersist();
+  length = persisted[index].length;
+  memcpy(text, persisted[index].text, length);
+  unlockPersist();
+  return true;
+}
+
+void persistCueTextDeferred(size_t index, const char *text, size_t length) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+
+  const uint32_t nowMs = millis();
+  lockPersist();
+  storeText(persisted[index], text, length);
+  markDirty(index, nowMs);
+  unlockPersist();
+}
+
+void serviceCuePersistence(uint32_t nowMs) {
+  flushDirty(nowMs, false);
+}
+
+void flushCuePersistence() {
+  flushDirty(millis(), true);
+}
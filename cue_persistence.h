@@ -0,0 +1,16 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Ouvre l'espace NVS et charge en une lecture le blob des textes (ou migre les anciennes clés "cueN").
+void initCuePersistence();
+// Copie dans `text` (MAX_CUE_TEXT_LENGTH octets) le texte persisté du cue ; false si aucun
+// texte n'a été enregistré pour ce cue.
+bool loadPersistedCueText(size_t index, char *text, size_t &length);
+// Copie le texte en RAM et programme l'écriture différée du blob (aucun accès flash ici).
+void persistCueTextDeferred(size_t index, const char *text, size_t length);
+// Écrit le blob lorsque les modifications sont stables depuis CUE_PERSIST_DEBOUNCE_MS (appelé depuis loop()).
+void serviceCuePersistence(uint32_t nowMs);
+// Écrit immédiatement les modifications en attente (avant un redémarrage, par exemple), après
+// avoir attendu la fin d'une écriture déjà lancée depuis loop(). Bloquant : hors de loop().
+void flushCuePersistence();
@@ -0,0 +1,68 @@
+#include "cue_sequence.h"
+
+void CueSequence::load(const CueStep *newSteps, size_t newCount) {
+  steps = newSteps;
+  count = newSteps != nullptr ? newCount : 0;
+  cursor = 0;
+  pendingActive = false;
+}
+
+size_t CueSequence::nextGoPoint(size_t from) const {
+  size_t index = from;
+  while (index < count && !isGoPoint(index)) {
+    ++index;
+  }
+  return index;
+}
+
+void CueSequence::go(uint64_t nowUs) {
+  if (cursor >= count) {
+    pendingActive = false;
+    return;
+  }
+  pending = cursor;
+  pendingDueUs = nowUs + static_cast<uint64_t>(steps[cursor].delayMs) * 1000ULL;
+  pendingActive = true;
+  cursor = nextGoPoint(cursor + 1);
+}
+
+bool CueSequence::back() {
+  pendingActive = false;
+  if (cursor == 0 || count == 0) {
+    return false;
+  }
+  size_t index = cursor - 1;
+  while (index > 0 && !isGoPoint(index)) {
+    --index;
+  }
+  cursor = index;
+  return true;
+}
+
+bool CueSequence::jump(size_t index) {
+  if (index >= count) {
+    return false;
+  }
+  pendingActive = false;
+  cursor = index;
+  return true;
+}
+
+void CueSequence::stop() {
+  pendingActive = false;
+}
+
+size_t CueSequence::poll(uint64_t nowUs, DueCueStep *out, size_t capacity) {
+  size_t produced = 0;
+  while (pendingActive && produced < capacity && pendingDueUs <= nowUs) {
+    out[produced++] = DueCueStep{pending, steps[pending], pendingDueUs};
+    const size_t next = pending + 1;
+    if (next < count && steps[next].autoFollow) {
+      pending = next;
+      pendingDueUs += static_cast<uint64_t>(steps[next].delayMs) * 1000ULL;
+    } else {
+      pendingActive = false;
+    }
+  }
+  return produced;
+}
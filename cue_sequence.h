@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Action d'un pas de liste : allumer un cue (texte facultatif), afficher un texte sans allumer
+// (mise en attente, "standby") ou éteindre un cue avant la fin de sa durée.
+enum class CueStepAction : uint8_t { Fire, Text, Release };
+
+constexpr uint16_t CUE_STEP_NO_TEXT = 0xFFFF;
+
+// Pas compilé : 12 octets, textes rangés à part et désignés par leur identifiant.
+struct CueStep {
+  CueStepAction action;
+  uint8_t target;       // Indice du cue.
+  uint16_t textId;      // CUE_STEP_NO_TEXT : aucun texte.
+  uint32_t delayMs;     // Attente avant exécution, depuis le GO ou le pas précédent.
+  uint32_t durationMs : 31;  // Fire : 0 = durée configurée pour le cue.
+  uint32_t autoFollow : 1;   // Enchaîne sur le pas précédent au lieu d'attendre un GO.
+};
+
+// Pas arrivé à échéance, rendu avec l'instant prévu de son exécution.
+struct DueCueStep {
+  size_t index;
+  CueStep step;
+  uint64_t dueUs;
+};
+
+// Moteur d'exécution d'une liste : curseur (prochain point de GO), GO / retour / saut et
+// enchaînements automatiques. Chaque échéance est calculée depuis l'échéance prévue du pas
+// précédent, jamais depuis son exécution réelle : les retards d'exécution ne s'accumulent pas.
+// Aucune horloge : l'appelant fournit l'instant courant, ce qui permet de le piloter avec une
+// horloge virtuelle. Un seul enchaînement à la fois : un GO annule celui en cours.
+class CueSequence {
+ public:
+  // `steps` doit rester valide tant que la liste est chargée.
+  void load(const CueStep *steps, size_t count);
+  void go(uint64_t nowUs);
+  // Place le curseur sur le point de GO précédent. false s'il n'y en a pas.
+  bool back();
+  // Place le curseur sur le pas `index` sans l'exécuter. false si l'indice est hors liste.
+  bool jump(size_t index);
+  // Annule l'enchaînement en cours, le curseur reste en place.
+  void stop();
+  // Rend au plus `capacity` pas arrivés à échéance à `nowUs`, dans l'ordre.
+  size_t poll(uint64_t nowUs, DueCueStep *out, size_t capacity);
+
+  size_t playhead() const { return cursor; }
+  size_t size() const { return count; }
+  bool running() const { return pendingActive; }
+  // Échéance du prochain pas de l'enchaînement (valide si running()).
+  uint64_t nextDueUs() const { return pendingDueUs; }
+
+ private:
+  bool isGoPoint(size_t index) const { return index == 0 || !steps[index].autoFollow; }
+  size_t nextGoPoint(size_t from) const;
+
+  const CueStep *steps = nullptr;
+  size_t count = 0;
+  size_t cursor = 0;
+  size_t pending = 0;
+  uint64_t pendingDueUs = 0;
+  bool pendingActive = false;
+};
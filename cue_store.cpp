@@ -0,0 +1,90 @@
+#include "cue_store.h"
+
+#include <string.h>
+
+namespace {
+
+// Mêmes blancs que String::trim() (isspace).
+bool isBlank(char c) {
+  return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool isUtf8Continuation(char c) {
+  return (static_cast<uint8_t>(c) & 0xC0) == 0x80;
+}
+
+}  // namespace
+
+CueTextView trimCueText(const char *text, size_t length, size_t maxLength) {
+  if (text == nullptr) {
+    return CueTextView{"", 0};
+  }
+  size_t start = 0;
+  while (start < length && isBlank(text[start])) {
+    ++start;
+  }
+  size_t end = length;
+  while (end > start && isBlank(text[end - 1])) {
+    --end;
+  }
+  if (end - start > maxLength) {
+    end = start + maxLength;
+    // Recule au début du caractère coupé : la coupe tombe alors entre deux caractères.
+    while (end > start && isUtf8Continuation(text[end])) {
+      --end;
+    }
+  }
+  return CueTextView{text + start, end - start};
+}
+
+CueStore::CueStore() {
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    lengths[i] = 0;
+    texts[i][0] = '\0';
+  }
+}
+
+void CueStore::lock() const {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&storeLock);
+#endif
+}
+
+void CueStore::unlock() const {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&storeLock);
+#endif
+}
+
+void CueStore::copyText(size_t index, CueTextCopy &out) const {
+  lock();
+  out.length = lengths[index];
+  memcpy(out.text, texts[index], lengths[index] + 1);
+  unlock();
+}
+
+void CueStore::copyTexts(const bool *selected, CueTextCopy *out) const {
+  lock();
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (selected[i]) {
+      out[i].length = lengths[i];
+      memcpy(out[i].text, texts[i], lengths[i] + 1);
+    }
+  }
+  unlock();
+}
+
+bool CueStore::assignText(size_t index, const char *text, size_t length) {
+  if (length > MAX_CUE_TEXT_LENGTH) {
+    length = MAX_CUE_TEXT_LENGTH;
+  }
+  lock();
+  const bool unchanged = length == lengths[index] && memcmp(texts[index], text, length) == 0;
+  if (!unchanged) {
+    memcpy(texts[index], text, length);
+    texts[index][length] = '\0';
+    lengths[index] = static_cast<uint8_t>(length);
+  }
+  unlock();
+  return !unchanged;
+}
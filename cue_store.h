@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#endif
+
+// Vue en lecture seule sur un texte, sans copie (non terminée par NUL).
+struct CueTextView {
+  const char *data;
+  size_t length;
+};
+
+// Copie d'un texte du magasin, terminée par NUL.
+struct CueTextCopy {
+  uint8_t length = 0;
+  char text[MAX_CUE_TEXT_LENGTH + 1] = {0};
+
+  CueTextView view() const { return CueTextView{text, length}; }
+};
+
+// Retire les blancs en tête et en fin, puis tronque à `maxLength` octets sans couper de
+// caractère UTF-8. La vue rendue pointe dans `text`.
+CueTextView trimCueText(const char *text, size_t length, size_t maxLength);
+
+// Textes des cues à capacité fixe, stockés en place : aucune allocation ni fragmentation du tas.
+// Tableaux parallèles : les longueurs, consultées à chaque modification, sont contiguës ; les
+// octets des textes sont rangés à part. Les textes sont modifiés depuis plusieurs tâches
+// (AsyncTCP, AsyncUDP, loop()) : ils ne sont lus que par copie, sous le verrou du magasin.
+class CueStore {
+ public:
+  CueStore();
+
+  void copyText(size_t index, CueTextCopy &out) const;
+  // Copie en une fois les textes sélectionnés : un état cohérent entre cues pour une trame.
+  void copyTexts(const bool *selected, CueTextCopy *out) const;
+  // Remplace le texte (déjà nettoyé, tronqué à MAX_CUE_TEXT_LENGTH octets) ; false s'il est
+  // identique au texte en place (longueur, puis octets si elle est égale).
+  bool assignText(size_t index, const char *text, size_t length);
+
+ private:
+  static_assert(MAX_CUE_TEXT_LENGTH <= UINT8_MAX, "La longueur d'un texte est codée sur un octet");
+
+  void lock() const;
+  void unlock() const;
+
+  uint8_t lengths[CUE_COUNT];
+  char texts[CUE_COUNT][MAX_CUE_TEXT_LENGTH + 1];
+#if defined(ESP_PLATFORM)
+  mutable portMUX_TYPE storeLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+};
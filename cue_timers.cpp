@@ -0,0 +1,296 @@
+#include "cue_timers.h"
+
+#include <atomic>
+
+#include "config.h"
+#include "deadline_heap.h"
+
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#endif
+
+namespace {
+
+DeadlineHeap<CUE_COUNT> deadlines;
+// Reflet de deadlines.contains(), lisible sans verrou (état des cues, trames de diffusion).
+std::atomic<bool> running[CUE_COUNT];
+std::atomic<bool> expired[CUE_COUNT];
+std::atomic<bool> anyExpired{false};
+
+// Activations programmées : même timer matériel que les extinctions, file distincte.
+DeadlineHeap<CUE_COUNT> starts;
+uint32_t startDurationsMs[CUE_COUNT] = {0};
+uint64_t startTargetsUs[CUE_COUNT] = {0};
+uint64_t startFiredUs[CUE_COUNT] = {0};
+std::atomic<bool> started[CUE_COUNT];
+std::atomic<bool> anyStarted{false};
+CueOutputAction outputAction = nullptr;
+
+constexpr uint64_t kNoDeadline = UINT64_MAX;
+
+#if defined(ESP_PLATFORM)
+// Section critique et non mutex : la tâche esp_timer ne doit jamais attendre loop() ou AsyncTCP.
+// Sous verrou, seulement les tas d'échéances et les compteurs atomiques : les sorties (GPIO,
+// métriques) et le réarmement esp_timer sont appliqués après déverrouillage (applyTimerChanges).
+portMUX_TYPE timersLock = portMUX_INITIALIZER_UNLOCKED;
+esp_timer_handle_t deadlineTimer = nullptr;
+#endif
+// Incrémentée sous verrou à chaque modification des tas ou de running[].
+uint32_t timersRevision = 0;
+
+void lockTimers() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&timersLock);
+#endif
+}
+
+void unlockTimers() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&timersLock);
+#endif
+}
+
+// Sorties et réarmement décidés sous verrou, appliqués ensuite hors verrou.
+struct TimerChanges {
+  uint16_t outputs[2 * CUE_COUNT];  // Un cue peut s'allumer puis s'éteindre dans le même passage.
+  size_t outputCount = 0;
+  uint32_t revision = 0;
+  uint64_t nextDeadlineUs = kNoDeadline;
+
+  void addOutput(size_t index) { outputs[outputCount++] = static_cast<uint16_t>(index); }
+};
+
+// Appelé sous verrou.
+uint64_t nextDeadlineUs() {
+  uint64_t next = kNoDeadline;
+  if (!deadlines.empty()) {
+    next = deadlines.nextDeadline();
+  }
+  if (!starts.empty() && starts.nextDeadline() < next) {
+    next = starts.nextDeadline();
+  }
+  return next;
+}
+
+// Appelé sous verrou, en fin de modification : fige la révision et la prochaine échéance.
+void closeTimerChanges(TimerChanges &changes) {
+  changes.revision = ++timersRevision;
+  changes.nextDeadlineUs = nextDeadlineUs();
+}
+
+void armDeadlineTimer(uint64_t next) {
+#if defined(ESP_PLATFORM)
+  if (deadlineTimer == nullptr) {
+    return;
+  }
+  esp_timer_stop(deadlineTimer);
+  if (next == kNoDeadline) {
+    return;
+  }
+  const uint64_t now = cueClockUs();
+  esp_timer_start_once(deadlineTimer, next > now ? next - now : 1);
+#endif
+}
+
+// Hors verrou. Une autre tâche a pu modifier l'état depuis le déverrouillage et appliquer ses
+// propres changements avant les nôtres : tant que la révision a bougé, on réapplique l'état
+// courant (sorties lues dans running[], prochaine échéance relue), si bien que la dernière
+// écriture d'une sortie ou du timer est toujours à jour.
+void applyTimerChanges(TimerChanges &changes) {
+  for (;;) {
+    if (outputAction != nullptr) {
+      for (size_t i = 0; i < changes.outputCount; ++i) {
+        const size_t index = changes.outputs[i];
+        outputAction(index, running[index].load(std::memory_order_acquire));
+      }
+    }
+    armDeadlineTimer(changes.nextDeadlineUs);
+
+    lockTimers();
+    if (timersRevision == changes.revision) {
+      unlockTimers();
+      return;
+    }
+    changes.revision = timersRevision;
+    changes.nextDeadlineUs = nextDeadlineUs();
+    unlockTimers();
+  }
+}
+
+// Appelé sous verrou.
+void scheduleCue(size_t index, uint32_t durationMs, uint64_t startedAtUs, TimerChanges &changes) {
+  expired[index].store(false, std::memory_order_release);
+  deadlines.schedule(index, startedAtUs + static_cast<uint64_t>(durationMs) * 1000ULL);
+  running[index].store(true, std::memory_order_release);
+  changes.addOutput(index);
+}
+
+// Appelé sous verrou.
+void expireCue(size_t index, TimerChanges &changes) {
+  running[index].store(false, std::memory_order_release);
+  expired[index].store(true, std::memory_order_release);
+  anyExpired.store(true, std::memory_order_release);
+  changes.addOutput(index);
+}
+
+// Allume les activations programmées puis éteint les sorties arrivées à échéance ; coût nul
+// lorsqu'aucune échéance n'est atteinte.
+void serviceDeadlines() {
+  TimerChanges changes;
+  lockTimers();
+  const uint64_t now = cueClockUs();
+  size_t index = 0;
+  while (!starts.empty() && starts.nextDeadline() <= now) {
+    const uint64_t target = starts.nextDeadline();
+    starts.popDue(now, index);
+    // L'extinction part de l'instant visé : la durée reste alignée sur celle des autres appareils.
+    scheduleCue(index, startDurationsMs[index], target, changes);
+    startTargetsUs[index] = target;
+    startFiredUs[index] = cueClockUs();
+    started[index].store(true, std::memory_order_release);
+    anyStarted.store(true, std::memory_order_release);
+  }
+  while (deadlines.popDue(now, index)) {
+    expireCue(index, changes);
+  }
+  closeTimerChanges(changes);
+  unlockTimers();
+  applyTimerChanges(changes);
+}
+
+#if defined(ESP_PLATFORM)
+void onDeadlineTimer(void *) {
+  serviceDeadlines();
+}
+#endif
+
+}  // namespace
+
+uint64_t cueClockUs() {
+#if defined(ESP_PLATFORM)
+  return static_cast<uint64_t>(esp_timer_get_time());
+#else
+  static uint32_t last = 0;
+  static uint64_t high = 0;
+  const uint32_t now = micros();
+  if (now < last) {
+    high += 1ULL << 32;
+  }
+  last = now;
+  return high | now;
+#endif
+}
+
+void initCueTimers(CueOutputAction applyOutput) {
+  outputAction = applyOutput;
+
+#if defined(ESP_PLATFORM)
+  const esp_timer_create_args_t args = {
+      .callback = onDeadlineTimer,
+      .arg = nullptr,
+      .dispatch_method = ESP_TIMER_TASK,
+      .name = "cue_deadline",
+      .skip_unhandled_events = true,
+  };
+  if (esp_timer_create(&args, &deadlineTimer) != ESP_OK) {
+    deadlineTimer = nullptr;
+    Serial.println("[Cue] ⚠️ Timer d'échéance indisponible, expiration traitée dans loop()");
+  }
+#endif
+}
+
+void startCueTimer(size_t index, uint32_t durationMs, uint64_t startedAtUs) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+
+  TimerChanges changes;
+  lockTimers();
+  scheduleCue(index, durationMs, startedAtUs, changes);
+  closeTimerChanges(changes);
+  unlockTimers();
+  applyTimerChanges(changes);
+}
+
+void startCueTimers(const bool *selected, const uint32_t *durationsMs, uint64_t startedAtUs) {
+  TimerChanges changes;
+  lockTimers();
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (selected[i]) {
+      scheduleCue(i, durationsMs[i], startedAtUs, changes);
+    }
+  }
+  closeTimerChanges(changes);
+  unlockTimers();
+  applyTimerChanges(changes);
+}
+
+void scheduleCueStart(size_t index, uint64_t startAtUs, uint32_t durationMs) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+
+  TimerChanges changes;
+  lockTimers();
+  startDurationsMs[index] = durationMs;
+  starts.schedule(index, startAtUs);
+  closeTimerChanges(changes);
+  unlockTimers();
+  applyTimerChanges(changes);
+}
+
+void stopCueTimer(size_t index) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+
+  TimerChanges changes;
+  lockTimers();
+  starts.cancel(index);
+  if (deadlines.contains(index)) {
+    deadlines.cancel(index);
+    expireCue(index, changes);
+  }
+  closeTimerChanges(changes);
+  unlockTimers();
+  applyTimerChanges(changes);
+}
+
+bool isCueTimerRunning(size_t index) {
+  return index < CUE_COUNT && running[index].load(std::memory_order_acquire);
+}
+
+void dispatchCueTimerEvents(CueStartHandler onStarted, CueExpiryHandler onExpired) {
+#if defined(ESP_PLATFORM)
+  if (deadlineTimer == nullptr) {
+    serviceDeadlines();
+  }
+#else
+  serviceDeadlines();
+#endif
+
+  if (anyStarted.exchange(false, std::memory_order_acq_rel)) {
+    for (size_t i = 0; i < CUE_COUNT; ++i) {
+      if (!started[i].exchange(false, std::memory_order_acq_rel)) {
+        continue;
+      }
+      lockTimers();
+      const uint64_t target = startTargetsUs[i];
+      const uint64_t fired = startFiredUs[i];
+      unlockTimers();
+      if (onStarted != nullptr) {
+        onStarted(i, target, fired);
+      }
+    }
+  }
+
+  if (!anyExpired.exchange(false, std::memory_order_acq_rel)) {
+    return;
+  }
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (expired[i].exchange(false, std::memory_order_acq_rel) && onExpired != nullptr) {
+      onExpired(i);
+    }
+  }
+}
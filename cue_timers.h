@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Sortie matérielle appliquée à l'échéance exacte (LED), depuis le contexte du timer.
+using CueOutputAction = void (*)(size_t index, bool active);
+// Traitement différé dans loop() d'un cue arrivé à échéance (état, diffusion).
+using CueExpiryHandler = void (*)(size_t index);
+// Traitement différé dans loop() d'une activation programmée : instant visé et instant effectif.
+using CueStartHandler = void (*)(size_t index, uint64_t targetUs, uint64_t firedAtUs);
+
+void initCueTimers(CueOutputAction applyOutput);
+// Active la sortie du cue et programme son extinction à `startedAtUs + durationMs`.
+void startCueTimer(size_t index, uint32_t durationMs, uint64_t startedAtUs);
+// Active ensemble les cues sélectionnés (même instant de départ, un seul réarmement du timer).
+void startCueTimers(const bool *selected, const uint32_t *durationsMs, uint64_t startedAtUs);
+// Active la sortie du cue à `startAtUs` (même horloge que cueClockUs()), puis l'éteint
+// `durationMs` plus tard ; remplace une activation programmée encore en attente pour ce cue.
+void scheduleCueStart(size_t index, uint64_t startAtUs, uint32_t durationMs);
+// Éteint la sortie du cue sans attendre son échéance (traité ensuite comme une expiration)
+// et annule son activation programmée éventuelle.
+void stopCueTimer(size_t index);
+bool isCueTimerRunning(size_t index);
+void dispatchCueTimerEvents(CueStartHandler onStarted, CueExpiryHandler onExpired);
+// Horloge monotone 64 bits (µs) utilisée pour les échéances.
+uint64_t cueClockUs();
@@ -2,226 +2,536 @@
 
 #include <ArduinoJson.h>
 #include <ESPAsyncWebServer.h>
-#include <Preferences.h>
+#include <esp_system.h>
 
+#include <atomic>
+
+#include "buttons.h"
 #include "config.h"
+#include "cue_json.h"
+#include "cue_persistence.h"
+#include "cue_store.h"
+#include "cue_timers.h"
 #include "display_manager.h"
+#include "latency_metrics.h"
+#include "web_server.h"
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#endif
 
 extern AsyncWebSocket ws;
 
 namespace {
 
-struct CueState {
-  bool active = false;
-  uint32_t triggeredAt = 0;
-};
-
-CueState states[CUE_COUNT];
-Preferences cuePrefs;
-bool prefsReady = false;
+CueScheduledStartHandler scheduledStartHandler = nullptr;
+CueStore cueStore;
 
-int lastButtonReading[CUE_COUNT] = {0};
-int stableButtonState[CUE_COUNT] = {0};
-uint32_t lastDebounceTimestamp[CUE_COUNT] = {0};
-bool buttonConfigured[CUE_COUNT] = {false};
+// Texte par défaut : entrée de defaultCueTexts si fournie, sinon "Cue N" écrit dans `buffer`.
+CueTextView defaultCueText(size_t index, char *buffer, size_t capacity) {
+  if (defaultCueTexts[index] != nullptr) {
+    return trimCueText(defaultCueTexts[index], strlen(defaultCueTexts[index]), MAX_CUE_TEXT_LENGTH);
+  }
+  const int length = snprintf(buffer, capacity, "Cue %u", static_cast<unsigned>(index + 1));
+  return CueTextView{buffer, length > 0 ? static_cast<size_t>(length) : 0};
+}
 
-uint32_t lastCleanup = 0;
+void updateLedState(size_t index, bool active) {
+  if (cueLEDs[index] < 0) {
+    return;
+  }
+  digitalWrite(cueLEDs[index], active ? HIGH : LOW);
+  if (active) {
+    markTriggerStage(index, LatencyStage::LedOn);
+  }
+}
 
-constexpr const char *kCuePrefsNamespace = "cue_texts";
+CueJsonState readCueJsonState(size_t index, CueTextCopy &text) {
+  cueStore.copyText(index, text);
+  return CueJsonState{index, isCueTimerRunning(index), isDisplayReady(index), text};
+}
 
-void ensurePreferences() {
-  if (!prefsReady) {
-    prefsReady = cuePrefs.begin(kCuePrefsNamespace, false);
-    if (!prefsReady) {
-      Serial.println("[Cue] ⚠️ Impossible d'ouvrir l'espace de préférences 'cue_texts'.");
-    }
-  }
+void fillCueEntry(JsonObject entry, size_t index) {
+  CueTextCopy text;
+  fillCueEntry(entry, readCueJsonState(index, text));
 }
 
-String sanitizeCueText(const String &raw) {
-  String sanitized = raw;
-  sanitized.trim();
-  if (sanitized.length() > MAX_CUE_TEXT_LENGTH) {
-    sanitized.remove(MAX_CUE_TEXT_LENGTH);
-  }
-  return sanitized;
+String buildCueJson(size_t index, const char *type) {
+  CueTextCopy text;
+  return buildCueJson(type, readCueJsonState(index, text));
 }
 
-void persistCueText(size_t index) {
-  if (!prefsReady) {
-    ensurePreferences();
+uint8_t cueFrameFlags(size_t index) {
+  uint8_t flags = 0;
+  if (isCueTimerRunning(index)) {
+    flags |= BINARY_FLAG_ACTIVE;
   }
-  if (!prefsReady || index >= CUE_COUNT) {
-    return;
+  if (isDisplayReady(index)) {
+    flags |= BINARY_FLAG_DISPLAY_READY;
   }
+  return flags;
+}
 
-  const String key = "cue" + String(index);
-  if (!cuePrefs.putString(key.c_str(), cueTexts[index])) {
-    Serial.printf("[Cue] ⚠️ Échec d'écriture de la préférence %s.\n", key.c_str());
-  }
+// Changements survenus depuis la dernière trame "batch". Les déclenchements peuvent provenir
+// de la tâche AsyncTCP alors que la diffusion a lieu dans loop() ; deltaLock garantit qu'un lot
+// de commandes marqué en une fois ne sera jamais réparti sur deux trames.
+std::atomic<bool> pendingDeltas[CUE_COUNT];
+uint32_t lastBatchFlush = 0;
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE deltaLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockDeltas() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&deltaLock);
+#endif
 }
 
-void configureButton(size_t index) {
-  if (cueButtons[index] < 0) {
-    buttonConfigured[index] = false;
-    return;
-  }
+void unlockDeltas() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&deltaLock);
+#endif
+}
+
+// Journal circulaire des changements : chaque trame "batch" incrémente la version globale et
+// y inscrit les cues modifiés. Un client qui se reconnecte avec ?since=<version> ne reçoit que
+// les cues modifiés depuis, tant que cette version n'est pas sortie du journal.
+struct JournalEntry {
+  uint32_t version = 0;
+  uint8_t index = 0;
+};
+
+JournalEntry journal[CUE_JOURNAL_CAPACITY];
+size_t journalHead = 0;
+size_t journalSize = 0;
+uint32_t journalEvictedVersion = 0;  // Plus haute version retirée du journal.
+uint32_t stateVersion = 0;
+uint32_t stateEpoch = 0;  // Tiré au démarrage : invalide les versions d'une session précédente.
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE journalLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockJournal() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&journalLock);
+#endif
+}
 
-  if (BUTTON_USE_PULLUP) {
-    pinMode(cueButtons[index], INPUT_PULLUP);
-  } else {
-    pinMode(cueButtons[index], INPUT);
+void unlockJournal() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&journalLock);
+#endif
+}
+
+uint32_t recordJournal(const bool *changed) {
+  lockJournal();
+  const uint32_t version = ++stateVersion;
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (!changed[i]) {
+      continue;
+    }
+    if (journalSize == CUE_JOURNAL_CAPACITY) {
+      journalEvictedVersion = journal[journalHead].version;
+    } else {
+      ++journalSize;
+    }
+    journal[journalHead].version = version;
+    journal[journalHead].index = static_cast<uint8_t>(i);
+    journalHead = (journalHead + 1) % CUE_JOURNAL_CAPACITY;
   }
+  unlockJournal();
+  return version;
+}
 
-  int current = digitalRead(cueButtons[index]);
-  lastButtonReading[index] = current;
-  stableButtonState[index] = current;
-  buttonConfigured[index] = true;
+uint32_t currentVersion() {
+  lockJournal();
+  const uint32_t version = stateVersion;
+  unlockJournal();
+  return version;
 }
 
-void updateLedState(size_t index, bool active) {
-  digitalWrite(cueLEDs[index], active ? HIGH : LOW);
+// Marque dans `changed` les cues modifiés après `since`. Retourne false si le journal ne
+// permet pas de répondre (autre époque, version future ou trop ancienne).
+bool collectChangesSince(uint32_t epoch, uint32_t since, bool *changed, uint32_t &version) {
+  lockJournal();
+  version = stateVersion;
+  const bool covered = epoch == stateEpoch && since <= stateVersion && since >= journalEvictedVersion;
+  if (covered) {
+    for (size_t i = 0; i < CUE_COUNT; ++i) {
+      changed[i] = false;
+    }
+    for (size_t i = 0; i < journalSize; ++i) {
+      if (journal[i].version > since) {
+        changed[journal[i].index] = true;
+      }
+    }
+  }
+  unlockJournal();
+  return covered;
 }
 
-String buildCueJson(size_t index, const char *type) {
-  StaticJsonDocument<256> doc;
+size_t countSelected(const bool *selected) {
+  size_t count = 0;
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (selected == nullptr || selected[i]) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Liste d'états (snapshot si `selected` est nul, delta sinon).
+String buildCueListJson(const char *type, const bool *selected, uint32_t version, const uint32_t *since) {
+  CueListJsonDocument doc;
   doc["type"] = type;
-  doc["index"] = static_cast<uint8_t>(index);
-  doc["active"] = states[index].active;
-  doc["text"] = cueTexts[index];
-  doc["displayReady"] = isDisplayReady(index);
+  doc["seq"] = version;
+  doc["epoch"] = stateEpoch;
+  if (since != nullptr) {
+    doc["since"] = *since;
+  }
+  JsonArray cues = doc.createNestedArray("cues");
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (selected == nullptr || selected[i]) {
+      fillCueEntry(cues.createNestedObject(), i);
+    }
+  }
 
   String payload;
   serializeJson(doc, payload);
   return payload;
 }
 
-}  // namespace
+size_t buildCueListFrame(BinaryOpcode opcode, const bool *selected, uint32_t version, uint8_t *out,
+                         size_t capacity) {
+  size_t written = writeBinarySnapshotHeader(out, capacity, opcode, static_cast<uint8_t>(countSelected(selected)),
+                                             version, stateEpoch);
+  if (written == 0) {
+    return 0;
+  }
 
-String cueTexts[CUE_COUNT];
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (selected != nullptr && !selected[i]) {
+      continue;
+    }
+    CueTextCopy text;
+    cueStore.copyText(i, text);
+    const size_t entry = writeBinarySnapshotEntry(out + written, capacity - written, static_cast<uint8_t>(i),
+                                                  cueFrameFlags(i), text.text, text.length);
+    if (entry == 0) {
+      return 0;
+    }
+    written += entry;
+  }
+  return written;
+}
 
-void initCues() {
-  ensurePreferences();
+void markCueChanged(size_t index) {
+  pendingDeltas[index].store(true, std::memory_order_release);
+}
 
+void markCuesChanged(const bool *changed) {
+  lockDeltas();
   for (size_t i = 0; i < CUE_COUNT; ++i) {
-    pinMode(cueLEDs[i], OUTPUT);
-    updateLedState(i, false);
+    if (changed[i]) {
+      pendingDeltas[i].store(true, std::memory_order_release);
+    }
+  }
+  unlockDeltas();
+}
 
-    cueTexts[i].reserve(MAX_CUE_TEXT_LENGTH + 1);
-    if (prefsReady) {
-      const String key = "cue" + String(i);
-      const String stored = cuePrefs.getString(key.c_str(), defaultCueTexts[i]);
-      cueTexts[i] = sanitizeCueText(stored);
-      if (cueTexts[i].isEmpty()) {
-        cueTexts[i] = defaultCueTexts[i];
-      }
-    } else {
-      cueTexts[i] = defaultCueTexts[i];
+AsyncWebSocketMessageBuffer *allocateBroadcastBuffer(size_t length) {
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(length);
+  if (buffer == nullptr) {
+    Serial.println("[Cue] ⚠️ Mémoire insuffisante pour diffuser l'état des cues");
+  }
+  return buffer;
+}
+
+void broadcastBatchJson(const bool *changed, uint32_t sequence) {
+  CueListJsonDocument doc;
+  doc["type"] = "batch";
+  doc["seq"] = sequence;
+  JsonArray cues = doc.createNestedArray("cues");
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (changed[i]) {
+      fillCueEntry(cues.createNestedObject(), i);
     }
+  }
 
-    configureButton(i);
-    updateDisplay(i, cueTexts[i]);
+  const size_t length = measureJson(doc);
+  AsyncWebSocketMessageBuffer *buffer = allocateBroadcastBuffer(length);
+  if (buffer == nullptr) {
+    return;
   }
+
+  serializeJson(doc, reinterpret_cast<char *>(buffer->get()), length + 1);
+  sendCueStateToWebSocketClients(WsProtocol::Json, buffer, sequence);
 }
 
-void updateCues() {
-  const uint32_t now = millis();
+// Textes de la trame binaire en cours, copiés en une fois (loop() uniquement) : la taille
+// calculée et les entrées écrites proviennent du même état.
+CueTextCopy batchTexts[CUE_COUNT];
 
+void broadcastBatchBinary(const bool *changed, size_t count, uint32_t sequence) {
+  cueStore.copyTexts(changed, batchTexts);
+  size_t length = BINARY_BATCH_HEADER_SIZE;
   for (size_t i = 0; i < CUE_COUNT; ++i) {
-    if (states[i].active && (now - states[i].triggeredAt >= CUE_ACTIVE_DURATION_MS)) {
-      states[i].active = false;
-      updateLedState(i, false);
-      ws.textAll(buildCueStateJson(i));
+    if (changed[i]) {
+      length += binarySnapshotEntrySize(batchTexts[i].length);
     }
+  }
+
+  AsyncWebSocketMessageBuffer *buffer = allocateBroadcastBuffer(length);
+  if (buffer == nullptr) {
+    return;
+  }
 
-    if (!buttonConfigured[i]) {
+  uint8_t *out = buffer->get();
+  size_t written = writeBinaryBatchHeader(out, length, static_cast<uint8_t>(count), sequence);
+  for (size_t i = 0; i < CUE_COUNT && written != 0; ++i) {
+    if (!changed[i]) {
       continue;
     }
+    const size_t entry = writeBinarySnapshotEntry(out + written, length - written, static_cast<uint8_t>(i),
+                                                  cueFrameFlags(i), batchTexts[i].text, batchTexts[i].length);
+    written = entry != 0 ? written + entry : 0;
+  }
+  if (written != length) {
+    // Trame incohérente : jamais diffusée, le tampon non verrouillé est libéré par _cleanBuffers().
+    Serial.println("[Cue] ⚠️ Trame binaire incohérente, diffusion abandonnée");
+    ws._cleanBuffers();
+    return;
+  }
+  sendCueStateToWebSocketClients(WsProtocol::Binary, buffer, sequence);
+}
+
+// Regroupe tous les changements d'une itération (ou d'une fenêtre CUE_BATCH_WINDOW_MS) en une
+// seule trame numérotée par protocole, afin que les clients puissent détecter les pertes.
+void flushPendingDeltas(uint32_t now) {
+  if (now - lastBatchFlush < CUE_BATCH_WINDOW_MS) {
+    return;
+  }
 
-    const int reading = digitalRead(cueButtons[i]);
-    if (reading != lastButtonReading[i]) {
-      lastDebounceTimestamp[i] = now;
-      lastButtonReading[i] = reading;
+  bool changed[CUE_COUNT];
+  size_t count = 0;
+  lockDeltas();
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    changed[i] = pendingDeltas[i].exchange(false, std::memory_order_acq_rel);
+    if (changed[i]) {
+      ++count;
     }
+  }
+  unlockDeltas();
 
-    if ((now - lastDebounceTimestamp[i]) >= BUTTON_DEBOUNCE_MS && reading != stableButtonState[i]) {
-      stableButtonState[i] = reading;
-      if (stableButtonState[i] == BUTTON_ACTIVE_STATE) {
-        triggerCue(i);
-      }
+  if (count == 0) {
+    return;
+  }
+
+  lastBatchFlush = now;
+  const uint32_t sequence = recordJournal(changed);
+
+  if (countWebSocketClients(WsProtocol::Json) > 0) {
+    broadcastBatchJson(changed, sequence);
+  }
+  if (countWebSocketClients(WsProtocol::Binary) > 0) {
+    broadcastBatchBinary(changed, count, sequence);
+  }
+
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (changed[i]) {
+      markTriggerStage(i, LatencyStage::BroadcastQueued);
     }
   }
+}
 
-  if (now - lastCleanup >= WS_CLIENT_CLEANUP_INTERVAL_MS) {
-    ws.cleanupClients();
-    lastCleanup = now;
+uint32_t resolveDuration(size_t index, uint32_t durationMs) {
+  if (durationMs != 0) {
+    return durationMs;
   }
+  return cueActiveDurationsMs[index] != 0 ? cueActiveDurationsMs[index] : CUE_ACTIVE_DURATION_MS;
 }
 
-void setCueText(size_t index, const String &text, bool persist) {
-  if (index >= CUE_COUNT) {
-    return;
+// Remplace le texte du cue (et programme sa persistance) ; true s'il a changé.
+bool assignCueText(size_t index, const char *text, size_t length, bool persist) {
+  char fallback[16];
+  CueTextView sanitized = trimCueText(text, length, MAX_CUE_TEXT_LENGTH);
+  if (sanitized.length == 0) {
+    sanitized = defaultCueText(index, fallback, sizeof(fallback));
   }
 
-  String sanitized = sanitizeCueText(text);
-  if (sanitized.isEmpty()) {
-    sanitized = defaultCueTexts[index];
+  if (persist) {
+    persistCueTextDeferred(index, sanitized.data, sanitized.length);
   }
+  return cueStore.assignText(index, sanitized.data, sanitized.length);
+}
+
+void refreshDisplay(size_t index) {
+  CueTextCopy text;
+  cueStore.copyText(index, text);
+  updateDisplay(index, text.text, text.length);
+}
+
+// La LED est allumée et son extinction programmée par le planificateur d'échéances ; l'état
+// "actif" d'un cue correspond à la présence d'une échéance en attente.
+void activateCue(size_t index, uint64_t startedAtUs, uint32_t durationMs) {
+  startCueTimer(index, resolveDuration(index, durationMs), startedAtUs);
+  refreshDisplay(index);
+
+  markCueChanged(index);
+}
+
+// L'appui est daté à son front réel : la durée d'activation part de cet instant.
+void onButtonPress(size_t index, uint32_t pressedAtUs) {
+  const uint64_t now = cueClockUs();
+  const uint32_t elapsedUs = static_cast<uint32_t>(now) - pressedAtUs;
+  beginTriggerTrace(index, TriggerSource::Button, pressedAtUs);
+  activateCue(index, now - elapsedUs, 0);
+}
 
-  if (cueTexts[index] == sanitized) {
-    if (persist) {
-      persistCueText(index);
+// La LED est déjà allumée (contexte du timer) : reste l'affichage et la diffusion.
+void onCueStarted(size_t index, uint64_t targetUs, uint64_t firedAtUs) {
+  refreshDisplay(index);
+  markCueChanged(index);
+  if (scheduledStartHandler != nullptr) {
+    scheduledStartHandler(index, targetUs, firedAtUs);
+  }
+}
+
+void onCueExpired(size_t index) {
+  markCueChanged(index);
+}
+
+}  // namespace
+
+void initCues() {
+  initCuePersistence();
+  stateEpoch = esp_random();
+  initCueTimers(updateLedState);
+
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (cueLEDs[i] >= 0) {
+      pinMode(cueLEDs[i], OUTPUT);
+    }
+    updateLedState(i, false);
+
+    char stored[MAX_CUE_TEXT_LENGTH];
+    size_t length = 0;
+    if (!loadPersistedCueText(i, stored, length)) {
+      length = 0;
     }
+    assignCueText(i, stored, length, false);
+    refreshDisplay(i);
+  }
+
+  initButtons();
+}
+
+void updateCues() {
+  const uint32_t now = millis();
+
+  dispatchCueTimerEvents(onCueStarted, onCueExpired);
+  processButtons(onButtonPress);
+
+  flushPendingDeltas(now);
+  serviceCuePersistence(now);
+}
+
+void setCueText(size_t index, const char *text, size_t length, bool persist) {
+  if (index >= CUE_COUNT) {
     return;
   }
 
-  cueTexts[index] = sanitized;
+  if (assignCueText(index, text, length, persist)) {
+    refreshDisplay(index);
+    markCueChanged(index);
+  }
+}
+
+void applyCueBatch(const CueOperation *operations, size_t count) {
+  bool changed[CUE_COUNT] = {false};
+  bool triggered[CUE_COUNT] = {false};
+  uint32_t durationsMs[CUE_COUNT] = {0};
 
-  if (persist) {
-    persistCueText(index);
+  for (size_t i = 0; i < count; ++i) {
+    const CueOperation &operation = operations[i];
+    if (operation.index >= CUE_COUNT) {
+      continue;
+    }
+    if (operation.text != nullptr &&
+        assignCueText(operation.index, operation.text, operation.textLength, operation.persist)) {
+      changed[operation.index] = true;
+    }
+    if (operation.trigger) {
+      triggered[operation.index] = true;
+      durationsMs[operation.index] = resolveDuration(operation.index, operation.durationMs);
+    }
   }
 
-  updateDisplay(index, cueTexts[index]);
-  ws.textAll(buildCueStateJson(index));
+  startCueTimers(triggered, durationsMs, cueClockUs());
+
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    changed[i] = changed[i] || triggered[i];
+    if (changed[i]) {
+      refreshDisplay(i);
+    }
+  }
+  markCuesChanged(changed);
 }
 
-void triggerCue(size_t index) {
+void triggerCue(size_t index, uint32_t durationMs) {
   if (index >= CUE_COUNT) {
     return;
   }
+  activateCue(index, cueClockUs(), durationMs);
+}
 
-  setCueText(index, cueTexts[index], false);
+void setCueScheduledStartHandler(CueScheduledStartHandler handler) {
+  scheduledStartHandler = handler;
+}
 
-  states[index].active = true;
-  states[index].triggeredAt = millis();
-  updateLedState(index, true);
-  updateDisplay(index, cueTexts[index]);
+void triggerCueAt(size_t index, uint64_t startAtUs, uint32_t durationMs) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+  scheduleCueStart(index, startAtUs, resolveDuration(index, durationMs));
+}
 
-  ws.textAll(buildCueStateJson(index));
+void releaseCue(size_t index) {
+  stopCueTimer(index);
 }
 
 bool isCueActive(size_t index) {
   if (index >= CUE_COUNT) {
     return false;
   }
-  return states[index].active;
+  return isCueTimerRunning(index);
 }
 
-String buildCueSnapshotJson() {
-  StaticJsonDocument<512> doc;
-  doc["type"] = "snapshot";
-  JsonArray cues = doc.createNestedArray("cues");
-  for (size_t i = 0; i < CUE_COUNT; ++i) {
-    JsonObject entry = cues.createNestedObject();
-    entry["index"] = static_cast<uint8_t>(i);
-    entry["text"] = cueTexts[i];
-    entry["active"] = states[i].active;
-    entry["displayReady"] = isDisplayReady(i);
+void copyCueText(size_t index, CueTextCopy &out) {
+  if (index >= CUE_COUNT) {
+    out = CueTextCopy();
+    return;
   }
+  cueStore.copyText(index, out);
+}
 
-  String payload;
-  serializeJson(doc, payload);
-  return payload;
+uint32_t cueStateEpoch() {
+  return stateEpoch;
+}
+
+String buildCueSnapshotJson() {
+  return buildCueListJson("snapshot", nullptr, currentVersion(), nullptr);
+}
+
+String buildCueDeltaJson(uint32_t epoch, uint32_t sinceVersion) {
+  bool changed[CUE_COUNT];
+  uint32_t version = 0;
+  if (!collectChangesSince(epoch, sinceVersion, changed, version)) {
+    return buildCueListJson("snapshot", nullptr, version, nullptr);
+  }
+  return buildCueListJson("delta", changed, version, &sinceVersion);
 }
 
 String buildCueStateJson(size_t index) {
@@ -229,4 +539,26 @@ String buildCueStateJson(size_t index) {
     return String();
   }
   return buildCueJson(index, "cue");
-}
\ No newline at end of file
+}
+
+size_t buildCueStateFrame(size_t index, uint8_t *out, size_t capacity) {
+  if (index >= CUE_COUNT) {
+    return 0;
+  }
+  CueTextCopy text;
+  cueStore.copyText(index, text);
+  return writeBinaryCueState(out, capacity, static_cast<uint8_t>(index), cueFrameFlags(index), text.text, text.length);
+}
+
+size_t buildCueSnapshotFrame(uint8_t *out, size_t capacity) {
+  return buildCueListFrame(BinaryOpcode::Snapshot, nullptr, currentVersion(), out, capacity);
+}
+
+size_t buildCueDeltaFrame(uint32_t epoch, uint32_t sinceVersion, uint8_t *out, size_t capacity) {
+  bool changed[CUE_COUNT];
+  uint32_t version = 0;
+  if (!collectChangesSince(epoch, sinceVersion, changed, version)) {
+    return buildCueListFrame(BinaryOpcode::Snapshot, nullptr, version, out, capacity);
+  }
+  return buildCueListFrame(BinaryOpcode::Delta, changed, version, out, capacity);
+}
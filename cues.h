@@ -2,14 +2,55 @@
 
 #include <Arduino.h>
 
+#include "binary_protocol.h"
 #include "config.h"
-
-extern String cueTexts[CUE_COUNT];
+#include "cue_store.h"
 
 void initCues();
 void updateCues();
-void triggerCue(size_t index);
-void setCueText(size_t index, const String &text, bool persist = true);
+// `durationMs` = 0 : durée configurée pour ce cue (cueActiveDurationsMs / CUE_ACTIVE_DURATION_MS).
+void triggerCue(size_t index, uint32_t durationMs = 0);
+// Le texte est copié dans le magasin des cues : `text` n'a pas à rester valide.
+void setCueText(size_t index, const char *text, size_t length, bool persist = true);
+inline void setCueText(size_t index, const String &text, bool persist = true) {
+  setCueText(index, text.c_str(), text.length(), persist);
+}
+// Copie du texte courant du cue (lu sous le verrou du magasin).
+void copyCueText(size_t index, CueTextCopy &out);
+// Éteint le cue avant la fin de sa durée (sans effet s'il n'est pas actif).
+void releaseCue(size_t index);
+
+// Déclenchement à un instant absolu de cueClockUs(), pour un départ simultané entre appareils.
+// Le gestionnaire reçoit, depuis loop(), l'instant visé et l'instant où la LED s'est allumée.
+using CueScheduledStartHandler = void (*)(size_t index, uint64_t targetUs, uint64_t firedAtUs);
+void setCueScheduledStartHandler(CueScheduledStartHandler handler);
+void triggerCueAt(size_t index, uint64_t startAtUs, uint32_t durationMs = 0);
+
+// Opération d'un lot : texte facultatif, puis déclenchement facultatif.
+struct CueOperation {
+  size_t index;
+  const char *text;  // nullptr : texte inchangé.
+  size_t textLength;
+  bool persist;
+  bool trigger;
+  uint32_t durationMs;
+};
+
+// Applique toutes les opérations (indices déjà validés) en une passe : les LEDs s'allument au même
+// instant et les changements partent dans une seule trame "batch".
+void applyCueBatch(const CueOperation *operations, size_t count);
 bool isCueActive(size_t index);
 String buildCueSnapshotJson();
+// Époque des versions d'état (tirée au démarrage), à fournir avec une version à buildCueDeltaJson.
+uint32_t cueStateEpoch();
 String buildCueStateJson(size_t index);
+// Cues modifiés depuis `sinceVersion` ; bascule sur un snapshot complet si l'époque ne correspond
+// plus (redémarrage) ou si la version est sortie du journal.
+String buildCueDeltaJson(uint32_t epoch, uint32_t sinceVersion);
+
+// Équivalents binaires (voir binary_protocol.h). Retournent le nombre d'octets écrits, 0 en cas d'échec.
+constexpr size_t CUE_SNAPSHOT_FRAME_CAPACITY =
+    BINARY_SNAPSHOT_HEADER_SIZE + CUE_COUNT * binarySnapshotEntrySize(MAX_CUE_TEXT_LENGTH);
+size_t buildCueStateFrame(size_t index, uint8_t *out, size_t capacity);
+size_t buildCueSnapshotFrame(uint8_t *out, size_t capacity);
+size_t buildCueDeltaFrame(uint32_t epoch, uint32_t sinceVersion, uint8_t *out, size_t capacity);
@@ -1,13 +1,48 @@
 const TOKEN_STORAGE_KEY = 'stagecue-token';
 const DEFAULT_TOKEN = 'stagecue-admin';
 const MAX_LOG_ENTRIES = 50;
+const PROTOCOL_STORAGE_KEY = 'stagecue-protocol';
+
+// Protocole WebSocket binaire (voir binary_protocol.h côté firmware).
+const BinaryOpcode = Object.freeze({
+  TRIGGER: 0x01,
+  SET_TEXT: 0x02,
+  PING: 0x03,
+  PONG: 0x04,
+  CUE_STATE: 0x10,
+  SNAPSHOT: 0x11,
+  BATCH: 0x12,
+  DELTA: 0x13,
+  ERROR: 0x7f,
+});
+const BINARY_FLAG_PERSIST = 0x01;
+const BINARY_FLAG_HAS_TEXT = 0x02;
+const BINARY_FLAG_ACTIVE = 0x01;
+const BINARY_FLAG_DISPLAY_READY = 0x02;
+const BINARY_ERRORS = { 1: 'invalid_frame', 2: 'invalid_cue' };
+const MAX_BINARY_TEXT_BYTES = 0xff;
+
+const textEncoder = new TextEncoder();
+const textDecoder = new TextDecoder();
+
+function resolveProtocol() {
+  const requested = new URLSearchParams(window.location.search).get('proto');
+  if (requested) {
+    localStorage.setItem(PROTOCOL_STORAGE_KEY, requested);
+    return requested;
+  }
+  return localStorage.getItem(PROTOCOL_STORAGE_KEY) || 'json';
+}
 
 const state = {
   token: localStorage.getItem(TOKEN_STORAGE_KEY) || DEFAULT_TOKEN,
+  binary: resolveProtocol() === 'bin',
   ws: null,
   reconnectTimer: null,
   reconnectDelay: 2000,
   expectingClose: false,
+  lastSeq: null,
+  epoch: null,
   cues: new Map(),
 };
 
@@ -16,7 +51,10 @@ const connectionLabel = document.getElementById('connectionLabel');
 const connectionDetails = document.getElementById('connectionDetails');
 const tokenForm = document.getElementById('tokenForm');
 const tokenInput = document.getElementById('tokenInput');
-const cueCards = Array.from(document.querySelectorAll('.cue'));
+const cueGrid = document.getElementById('cueGrid');
+const cueTemplate = document.getElementById('cueTemplate');
+// Les cartes sont créées à la demande : le nombre de cues dépend de la configuration du firmware.
+const cueCards = [];
 const logList = document.getElementById('eventLog');
 const clearLogButton = document.getElementById('clearLog');
 const connectionPanel = document.getElementById('connectionPanel');
@@ -63,9 +101,34 @@ function logEvent(message, type = 'info') {
   }
 }
 
+function createCueCard(index) {
+  const card = cueTemplate.content.firstElementChild.cloneNode(true);
+  const textArea = card.querySelector('textarea');
+  const label = card.querySelector('label');
+  const help = card.querySelector('.status-details');
+
+  card.dataset.index = index;
+  card.querySelector('h2').textContent = `Cue ${index + 1}`;
+  textArea.id = `text${index}`;
+  textArea.name = `text${index}`;
+  label.htmlFor = textArea.id;
+  help.id = `help${index}`;
+  textArea.setAttribute('aria-describedby', help.id);
+  return card;
+}
+
+function ensureCueCards(count) {
+  while (cueCards.length < count) {
+    const card = createCueCard(cueCards.length);
+    cueCards.push(card);
+    cueGrid.appendChild(card);
+  }
+}
+
 function updateCueCard(index, cueState) {
+  if (!Number.isInteger(index) || index < 0) return;
+  ensureCueCards(index + 1);
   const card = cueCards[index];
-  if (!card) return;
 
   const textArea = card.querySelector('textarea');
   const statusLabel = card.querySelector('.cue-status');
@@ -85,8 +148,18 @@ function updateCueCard(index, cueState) {
   card.dataset.displayReady = cueState.displayReady ? 'true' : 'false';
 }
 
+function rememberSyncPoint(message) {
+  if (typeof message.seq === 'number') {
+    state.lastSeq = message.seq;
+  }
+  if (typeof message.epoch === 'number') {
+    state.epoch = message.epoch;
+  }
+}
+
 function applySnapshot(snapshot) {
   if (!snapshot || !Array.isArray(snapshot.cues)) return;
+  rememberSyncPoint(snapshot);
   snapshot.cues.forEach((cue) => {
     state.cues.set(cue.index, cue);
     updateCueCard(cue.index, cue);
@@ -100,10 +173,164 @@ function handleCueUpdate(cue) {
   logEvent(`Cue ${cue.index + 1} → ${cue.active ? 'déclenché' : 'repos'} (${cue.text})`, 'info');
 }
 
+function appendSyncParams(params) {
+  if (state.lastSeq !== null && state.epoch !== null) {
+    params.set('since', state.lastSeq);
+    params.set('epoch', state.epoch);
+  }
+}
+
 function buildWebSocketUrl() {
   const protocol = window.location.protocol === 'https:' ? 'wss' : 'ws';
-  const tokenPart = state.token ? `?token=${encodeURIComponent(state.token)}` : '';
-  return `${protocol}://${window.location.host}/ws${tokenPart}`;
+  const params = new URLSearchParams();
+  if (state.token) {
+    params.set('token', state.token);
+  }
+  if (state.binary) {
+    params.set('proto', 'bin');
+  }
+  appendSyncParams(params);
+  const query = params.toString();
+  return `${protocol}://${window.location.host}/ws${query ? `?${query}` : ''}`;
+}
+
+function encodeBinaryText(text) {
+  let bytes = textEncoder.encode(text);
+  if (bytes.length > MAX_BINARY_TEXT_BYTES) {
+    let end = MAX_BINARY_TEXT_BYTES;
+    // Ne coupe pas au milieu d'une séquence UTF-8.
+    while (end > 0 && (bytes[end] & 0xc0) === 0x80) {
+      end -= 1;
+    }
+    bytes = bytes.subarray(0, end);
+  }
+  return bytes;
+}
+
+function encodeBinaryCommand(opcode, cue, { text, persist = false } = {}) {
+  let flags = persist ? BINARY_FLAG_PERSIST : 0;
+  const textBytes = typeof text === 'string' ? encodeBinaryText(text) : null;
+  if (textBytes) {
+    flags |= BINARY_FLAG_HAS_TEXT;
+  }
+
+  const frame = new Uint8Array(3 + (textBytes ? 1 + textBytes.length : 0));
+  frame[0] = opcode;
+  frame[1] = cue;
+  frame[2] = flags;
+  if (textBytes) {
+    frame[3] = textBytes.length;
+    frame.set(textBytes, 4);
+  }
+  return frame;
+}
+
+// Lit une entrée [flags][longueur][texte] à partir de `offset`.
+function decodeBinaryCueEntry(bytes, index, offset) {
+  const flags = bytes[offset];
+  const length = bytes[offset + 1];
+  const start = offset + 2;
+  if (start + length > bytes.length) {
+    throw new Error('Trame binaire tronquée');
+  }
+  return {
+    cue: {
+      index,
+      active: (flags & BINARY_FLAG_ACTIVE) !== 0,
+      displayReady: (flags & BINARY_FLAG_DISPLAY_READY) !== 0,
+      text: textDecoder.decode(bytes.subarray(start, start + length)),
+    },
+    next: start + length,
+  };
+}
+
+function decodeBinaryCueEntries(bytes, count, offset) {
+  const cues = [];
+  let position = offset;
+  for (let i = 0; i < count; i += 1) {
+    const { cue, next } = decodeBinaryCueEntry(bytes, bytes[position], position + 1);
+    cues.push(cue);
+    position = next;
+  }
+  return cues;
+}
+
+// Convertit une trame binaire serveur dans la même forme que les messages JSON.
+function decodeBinaryFrame(buffer) {
+  const bytes = new Uint8Array(buffer);
+  if (bytes.length < 3) {
+    throw new Error('Trame binaire trop courte');
+  }
+
+  switch (bytes[0]) {
+    case BinaryOpcode.CUE_STATE: {
+      const { cue } = decodeBinaryCueEntry(bytes, bytes[1], 2);
+      return { type: 'cue', ...cue };
+    }
+    case BinaryOpcode.SNAPSHOT:
+    case BinaryOpcode.DELTA: {
+      if (bytes.length < 11) {
+        throw new Error('Trame binaire tronquée');
+      }
+      const view = new DataView(bytes.buffer, bytes.byteOffset + 3, 8);
+      return {
+        type: bytes[0] === BinaryOpcode.SNAPSHOT ? 'snapshot' : 'delta',
+        seq: view.getUint32(0, true),
+        epoch: view.getUint32(4, true),
+        cues: decodeBinaryCueEntries(bytes, bytes[1], 11),
+      };
+    }
+    case BinaryOpcode.BATCH: {
+      if (bytes.length < 7) {
+        throw new Error('Trame binaire tronquée');
+      }
+      const seq = new DataView(bytes.buffer, bytes.byteOffset + 3, 4).getUint32(0, true);
+      return { type: 'batch', seq, cues: decodeBinaryCueEntries(bytes, bytes[1], 7) };
+    }
+    case BinaryOpcode.PONG:
+      return { type: 'pong' };
+    case BinaryOpcode.ERROR:
+      return { type: 'error', message: BINARY_ERRORS[bytes[2]] || `code_${bytes[2]}` };
+    default:
+      throw new Error(`Opcode binaire inconnu : ${bytes[0]}`);
+  }
+}
+
+function applyBatch(batch) {
+  if (!Array.isArray(batch.cues)) return;
+  if (state.lastSeq !== null && batch.seq !== state.lastSeq + 1) {
+    logEvent(`Messages perdus (séquence ${state.lastSeq} → ${batch.seq}), resynchronisation…`, 'warn');
+    fetchSnapshot();
+  }
+  state.lastSeq = batch.seq;
+  batch.cues.forEach(handleCueUpdate);
+}
+
+// Seuls les cues modifiés depuis la dernière version connue (?since=…).
+function applyDelta(delta) {
+  if (!Array.isArray(delta.cues)) return;
+  rememberSyncPoint(delta);
+  delta.cues.forEach(handleCueUpdate);
+}
+
+function applyStateMessage(payload) {
+  if (payload.type === 'delta') {
+    applyDelta(payload);
+  } else {
+    applySnapshot(payload);
+  }
+}
+
+function handleServerMessage(payload) {
+  if (payload.type === 'snapshot' || payload.type === 'delta') {
+    applyStateMessage(payload);
+  } else if (payload.type === 'batch') {
+    applyBatch(payload);
+  } else if (payload.type === 'cue') {
+    handleCueUpdate(payload);
+  } else if (payload.type === 'error') {
+    logEvent(`Erreur serveur : ${payload.message}`, 'error');
+  }
 }
 
 function scheduleReconnect() {
@@ -129,6 +356,7 @@ function connectWebSocket(manual = false) {
 
   const url = buildWebSocketUrl();
   const socket = new WebSocket(url);
+  socket.binaryType = 'arraybuffer';
   state.ws = socket;
 
   setConnectionState('Connexion en cours…', 'Ouverture du canal temps réel.', 'status-indicator--pending');
@@ -138,7 +366,6 @@ function connectWebSocket(manual = false) {
     logEvent('Connexion WebSocket établie.');
     state.reconnectDelay = 2000;
     state.expectingClose = false;
-    fetchSnapshot();
   };
 
   socket.onclose = (event) => {
@@ -160,24 +387,22 @@ function connectWebSocket(manual = false) {
 
   socket.onmessage = (event) => {
     try {
-      const payload = JSON.parse(event.data);
-      if (payload.type === 'snapshot') {
-        applySnapshot(payload);
-      } else if (payload.type === 'cue') {
-        handleCueUpdate(payload);
-      } else if (payload.type === 'error') {
-        logEvent(`Erreur serveur : ${payload.message}`, 'error');
-      }
+      const payload =
+        event.data instanceof ArrayBuffer ? decodeBinaryFrame(event.data) : JSON.parse(event.data);
+      handleServerMessage(payload);
     } catch (error) {
-      console.error('Message JSON invalide', event.data, error);
+      console.error('Message WebSocket invalide', event.data, error);
     }
   };
 }
 
 async function fetchSnapshot() {
   try {
-    const data = await fetchJson('/api/cues', { method: 'GET' });
-    applySnapshot(data);
+    const params = new URLSearchParams();
+    appendSyncParams(params);
+    const query = params.toString();
+    const data = await fetchJson(`/api/cues${query ? `?${query}` : ''}`, { method: 'GET' });
+    applyStateMessage(data);
   } catch (error) {
     logEvent(`Impossible de récupérer l'état initial : ${error.message}`, 'error');
   }
@@ -215,7 +440,11 @@ function sendTrigger(index, persist = true) {
   };
 
   if (state.ws && state.ws.readyState === WebSocket.OPEN) {
-    state.ws.send(JSON.stringify(payload));
+    state.ws.send(
+      state.binary
+        ? encodeBinaryCommand(BinaryOpcode.TRIGGER, index, { text, persist })
+        : JSON.stringify(payload),
+    );
     logEvent(`Commande de cue ${index + 1} envoyée via WebSocket.`, 'info');
   } else {
     persistCueText(index).then(() => triggerViaHttp(index)).catch(() => triggerViaHttp(index));
@@ -238,18 +467,18 @@ async function triggerViaHttp(index) {
 }
 
 function bindCueEvents() {
-  cueCards.forEach((card, index) => {
-    card.addEventListener('click', (event) => {
-      const button = event.target.closest('button[data-action]');
-      if (!button) return;
-
-      const action = button.dataset.action;
-      if (action === 'save') {
-        persistCueText(index);
-      } else if (action === 'trigger') {
-        sendTrigger(index);
-      }
-    });
+  cueGrid.addEventListener('click', (event) => {
+    const button = event.target.closest('button[data-action]');
+    const card = event.target.closest('.cue');
+    if (!button || !card) return;
+
+    const index = Number(card.dataset.index);
+    const action = button.dataset.action;
+    if (action === 'save') {
+      persistCueText(index);
+    } else if (action === 'trigger') {
+      sendTrigger(index);
+    }
   });
 }
 
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tas binaire indexé d'échéances : une entrée au plus par identifiant (0..Capacity-1).
+// Reprogrammer un identifiant met à jour son échéance sur place ; consulter la prochaine
+// échéance est en O(1), insérer / annuler en O(log n). Aucune horloge : l'appelant fournit
+// l'instant courant, ce qui permet de piloter le tas avec une horloge virtuelle.
+template <size_t Capacity>
+class DeadlineHeap {
+  static_assert(Capacity > 0 && Capacity < 0xFFFF, "Capacité hors limites");
+
+ public:
+  DeadlineHeap() {
+    for (auto &position : positions) {
+      position = kAbsent;
+    }
+  }
+
+  void schedule(size_t id, uint64_t deadline) {
+    if (id >= Capacity) {
+      return;
+    }
+    deadlines[id] = deadline;
+    if (positions[id] == kAbsent) {
+      heap[count] = static_cast<uint16_t>(id);
+      positions[id] = static_cast<uint16_t>(count);
+      ++count;
+    }
+    siftUp(positions[id]);
+    siftDown(positions[id]);
+  }
+
+  void cancel(size_t id) {
+    if (!contains(id)) {
+      return;
+    }
+    const size_t position = positions[id];
+    --count;
+    if (position != count) {
+      place(position, heap[count]);
+      siftUp(position);
+      siftDown(positions[heap[position]]);
+    }
+    positions[id] = kAbsent;
+  }
+
+  bool contains(size_t id) const { return id < Capacity && positions[id] != kAbsent; }
+  bool empty() const { return count == 0; }
+  uint64_t nextDeadline() const { return deadlines[heap[0]]; }
+
+  // Retire l'échéance la plus proche si elle est atteinte à `now`.
+  bool popDue(uint64_t now, size_t &id) {
+    if (count == 0 || deadlines[heap[0]] > now) {
+      return false;
+    }
+    id = heap[0];
+    cancel(id);
+    return true;
+  }
+
+ private:
+  static constexpr uint16_t kAbsent = 0xFFFF;
+
+  void place(size_t position, uint16_t id) {
+    heap[position] = id;
+    positions[id] = static_cast<uint16_t>(position);
+  }
+
+  void siftUp(size_t position) {
+    const uint16_t id = heap[position];
+    while (position > 0) {
+      const size_t parent = (position - 1) / 2;
+      if (deadlines[heap[parent]] <= deadlines[id]) {
+        break;
+      }
+      place(position, heap[parent]);
+      position = parent;
+    }
+    place(position, id);
+  }
+
+  void siftDown(size_t position) {
+    const uint16_t id = heap[position];
+    for (;;) {
+      size_t child = position * 2 + 1;
+      if (child >= count) {
+        break;
+      }
+      if (child + 1 < count && deadlines[heap[child + 1]] < deadlines[heap[child]]) {
+        ++child;
+      }
+      if (deadlines[id] <= deadlines[heap[child]]) {
+        break;
+      }
+      place(position, heap[child]);
+      position = child;
+    }
+    place(position, id);
+  }
+
+  uint64_t deadlines[Capacity] = {};
+  uint16_t heap[Capacity] = {};
+  uint16_t positions[Capacity];
+  size_t count = 0;
+};
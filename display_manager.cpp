@@ -1,17 +1,45 @@
 #include "display_manager.h"
 
 #include "config.h"
+#include "cue_store.h"
+#include "latency_metrics.h"
+#include "text_layout.h"
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <Wire.h>
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#include <array>
+#include <utility>
 
 namespace {
 
-Adafruit_SSD1306 displays[CUE_COUNT] = {
-    Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1),
-    Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1),
-    Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1)};
+// Horloge du bus I2C, y compris entre deux transactions de la bibliothèque : par défaut,
+// Adafruit_SSD1306 repasse à 100 kHz (clkAfter) après chaque commande, ce qui ralentirait
+// les données envoyées ensuite par flushDirtyPages().
+constexpr uint32_t kI2cClockHz = 400000;
+
+template <size_t... Index>
+std::array<Adafruit_SSD1306, sizeof...(Index)> makeDisplays(std::index_sequence<Index...>) {
+  return {{(static_cast<void>(Index),
+            Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1, kI2cClockHz, kI2cClockHz))...}};
+}
+
+// Un contrôleur SSD1306 par cue, quel que soit CUE_COUNT.
+std::array<Adafruit_SSD1306, CUE_COUNT> displays = makeDisplays(std::make_index_sequence<CUE_COUNT>());
+
+constexpr size_t kPageCount = SCREEN_HEIGHT / 8;
+constexpr size_t kFrameBufferSize = SCREEN_WIDTH * kPageCount;
+// Nombre d'octets de données par transaction I2C (octet de contrôle 0x40 exclu).
+#if defined(I2C_BUFFER_LENGTH)
+constexpr size_t kI2cDataChunk = I2C_BUFFER_LENGTH - 1;
+#else
+constexpr size_t kI2cDataChunk = 31;
+#endif
 
 struct DisplayState {
   bool ready = false;
@@ -20,88 +48,244 @@ struct DisplayState {
 
 DisplayState states[CUE_COUNT];
 
-String sanitizeText(const String &raw) {
-  String sanitized = raw;
-  sanitized.trim();
-  if (sanitized.isEmpty()) {
-    sanitized = F("(vide)");
+// Entre deux rendus, le tampon d'Adafruit_SSD1306 reflète exactement le contenu du contrôleur :
+// il est copié ici avant d'être redessiné, puis comparé à la nouvelle image. Un seul rendu a lieu
+// à la fois (tâche d'affichage, ou appelant en rendu synchrone) : une copie de 1 Ko pour tous
+// les écrans plutôt qu'une copie fantôme par écran.
+uint8_t previousFrame[kFrameBufferSize];
+
+// Canal actuellement ouvert : un seul canal de multiplexeur est actif à la fois afin que deux
+// écrans de même adresse placés sur des canaux différents ne se répondent jamais ensemble.
+uint8_t activeMux = DISPLAY_NO_MUX;
+uint8_t activeChannel = 0;
+
+// Ordre de rafraîchissement trié par (multiplexeur, canal) : les écrans d'un même canal sont
+// servis à la suite, ce qui limite les commutations.
+size_t renderOrder[CUE_COUNT];
+
+bool writeMuxChannels(uint8_t muxAddress, uint8_t channelMask) {
+  Wire.beginTransmission(muxAddress);
+  Wire.write(channelMask);
+  return Wire.endTransmission() == 0;
+}
+
+bool selectDisplayBus(const DisplayLocation &location) {
+  if (location.muxAddress == activeMux &&
+      (location.muxAddress == DISPLAY_NO_MUX || location.muxChannel == activeChannel)) {
+    return true;
+  }
+
+  if (activeMux != DISPLAY_NO_MUX && activeMux != location.muxAddress) {
+    writeMuxChannels(activeMux, 0);
+  }
+
+  bool ok = true;
+  if (location.muxAddress != DISPLAY_NO_MUX) {
+    ok = writeMuxChannels(location.muxAddress, static_cast<uint8_t>(1U << location.muxChannel));
+  }
+
+  activeMux = ok ? location.muxAddress : DISPLAY_NO_MUX;
+  activeChannel = ok ? location.muxChannel : 0;
+  if (!ok) {
+    Serial.printf("[Display] ⚠️ Multiplexeur 0x%02X injoignable\n", location.muxAddress);
+  }
+  return ok;
+}
+
+uint16_t busKey(size_t index) {
+  return static_cast<uint16_t>(displayLocations[index].muxAddress << 8 | displayLocations[index].muxChannel);
+}
+
+void buildRenderOrder() {
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    size_t position = i;
+    while (position > 0 && busKey(renderOrder[position - 1]) > busKey(i)) {
+      renderOrder[position] = renderOrder[position - 1];
+      --position;
+    }
+    renderOrder[position] = i;
   }
-  if (sanitized.length() > MAX_CUE_TEXT_LENGTH) {
-    sanitized.remove(MAX_CUE_TEXT_LENGTH);
+}
+
+void sendPageSpan(const DisplayState &state, uint8_t page, uint8_t firstColumn, uint8_t lastColumn,
+                  const uint8_t *data) {
+  // Fenêtre d'écriture en une seule transaction (octet de contrôle 0x00 suivi des commandes),
+  // plutôt que six appels à ssd1306_command() qui recadrent chacun l'horloge du bus.
+  const uint8_t window[] = {0x00, SSD1306_PAGEADDR, page, page, SSD1306_COLUMNADDR, firstColumn, lastColumn};
+  Wire.beginTransmission(state.address);
+  Wire.write(window, sizeof(window));
+  Wire.endTransmission();
+
+  size_t remaining = static_cast<size_t>(lastColumn - firstColumn) + 1;
+  while (remaining > 0) {
+    const size_t chunk = remaining < kI2cDataChunk ? remaining : kI2cDataChunk;
+    Wire.beginTransmission(state.address);
+    Wire.write(static_cast<uint8_t>(0x40));
+    Wire.write(data, chunk);
+    Wire.endTransmission();
+    data += chunk;
+    remaining -= chunk;
+  }
+}
+
+// Envoie uniquement les pages (8 lignes) modifiées, restreintes à la plage de colonnes qui diffère
+// de l'image précédente. Un texte inchangé ne génère aucun trafic I2C.
+void flushDirtyPages(const uint8_t *buffer, const DisplayState &state) {
+  for (uint8_t page = 0; page < kPageCount; ++page) {
+    const size_t offset = static_cast<size_t>(page) * SCREEN_WIDTH;
+    const uint8_t *current = buffer + offset;
+    const uint8_t *previous = previousFrame + offset;
+
+    int first = -1;
+    int last = -1;
+    for (int column = 0; column < SCREEN_WIDTH; ++column) {
+      if (current[column] != previous[column]) {
+        if (first < 0) {
+          first = column;
+        }
+        last = column;
+      }
+    }
+
+    if (first < 0) {
+      continue;
+    }
+
+    sendPageSpan(state, page, static_cast<uint8_t>(first), static_cast<uint8_t>(last), current + first);
+  }
+}
+
+CueTextView sanitizeText(const char *text, size_t length) {
+  const CueTextView sanitized = trimCueText(text, length, MAX_CUE_TEXT_LENGTH);
+  if (sanitized.length == 0) {
+    return CueTextView{"(vide)", 6};
   }
   return sanitized;
 }
 
-void renderWrappedText(Adafruit_SSD1306 &display, const String &text) {
+void renderWrappedText(Adafruit_SSD1306 &display, const char *text, size_t length) {
   display.clearDisplay();
   display.setTextWrap(false);
   display.setTextSize(1);
   display.setTextColor(SSD1306_WHITE);
 
   constexpr uint8_t lineHeight = 8;  // Taille d'une ligne en pixels pour TextSize=1.
-  uint8_t currentLine = 0;
-  const uint8_t maxLines = SCREEN_HEIGHT / lineHeight;
-
-  int start = 0;
-  while (start < text.length() && currentLine < maxLines) {
-    int newlineIndex = text.indexOf('\n', start);
-    int end = newlineIndex >= 0 ? newlineIndex : text.length();
-    String line = text.substring(start, end);
-
-    while (!line.isEmpty() && currentLine < maxLines) {
-      int16_t x1, y1;
-      uint16_t w, h;
-      display.getTextBounds(line, 0, 0, &x1, &y1, &w, &h);
-
-      if (w <= SCREEN_WIDTH) {
-        display.setCursor(0, currentLine * lineHeight);
-        display.print(line);
-        currentLine++;
-        break;
-      }
+  constexpr uint8_t maxLines = SCREEN_HEIGHT / lineHeight;
 
-      // On coupe proprement la ligne pour tenir sur l'écran.
-      int breakIndex = line.length();
-      while (breakIndex > 0) {
-        String candidate = line.substring(0, breakIndex);
-        display.getTextBounds(candidate, 0, 0, &x1, &y1, &w, &h);
-        if (w <= SCREEN_WIDTH) {
-          display.setCursor(0, currentLine * lineHeight);
-          display.print(candidate);
-          currentLine++;
-          line.remove(0, breakIndex);
-          line.trim();
-          break;
-        }
-        breakIndex--;
-      }
+  TextLine lines[maxLines];
+  const size_t lineCount = layoutWrappedText(text, length, SCREEN_WIDTH, lines, maxLines);
+
+  for (size_t i = 0; i < lineCount; ++i) {
+    display.setCursor(0, static_cast<int16_t>(i * lineHeight));
+    display.write(reinterpret_cast<const uint8_t *>(text + lines[i].start), lines[i].length);
+  }
+}
 
-      if (breakIndex == 0) {
-        // Aucun découpage ne rentre -> on coupe brutalement sur la largeur.
-        display.setCursor(0, currentLine * lineHeight);
-        display.print(line.substring(0, SCREEN_WIDTH / 6));
-        line.remove(0, SCREEN_WIDTH / 6);
-        currentLine++;
+void renderScreen(size_t index, const char *text, size_t length) {
+  uint8_t *buffer = displays[index].getBuffer();
+  if (buffer == nullptr) {
+    return;
+  }
+
+  memcpy(previousFrame, buffer, kFrameBufferSize);
+  renderWrappedText(displays[index], text, length);
+  if (!selectDisplayBus(displayLocations[index])) {
+    // Rien n'a été envoyé : le tampon doit continuer de refléter l'écran.
+    memcpy(buffer, previousFrame, kFrameBufferSize);
+    return;
+  }
+  flushDirtyPages(buffer, states[index]);
+  markTriggerStage(index, LatencyStage::DisplayFlushed);
+}
+
+#if defined(ESP_PLATFORM)
+// Boîte aux lettres d'une case par écran : une nouvelle demande remplace celle en attente,
+// la tâche d'affichage ne rend donc jamais une image périmée.
+struct RenderSlot {
+  bool pending = false;
+  uint8_t length = 0;
+  char text[MAX_CUE_TEXT_LENGTH + 1] = {0};
+};
+
+static_assert(MAX_CUE_TEXT_LENGTH <= UINT8_MAX, "RenderSlot::length est codé sur un octet");
+
+RenderSlot mailbox[CUE_COUNT];
+portMUX_TYPE mailboxLock = portMUX_INITIALIZER_UNLOCKED;
+TaskHandle_t displayTask = nullptr;
+
+bool takePendingRender(size_t index, char *text, size_t &length) {
+  bool pending = false;
+  portENTER_CRITICAL(&mailboxLock);
+  if (mailbox[index].pending) {
+    length = mailbox[index].length;
+    memcpy(text, mailbox[index].text, length);
+    mailbox[index].pending = false;
+    pending = true;
+  }
+  portEXIT_CRITICAL(&mailboxLock);
+  return pending;
+}
+
+// Seule cette tâche accède au bus I2C et aux tampons des écrans après initDisplay().
+void displayTaskLoop(void *) {
+  char text[MAX_CUE_TEXT_LENGTH + 1];
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    for (const size_t index : renderOrder) {
+      size_t length = 0;
+      if (takePendingRender(index, text, length)) {
+        renderScreen(index, text, length);
       }
     }
+  }
+}
 
-    start = end + 1;
+void startDisplayTask() {
+  if (xTaskCreatePinnedToCore(displayTaskLoop, "display", DISPLAY_TASK_STACK_SIZE, nullptr, DISPLAY_TASK_PRIORITY,
+                              &displayTask, tskNO_AFFINITY) != pdPASS) {
+    displayTask = nullptr;
+    Serial.println("[Display] ⚠️ Tâche d'affichage indisponible, rendu synchrone");
   }
+}
+#endif
 
-  display.display();
+void postRender(size_t index, CueTextView text) {
+  const size_t length = text.length > MAX_CUE_TEXT_LENGTH ? MAX_CUE_TEXT_LENGTH : text.length;
+
+#if defined(ESP_PLATFORM)
+  if (displayTask != nullptr) {
+    portENTER_CRITICAL(&mailboxLock);
+    memcpy(mailbox[index].text, text.data, length);
+    mailbox[index].length = static_cast<uint8_t>(length);
+    mailbox[index].pending = true;
+    portEXIT_CRITICAL(&mailboxLock);
+    xTaskNotifyGive(displayTask);
+    return;
+  }
+#endif
+
+  renderScreen(index, text.data, length);
 }
 
 }  // namespace
 
 void initDisplay() {
   Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
-  Wire.setClock(400000);
+  Wire.setClock(kI2cClockHz);
 
-  for (size_t i = 0; i < CUE_COUNT; ++i) {
-    states[i].address = displayAddresses[i];
+  buildRenderOrder();
+
+  for (const size_t i : renderOrder) {
+    const DisplayLocation &location = displayLocations[i];
+    states[i].address = location.address;
 
-    if (!displays[i].begin(SSD1306_SWITCHCAPVCC, states[i].address)) {
-      Serial.printf("[Display] ❌ Aucun écran détecté à l'adresse 0x%02X\n", states[i].address);
+    if (!selectDisplayBus(location) || !displays[i].begin(SSD1306_SWITCHCAPVCC, states[i].address)) {
+      if (location.muxAddress == DISPLAY_NO_MUX) {
+        Serial.printf("[Display] ❌ Aucun écran détecté à l'adresse 0x%02X\n", states[i].address);
+      } else {
+        Serial.printf("[Display] ❌ Aucun écran détecté à l'adresse 0x%02X (mux 0x%02X, canal %u)\n",
+                      states[i].address, location.muxAddress, static_cast<unsigned>(location.muxChannel));
+      }
       states[i].ready = false;
       continue;
     }
@@ -112,9 +296,13 @@ void initDisplay() {
     states[i].ready = true;
     Serial.printf("[Display] ✅ Écran #%u initialisé (0x%02X)\n", static_cast<unsigned>(i), states[i].address);
   }
+
+#if defined(ESP_PLATFORM)
+  startDisplayTask();
+#endif
 }
 
-void updateDisplay(size_t index, const String &text) {
+void updateDisplay(size_t index, const char *text, size_t length) {
   if (index >= CUE_COUNT) {
     return;
   }
@@ -125,7 +313,7 @@ void updateDisplay(size_t index, const String &text) {
     return;
   }
 
-  renderWrappedText(displays[index], sanitizeText(text));
+  postRender(index, sanitizeText(text, length));
 }
 
 bool isDisplayReady(size_t index) {
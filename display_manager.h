@@ -3,6 +3,7 @@
 #include <Arduino.h>
 
 void initDisplay();
-void updateDisplay(size_t index, const String &text);
+// Le texte est copié : `text` n'a pas à rester valide après l'appel.
+void updateDisplay(size_t index, const char *text, size_t length);
 bool isDisplayReady(size_t index);
 
@@ -0,0 +1,184 @@
+#include "dmx_input.h"
+
+#include <AsyncUDP.h>
+#include <WiFi.h>
+
+#include "config.h"
+#include "cues.h"
+#include "dmx_protocol.h"
+#include "latency_metrics.h"
+
+namespace {
+
+constexpr size_t kWordCount = DMX_UNIVERSE_SIZE / 4;
+
+AsyncUDP udp;
+bool listening = false;
+uint32_t lastAttemptMs = 0;
+bool attempted = false;
+
+// État propre à la tâche AsyncUDP, qui traite les trames une par une.
+DmxSourceArbiter<DMX_MAX_SOURCES> arbiter;
+uint32_t previousWords[kWordCount] = {0};
+uint32_t mappedWords[kWordCount / 32] = {0};  // Mots de 4 canaux contenant au moins un canal associé.
+bool channelAbove[CUE_COUNT] = {false};
+bool primed = false;
+
+bool isMapped(size_t index) {
+  return dmxCueMappings[index].channel >= 1 && dmxCueMappings[index].channel <= DMX_UNIVERSE_SIZE;
+}
+
+size_t wordOf(size_t index) {
+  return (dmxCueMappings[index].channel - 1) / 4;
+}
+
+void buildMappedWords() {
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (isMapped(i)) {
+      mappedWords[wordOf(i) / 32] |= 1UL << (wordOf(i) % 32);
+    }
+  }
+}
+
+// Quatre canaux consécutifs lus d'un bloc ; les canaux absents d'une trame courte valent 0.
+uint32_t loadWord(const DmxFrame &frame, size_t word) {
+  uint32_t value = 0;
+  const size_t offset = word * 4;
+  if (offset + 4 <= frame.slotCount) {
+    memcpy(&value, frame.slots + offset, sizeof(value));
+  } else if (offset < frame.slotCount) {
+    memcpy(&value, frame.slots + offset, frame.slotCount - offset);
+  }
+  return value;
+}
+
+// Un fondu qui oscille autour du seuil ne redéclenche pas le cue.
+bool crossesAbove(size_t index, uint8_t level) {
+  return dmxLevelAbove(channelAbove[index], level, dmxCueMappings[index].threshold, DMX_THRESHOLD_HYSTERESIS);
+}
+
+// Première trame : les cues Hold prennent l'état du canal, les cues Trigger ne partent pas sur
+// un niveau déjà haut (seul un franchissement observé déclenche).
+void evaluateCue(size_t index, uint8_t level, CueOperation *operations, size_t &count, uint32_t receivedAtUs) {
+  const bool above = crossesAbove(index, level);
+  if (above == channelAbove[index]) {
+    return;
+  }
+  channelAbove[index] = above;
+
+  const DmxCueMapping &mapping = dmxCueMappings[index];
+  if (mapping.mode == DmxCueMode::Hold && !above) {
+    releaseCue(index);
+    return;
+  }
+  if (!above || (!primed && mapping.mode == DmxCueMode::Trigger)) {
+    return;
+  }
+  beginTriggerTrace(index, TriggerSource::Dmx, receivedAtUs);
+  const uint32_t durationMs = mapping.mode == DmxCueMode::Hold ? DMX_HOLD_MAX_DURATION_MS : 0;
+  operations[count++] = CueOperation{index, nullptr, 0, false, true, durationMs};
+}
+
+// Comparaison mot à mot avec la trame précédente : une trame inchangée (le cas courant à 44 Hz)
+// coûte 128 comparaisons, et seuls les canaux associés des mots modifiés sont évalués.
+void applyFrame(const DmxFrame &frame, uint32_t receivedAtUs) {
+  CueOperation operations[CUE_COUNT];
+  size_t count = 0;
+
+  for (size_t word = 0; word < kWordCount; ++word) {
+    const uint32_t current = loadWord(frame, word);
+    if (current == previousWords[word] && primed) {
+      continue;
+    }
+    previousWords[word] = current;
+    if ((mappedWords[word / 32] & (1UL << (word % 32))) == 0) {
+      continue;
+    }
+    for (size_t i = 0; i < CUE_COUNT; ++i) {
+      if (!isMapped(i) || wordOf(i) != word) {
+        continue;
+      }
+      const size_t channel = dmxCueMappings[i].channel;
+      const uint8_t level = channel <= frame.slotCount ? frame.slots[channel - 1] : 0;
+      evaluateCue(i, level, operations, count, receivedAtUs);
+    }
+  }
+  primed = true;
+
+  if (count > 0) {
+    applyCueBatch(operations, count);
+  }
+}
+
+void handlePacket(AsyncUDPPacket &packet) {
+  const uint32_t receivedAtUs = latencyTimestampUs();
+  DmxFrame frame;
+  if (DMX_INPUT_PROTOCOL == DmxInputProtocol::Sacn) {
+    if (!decodeSacnFrame(packet.data(), packet.length(), frame)) {
+      return;
+    }
+  } else {
+    if (!decodeArtNetFrame(packet.data(), packet.length(), frame)) {
+      return;
+    }
+    const IPAddress remote = packet.remoteIP();
+    for (size_t i = 0; i < 4; ++i) {
+      frame.source[i] = remote[i];
+    }
+  }
+
+  if (frame.universe != DMX_UNIVERSE || !arbiter.accept(frame, millis())) {
+    return;
+  }
+  applyFrame(frame, receivedAtUs);
+}
+
+bool openSocket() {
+  if (DMX_INPUT_PROTOCOL == DmxInputProtocol::ArtNet) {
+    return udp.listen(ARTNET_PORT);
+  }
+  // Adresse multicast de l'univers : 239.255.<octet fort>.<octet faible> (E1.31 §9.3.1).
+  const IPAddress group(239, 255, static_cast<uint8_t>(DMX_UNIVERSE >> 8), static_cast<uint8_t>(DMX_UNIVERSE & 0xFF));
+  return udp.listenMulticast(group, SACN_PORT);
+}
+
+void startListening() {
+  if (!openSocket()) {
+    Serial.println("[DMX] ⚠️ Impossible d'ouvrir le port DMX, nouvel essai plus tard");
+    return;
+  }
+  udp.onPacket(handlePacket);
+  listening = true;
+  Serial.printf("[DMX] 💡 Écoute %s, univers %u\n",
+                DMX_INPUT_PROTOCOL == DmxInputProtocol::Sacn ? "sACN" : "Art-Net",
+                static_cast<unsigned>(DMX_UNIVERSE));
+}
+
+}  // namespace
+
+void serviceDmxInput() {
+  if (DMX_INPUT_PROTOCOL == DmxInputProtocol::Disabled) {
+    return;
+  }
+
+  const bool connected = WiFi.status() == WL_CONNECTED;
+  if (listening) {
+    if (!connected) {
+      udp.close();
+      listening = false;
+      Serial.println("[DMX] ℹ️ Wi-Fi perdu, entrée DMX suspendue");
+    }
+    return;
+  }
+
+  const uint32_t now = millis();
+  if (!connected || (attempted && now - lastAttemptMs < UDP_LISTEN_RETRY_INTERVAL_MS)) {
+    return;
+  }
+  if (!attempted) {
+    buildMappedWords();
+  }
+  attempted = true;
+  lastAttemptMs = now;
+  startListening();
+}
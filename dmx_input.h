@@ -0,0 +1,7 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Écoute l'univers DMX_UNIVERSE (sACN ou Art-Net) dès que la station Wi-Fi est connectée
+// (appelé depuis loop()). Les trames sont traitées dans la tâche AsyncUDP.
+void serviceDmxInput();
@@ -0,0 +1,102 @@
+#include "dmx_protocol.h"
+
+namespace {
+
+// sACN : couche racine (ACN), couche de trame E1.31 puis couche DMP (ANSI E1.31-2016 §4-7).
+constexpr uint8_t kAcnPacketIdentifier[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+constexpr uint32_t kVectorRootData = 0x00000004;
+constexpr uint32_t kVectorFramingData = 0x00000002;
+constexpr uint8_t kVectorDmpSetProperty = 0x02;
+constexpr uint8_t kDmpAddressDataType = 0xA1;
+constexpr uint8_t kOptionPreview = 0x80;
+constexpr uint8_t kOptionStreamTerminated = 0x40;
+constexpr size_t kSacnRootVector = 18;
+constexpr size_t kSacnCid = 22;
+constexpr size_t kSacnFramingVector = 40;
+constexpr size_t kSacnPriority = 108;
+constexpr size_t kSacnSequence = 111;
+constexpr size_t kSacnOptions = 112;
+constexpr size_t kSacnUniverse = 113;
+constexpr size_t kSacnDmpVector = 117;
+constexpr size_t kSacnAddressType = 118;
+constexpr size_t kSacnPropertyCount = 123;
+constexpr size_t kSacnStartCode = 125;
+constexpr size_t kSacnHeaderSize = 126;
+
+// Art-Net 4 : paquet OpDmx.
+constexpr uint8_t kArtNetId[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0};
+constexpr uint16_t kArtNetOpDmx = 0x5000;
+constexpr uint16_t kArtNetMinProtocol = 14;
+constexpr size_t kArtNetHeaderSize = 18;
+
+constexpr uint8_t kNullStartCode = 0x00;
+
+uint16_t readBigEndian16(const uint8_t *in) {
+  return static_cast<uint16_t>(in[0] << 8 | in[1]);
+}
+
+uint32_t readBigEndian32(const uint8_t *in) {
+  return static_cast<uint32_t>(in[0]) << 24 | static_cast<uint32_t>(in[1]) << 16 |
+         static_cast<uint32_t>(in[2]) << 8 | in[3];
+}
+
+}  // namespace
+
+bool decodeSacnFrame(const uint8_t *data, size_t length, DmxFrame &frame) {
+  if (data == nullptr || length < kSacnHeaderSize) {
+    return false;
+  }
+  if (readBigEndian16(data) != 0x0010 || readBigEndian16(data + 2) != 0 ||
+      memcmp(data + 4, kAcnPacketIdentifier, sizeof(kAcnPacketIdentifier)) != 0) {
+    return false;
+  }
+  if (readBigEndian32(data + kSacnRootVector) != kVectorRootData ||
+      readBigEndian32(data + kSacnFramingVector) != kVectorFramingData ||
+      data[kSacnDmpVector] != kVectorDmpSetProperty || data[kSacnAddressType] != kDmpAddressDataType) {
+    return false;
+  }
+
+  const uint8_t options = data[kSacnOptions];
+  const size_t propertyCount = readBigEndian16(data + kSacnPropertyCount);
+  if ((options & kOptionPreview) != 0 || propertyCount == 0 || propertyCount > DMX_UNIVERSE_SIZE + 1 ||
+      kSacnStartCode + propertyCount != length) {
+    return false;
+  }
+  // Le code de départ 0xDD (priorité par canal) et les autres codes alternatifs sont ignorés.
+  if (data[kSacnStartCode] != kNullStartCode && (options & kOptionStreamTerminated) == 0) {
+    return false;
+  }
+
+  frame.universe = readBigEndian16(data + kSacnUniverse);
+  frame.sequence = data[kSacnSequence];
+  frame.priority = data[kSacnPriority] <= 200 ? data[kSacnPriority] : 200;
+  frame.streamTerminated = (options & kOptionStreamTerminated) != 0;
+  memcpy(frame.source, data + kSacnCid, sizeof(frame.source));
+  frame.slots = data + kSacnHeaderSize;
+  frame.slotCount = propertyCount - 1;
+  return true;
+}
+
+bool decodeArtNetFrame(const uint8_t *data, size_t length, DmxFrame &frame) {
+  if (data == nullptr || length < kArtNetHeaderSize || memcmp(data, kArtNetId, sizeof(kArtNetId)) != 0) {
+    return false;
+  }
+  const uint16_t opcode = static_cast<uint16_t>(data[8] | data[9] << 8);
+  if (opcode != kArtNetOpDmx || readBigEndian16(data + 10) < kArtNetMinProtocol) {
+    return false;
+  }
+  const size_t slotCount = readBigEndian16(data + 16);
+  if (slotCount < 2 || slotCount > DMX_UNIVERSE_SIZE || kArtNetHeaderSize + slotCount > length) {
+    return false;
+  }
+
+  frame.universe = static_cast<uint16_t>((data[15] & 0x7F) << 8 | data[14]);
+  frame.sequence = data[12];
+  frame.priority = DMX_DEFAULT_PRIORITY;
+  frame.streamTerminated = false;
+  // L'identité Art-Net (adresse de l'émetteur) est renseignée par l'appelant.
+  memset(frame.source, 0, sizeof(frame.source));
+  frame.slots = data + kArtNetHeaderSize;
+  frame.slotCount = slotCount;
+  return true;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Réception DMX sur IP : sACN (ANSI E1.31) et Art-Net (ArtDmx).
+// -----------------------------------------------------------------------------
+// Seules les trames de données d'un univers sont décodées ; les niveaux rendus pointent
+// directement dans le datagramme reçu (aucune copie).
+
+constexpr uint16_t SACN_PORT = 5568;
+constexpr uint16_t ARTNET_PORT = 6454;
+constexpr size_t DMX_UNIVERSE_SIZE = 512;
+// Priorité sACN par défaut, attribuée aussi à Art-Net qui n'en transporte pas.
+constexpr uint8_t DMX_DEFAULT_PRIORITY = 100;
+// Délai de perte d'une source (E1.31 §6.7.1, "network data loss").
+constexpr uint32_t DMX_SOURCE_TIMEOUT_MS = 2500;
+
+struct DmxFrame {
+  uint16_t universe = 0;
+  uint8_t sequence = 0;  // Art-Net : 0 = séquence désactivée par l'émetteur.
+  uint8_t priority = DMX_DEFAULT_PRIORITY;
+  bool streamTerminated = false;  // sACN : la source annonce son arrêt.
+  uint8_t source[16] = {};        // CID sACN, ou adresse IPv4 de l'émetteur Art-Net.
+  const uint8_t *slots = nullptr;  // Niveaux des canaux 1..slotCount.
+  size_t slotCount = 0;
+};
+
+// Retournent false pour tout autre paquet (autre opcode ou vecteur, trame de prévisualisation,
+// code de départ non nul, longueurs incohérentes).
+bool decodeSacnFrame(const uint8_t *data, size_t length, DmxFrame &frame);
+bool decodeArtNetFrame(const uint8_t *data, size_t length, DmxFrame &frame);
+
+// Seuil avec hystérésis : le canal passe au-dessus à `threshold` et ne redescend que sous
+// `threshold - hysteresis`, ou à 0 si le seuil est inférieur à l'hystérésis (seuil > 0 requis).
+constexpr bool dmxLevelAbove(bool wasAbove, uint8_t level, uint8_t threshold, uint8_t hysteresis) {
+  return wasAbove ? level > (threshold > hysteresis ? threshold - hysteresis : 0) : level >= threshold;
+}
+
+// Arbitrage entre émetteurs d'un même univers : la source de plus haute priorité encore active
+// l'emporte (E1.31 §6.2.3) ; à priorité égale, la source en place la conserve plutôt que de
+// fusionner les niveaux. Les trames hors séquence d'une source sont écartées (E1.31 §6.7.2 :
+// écart signé dans ]-20, 0]). Aucune horloge : l'appelant fournit l'instant courant (ms).
+template <size_t Sources>
+class DmxSourceArbiter {
+  static_assert(Sources > 0, "Au moins une source");
+
+ public:
+  // true si la trame doit être appliquée.
+  bool accept(const DmxFrame &frame, uint32_t nowMs) {
+    Source *source = find(frame.source);
+    if (frame.streamTerminated) {
+      if (source != nullptr) {
+        source->used = false;
+      }
+      return false;
+    }
+
+    if (source == nullptr) {
+      source = allocate(nowMs);
+      memcpy(source->id, frame.source, sizeof(source->id));
+      source->used = true;
+    } else if (frame.sequence != 0 && source->sequence != 0) {
+      const int8_t delta = static_cast<int8_t>(frame.sequence - source->sequence);
+      if (delta <= 0 && delta > -20) {
+        return false;
+      }
+    }
+    source->sequence = frame.sequence;
+    source->priority = frame.priority;
+    source->lastSeenMs = nowMs;
+
+    const Source *owner = active(nowMs);
+    if (owner != nullptr && owner != source && owner->priority >= frame.priority) {
+      return false;
+    }
+    activeSource = static_cast<size_t>(source - sources);
+    return true;
+  }
+
+ private:
+  struct Source {
+    bool used;
+    uint8_t id[16];
+    uint8_t sequence;
+    uint8_t priority;
+    uint32_t lastSeenMs;
+  };
+
+  bool expired(const Source &source, uint32_t nowMs) const {
+    return !source.used || nowMs - source.lastSeenMs > DMX_SOURCE_TIMEOUT_MS;
+  }
+
+  Source *find(const uint8_t *id) {
+    for (Source &source : sources) {
+      if (source.used && memcmp(source.id, id, sizeof(source.id)) == 0) {
+        return &source;
+      }
+    }
+    return nullptr;
+  }
+
+  // Emplacement libre ou expiré, sinon celui entendu le moins récemment.
+  Source *allocate(uint32_t nowMs) {
+    Source *oldest = &sources[0];
+    for (Source &source : sources) {
+      if (expired(source, nowMs)) {
+        source = Source();
+        return &source;
+      }
+      if (source.lastSeenMs - oldest->lastSeenMs > 0x7FFFFFFFUL) {
+        oldest = &source;
+      }
+    }
+    *oldest = Source();
+    return oldest;
+  }
+
+  const Source *active(uint32_t nowMs) const {
+    if (activeSource >= Sources || expired(sources[activeSource], nowMs)) {
+      return nullptr;
+    }
+    return &sources[activeSource];
+  }
+
+  Source sources[Sources] = {};
+  size_t activeSource = Sources;
+};
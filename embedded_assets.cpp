@@ -0,0 +1,596 @@
+// Généré par tools/build_assets.py --embed à partir de data/ : ne pas modifier à la main.
+#include "embedded_assets.h"
+
+namespace {
+
+// /app.a1c87db49a.js (4790 octets compressés)
+constexpr uint8_t kAsset0[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3b, 0xcb, 0x6e, 0xe3, 0x48,
+    0x92, 0xf7, 0xfa, 0x8a, 0x6c, 0xa0, 0xd0, 0xa4, 0xb6, 0x25, 0x5a, 0x76, 0x75, 0x63, 0x1a, 0x76,
+    0xbb, 0x0b, 0x7e, 0xa8, 0xaa, 0xdc, 0xe3, 0xb2, 0x0c, 0x4b, 0xd5, 0xdb, 0x05, 0xc3, 0xb0, 0x69,
+    0x31, 0x65, 0xb1, 0x9b, 0x22, 0x55, 0x4c, 0xd2, 0xb2, 0xc7, 0x2d, 0x60, 0x4f, 0x03, 0xcc, 0x75,
+    0xbe, 0x60, 0x4e, 0x8b, 0xf5, 0x9c, 0xe7, 0x0f, 0xfc, 0x27, 0xf3, 0x25, 0x1b, 0x11, 0xf9, 0x60,
+    0x26, 0x45, 0xa9, 0x5c, 0xb3, 0x0b, 0x2c, 0xf6, 0x22, 0x89, 0xc9, 0xc8, 0xc8, 0xc8, 0x78, 0x47,
+    0x64, 0x6a, 0x94, 0xa5, 0xa2, 0x60, 0xc3, 0xfe, 0x1f, 0x7b, 0x27, 0x97, 0x83, 0x61, 0xff, 0x6c,
+    0xef, 0x6d, 0xef, 0xf2, 0x8f, 0xbd, 0x8f, 0x6c, 0x97, 0x79, 0xa2, 0x08, 0x6f, 0xf8, 0xa8, 0xe4,
+    0x9d, 0x22, 0xfb, 0x8d, 0xa7, 0xde, 0xce, 0x8b, 0x11, 0xc1, 0x1e, 0xf6, 0xde, 0xec, 0x7d, 0x38,
+    0x1e, 0x5e, 0xd2, 0x1c, 0x07, 0x2e, 0x8c, 0xa6, 0x71, 0x05, 0xf7, 0x7e, 0xef, 0x97, 0xcb, 0xe3,
+    0xfe, 0xdb, 0xcb, 0xde, 0xc9, 0xf0, 0xec, 0xa8, 0x37, 0x00, 0xc8, 0xef, 0xba, 0xfa, 0xdd, 0xe9,
+    0x59, 0x7f, 0xd8, 0x3f, 0xe8, 0x1f, 0xaf, 0x5c, 0x72, 0x96, 0x67, 0x45, 0x36, 0xca, 0x12, 0xc0,
+    0xf6, 0x62, 0x63, 0x83, 0x9d, 0xaa, 0x47, 0xce, 0xfe, 0x9d, 0x5f, 0x0f, 0xb2, 0xd1, 0x6f, 0xbc,
+    0x60, 0xd7, 0x71, 0x1a, 0xc6, 0x39, 0x67, 0xfe, 0x6d, 0x16, 0xe7, 0xf4, 0x94, 0xdf, 0x5f, 0xea,
+    0x79, 0xc1, 0x84, 0x8d, 0x9e, 0xfe, 0x51, 0x3c, 0x3d, 0xb2, 0x71, 0x9c, 0x4f, 0xe7, 0x61, 0xce,
+    0x5b, 0x81, 0x5a, 0x7b, 0x9f, 0x20, 0xfb, 0xb3, 0x51, 0x16, 0x71, 0x58, 0xb3, 0x7f, 0xfd, 0x2b,
+    0x1f, 0x15, 0xc1, 0x38, 0xe7, 0xfc, 0x4f, 0xdc, 0x7f, 0x78, 0xc1, 0x18, 0x90, 0xfb, 0xf6, 0x6d,
+    0xef, 0x6c, 0x9b, 0x75, 0xef, 0xba, 0x9b, 0x6d, 0x18, 0x18, 0xf4, 0x60, 0xb7, 0xbd, 0x5f, 0x86,
+    0x34, 0xb2, 0x85, 0x23, 0xa7, 0x47, 0x27, 0x6f, 0xe9, 0xe9, 0x15, 0x3d, 0xf5, 0xd5, 0xd3, 0xb7,
+    0xf8, 0x74, 0xf0, 0xa1, 0x07, 0xdb, 0xda, 0x1b, 0xf6, 0x70, 0x68, 0xb3, 0x4b, 0x08, 0x4e, 0xf6,
+    0x4e, 0x07, 0xef, 0xfa, 0x84, 0x60, 0x93, 0x50, 0xee, 0xef, 0x0d, 0x0f, 0xde, 0xd1, 0x23, 0xe1,
+    0x3b, 0xec, 0x1d, 0x0f, 0xf7, 0xe8, 0x91, 0x10, 0xf6, 0xce, 0xce, 0xfa, 0xb4, 0xfe, 0x1f, 0xc6,
+    0xed, 0x17, 0x8b, 0x96, 0xe6, 0xda, 0xfe, 0xd1, 0xc9, 0xde, 0xd9, 0xc7, 0xcb, 0x37, 0xc7, 0x7b,
+    0x6f, 0x2f, 0x4f, 0x7b, 0x67, 0x83, 0xa3, 0xc1, 0x10, 0x36, 0x80, 0x54, 0x36, 0x41, 0xbc, 0xdb,
+    0x1b, 0x10, 0xd5, 0x12, 0x64, 0xab, 0x09, 0x64, 0xef, 0x60, 0x78, 0xf4, 0x73, 0x6f, 0x0d, 0x8e,
+    0xc3, 0xa3, 0xc1, 0xe9, 0xf1, 0xde, 0xc7, 0xcb, 0xb3, 0xde, 0xde, 0xe1, 0xc7, 0x66, 0x44, 0x44,
+    0x2b, 0x4a, 0xf7, 0x81, 0x6d, 0x6e, 0x33, 0x2f, 0x4e, 0x6f, 0xc3, 0x24, 0x8e, 0x2e, 0xc7, 0x79,
+    0x38, 0xe5, 0x5e, 0x9b, 0x6d, 0x59, 0x63, 0x20, 0x58, 0x8f, 0x2d, 0x6c, 0xfd, 0x50, 0x38, 0x90,
+    0xcc, 0xcb, 0xfd, 0x8f, 0x43, 0xd2, 0x92, 0xee, 0xdd, 0x78, 0x0c, 0x52, 0x97, 0x40, 0x05, 0xbf,
+    0x2b, 0x7a, 0x29, 0x8a, 0x2a, 0x87, 0x57, 0x29, 0x9f, 0xb3, 0x61, 0x35, 0xe2, 0x1b, 0xce, 0x20,
+    0xd8, 0x21, 0xaf, 0x83, 0xa9, 0x11, 0x04, 0x7b, 0x31, 0x2e, 0xd3, 0x51, 0x11, 0x67, 0x29, 0xcb,
+    0xb9, 0xc8, 0x92, 0x5b, 0xae, 0x35, 0xca, 0x6f, 0x31, 0x94, 0xb9, 0x44, 0x93, 0xf3, 0x4f, 0x25,
+    0x17, 0x05, 0x8f, 0x14, 0x92, 0x0f, 0x67, 0xc7, 0x03, 0x1e, 0xe6, 0xa3, 0xc9, 0x69, 0x08, 0xdb,
+    0x11, 0xfe, 0x3c, 0x4e, 0xa3, 0x6c, 0x1e, 0x24, 0xd9, 0x28, 0x44, 0x5c, 0x81, 0xa0, 0x97, 0xad,
+    0xe0, 0x86, 0x17, 0xbe, 0x47, 0xaa, 0xe7, 0xc1, 0x5a, 0x8c, 0xc5, 0x63, 0xe6, 0x1b, 0x5c, 0x72,
+    0x01, 0xc6, 0x70, 0x56, 0x32, 0x28, 0xb2, 0x1c, 0x54, 0x1c, 0x66, 0x16, 0x47, 0x05, 0x9f, 0xfa,
+    0x4d, 0x86, 0xd0, 0xae, 0xe8, 0x20, 0x6c, 0x0c, 0x9e, 0x8b, 0x32, 0x4f, 0xab, 0x61, 0x1c, 0x5d,
+    0xbc, 0x30, 0xe3, 0x0e, 0xe6, 0x9b, 0x35, 0x98, 0x5b, 0xec, 0xf7, 0xdf, 0x99, 0xf7, 0xab, 0xc8,
+    0xd0, 0x4a, 0x17, 0x9a, 0xc7, 0x60, 0x74, 0x05, 0x5a, 0x02, 0x92, 0x49, 0xa6, 0xbe, 0xdd, 0x8c,
+    0x71, 0xc9, 0x49, 0x10, 0x3a, 0xc7, 0x1d, 0xa0, 0xf2, 0x4a, 0x4b, 0xdc, 0x6e, 0x60, 0xf4, 0xee,
+    0x2e, 0x98, 0x38, 0xbc, 0xf6, 0x10, 0x6c, 0x2e, 0xb6, 0x59, 0x5a, 0x26, 0x49, 0x9b, 0xf6, 0x01,
+    0x94, 0xa4, 0x60, 0x86, 0xc3, 0x78, 0xca, 0xf3, 0x86, 0xf1, 0x43, 0x9e, 0x84, 0x80, 0x72, 0xab,
+    0xdb, 0x25, 0x7b, 0xe2, 0x77, 0x33, 0x18, 0x8c, 0xd3, 0x9b, 0x83, 0x24, 0x13, 0x7c, 0x9b, 0x8d,
+    0xc3, 0x44, 0x70, 0x7c, 0x91, 0x84, 0xa2, 0x18, 0xf0, 0x4f, 0x15, 0x06, 0x3e, 0xcb, 0x46, 0x93,
+    0xea, 0x11, 0x34, 0x10, 0x97, 0x05, 0xd1, 0xbe, 0x0f, 0x67, 0x7e, 0x0b, 0x8c, 0xcb, 0x68, 0x9a,
+    0x5a, 0x09, 0xc4, 0x7a, 0x94, 0x46, 0x31, 0x08, 0x38, 0x43, 0x55, 0x8a, 0xb2, 0x51, 0x39, 0xe5,
+    0x69, 0x81, 0x4c, 0xe8, 0x25, 0x1c, 0x7f, 0xee, 0xdf, 0x1f, 0x45, 0xbe, 0xd7, 0x00, 0xee, 0x19,
+    0x75, 0xac, 0x5e, 0x1e, 0x87, 0xd7, 0x3c, 0x79, 0x1e, 0x1e, 0x02, 0x6d, 0xc2, 0x71, 0xc8, 0x8b,
+    0x30, 0x4e, 0xc4, 0xf3, 0xb0, 0x28, 0xe0, 0x0a, 0x0f, 0x49, 0xf4, 0x4d, 0x96, 0x4f, 0xd7, 0xcd,
+    0x37, 0x40, 0xb5, 0x79, 0x47, 0xe9, 0xac, 0x2c, 0x3e, 0x3b, 0x91, 0xa0, 0x2c, 0xca, 0x4b, 0xfe,
+    0x36, 0x8f, 0xa3, 0xb5, 0xf4, 0x4a, 0x10, 0x67, 0xce, 0x90, 0x4f, 0x67, 0x89, 0xd4, 0xc4, 0x75,
+    0xf3, 0x34, 0x18, 0xce, 0x85, 0xc8, 0x70, 0xcc, 0x05, 0x1b, 0x85, 0x79, 0x01, 0x5f, 0xa0, 0xd6,
+    0x80, 0x28, 0x7f, 0x7a, 0x7c, 0x7a, 0x84, 0xa7, 0xa7, 0xbf, 0x81, 0x36, 0xb0, 0x88, 0x4f, 0xc3,
+    0x14, 0xfc, 0x3c, 0xa8, 0x34, 0x67, 0x69, 0x36, 0xbd, 0x86, 0x80, 0x01, 0x8f, 0xa8, 0x07, 0x2c,
+    0x7a, 0x7a, 0x9c, 0xf1, 0x34, 0xc2, 0x67, 0x80, 0x04, 0x3a, 0xc6, 0xf1, 0x4d, 0x99, 0x93, 0x65,
+    0xb3, 0xa8, 0x34, 0x81, 0x23, 0xa8, 0x48, 0x3c, 0x08, 0xf3, 0x08, 0xe5, 0x70, 0x7e, 0xa1, 0xe9,
+    0x4e, 0xb2, 0x9b, 0xe3, 0x58, 0xac, 0x65, 0x11, 0xbf, 0x85, 0x9f, 0xc7, 0xd9, 0x8d, 0xb5, 0xd9,
+    0x04, 0xfc, 0x06, 0x8c, 0xec, 0x97, 0x45, 0x01, 0x6b, 0xad, 0xdb, 0xaf, 0x82, 0x6c, 0x52, 0x8b,
+    0xd3, 0x30, 0x7d, 0xae, 0x6a, 0x11, 0xa8, 0xe7, 0xb8, 0xc1, 0x70, 0x36, 0x4b, 0xee, 0x87, 0x28,
+    0xbd, 0x61, 0x86, 0x82, 0x57, 0x7e, 0xb0, 0x92, 0x67, 0x00, 0x3e, 0xbb, 0x44, 0x61, 0x90, 0x7b,
+    0x08, 0xe8, 0x05, 0x39, 0x0d, 0x83, 0x02, 0x7c, 0xd8, 0x81, 0x59, 0x62, 0x80, 0x50, 0x3e, 0xc2,
+    0x96, 0xa2, 0x0d, 0x2c, 0x25, 0x2d, 0x6c, 0xb3, 0x58, 0x1b, 0xc7, 0x01, 0x98, 0xa6, 0x30, 0xbe,
+    0xd6, 0xa6, 0x2b, 0x88, 0xc2, 0x22, 0x04, 0x5c, 0x81, 0x9c, 0xac, 0x56, 0x2c, 0xc5, 0x8e, 0x03,
+    0x6a, 0xac, 0x2c, 0x18, 0x21, 0xa6, 0x13, 0x88, 0x2e, 0x00, 0x79, 0x25, 0x41, 0x3b, 0x66, 0x19,
+    0xf6, 0xf2, 0xc1, 0x5d, 0x72, 0x71, 0xe5, 0xe2, 0x21, 0x2b, 0x0b, 0x30, 0x5e, 0x00, 0xed, 0x05,
+    0xf0, 0x6a, 0xc5, 0x7a, 0xca, 0x8e, 0x6a, 0x90, 0x6a, 0x5f, 0x2e, 0x1f, 0xc6, 0xbc, 0x18, 0x4d,
+    0xfa, 0x33, 0xfc, 0x2d, 0xfc, 0x4c, 0x7e, 0xa3, 0x3b, 0x5d, 0xd8, 0xa1, 0x65, 0xc2, 0x43, 0x08,
+    0x45, 0x42, 0x05, 0x96, 0x77, 0xf2, 0x49, 0x43, 0x07, 0xfa, 0x2d, 0xf8, 0xd3, 0x87, 0x85, 0x09,
+    0x21, 0x16, 0xe7, 0x75, 0x10, 0x51, 0x80, 0x18, 0x3f, 0x7c, 0xef, 0x97, 0xce, 0x00, 0xf3, 0xa5,
+    0x03, 0xc8, 0x97, 0x48, 0x92, 0x10, 0x6e, 0xed, 0x29, 0xb5, 0x28, 0xf1, 0xc0, 0x82, 0x20, 0x50,
+    0x0b, 0xb6, 0x0d, 0x3d, 0x0b, 0xda, 0x4b, 0x28, 0xee, 0xd3, 0x11, 0x73, 0x77, 0xf4, 0x13, 0xd8,
+    0x93, 0x5f, 0xe6, 0x49, 0x9b, 0xa9, 0x49, 0x6e, 0xa4, 0x14, 0x33, 0xf8, 0x81, 0x32, 0x08, 0xe7,
+    0x61, 0x5c, 0xc8, 0x29, 0x12, 0xbc, 0x89, 0x1f, 0x2d, 0xb3, 0xa9, 0xaf, 0xf4, 0xd4, 0x20, 0xfb,
+    0x4d, 0xef, 0xaa, 0x0a, 0xe2, 0x06, 0x9f, 0x81, 0xc2, 0x51, 0x5f, 0xc5, 0xc1, 0x62, 0x92, 0x67,
+    0x73, 0x62, 0x60, 0x2f, 0xcf, 0xb3, 0xdc, 0xbf, 0x7a, 0x37, 0x1c, 0x9e, 0x82, 0xc8, 0x0d, 0xb0,
+    0x94, 0xe4, 0x62, 0x1b, 0xc6, 0x70, 0xde, 0xe2, 0xca, 0x30, 0xc1, 0x58, 0x0f, 0x4a, 0x72, 0x78,
+    0x3f, 0x43, 0xca, 0xcd, 0x34, 0xcd, 0x55, 0x8a, 0xe3, 0x0a, 0xa6, 0x53, 0x00, 0x90, 0x27, 0x23,
+    0xa6, 0xa7, 0x89, 0xb7, 0xe6, 0x07, 0x71, 0x3a, 0x4a, 0xca, 0x88, 0x0b, 0xdf, 0x43, 0x5b, 0x8a,
+    0x65, 0x4a, 0xb0, 0x41, 0xc1, 0xb5, 0xa5, 0x37, 0x66, 0x02, 0xb7, 0x5a, 0x08, 0xdf, 0xfa, 0x75,
+    0xc1, 0x2c, 0x6d, 0xd5, 0x56, 0x2e, 0x70, 0x30, 0x3d, 0x74, 0x20, 0xfe, 0x94, 0x0b, 0x01, 0xc2,
+    0x6e, 0xb3, 0x42, 0x12, 0x0f, 0x59, 0xd5, 0x18, 0xd2, 0x0d, 0x4b, 0x26, 0x00, 0x95, 0xdf, 0xdb,
+    0x0e, 0x61, 0x94, 0x73, 0xd0, 0x06, 0xe5, 0x13, 0x7c, 0x2f, 0x89, 0x65, 0x76, 0x42, 0x70, 0xae,
+    0x19, 0xc1, 0x2a, 0x1d, 0x39, 0xdd, 0xfc, 0xea, 0x74, 0x80, 0x87, 0xb0, 0x94, 0x34, 0x20, 0x39,
+    0xc7, 0x35, 0x86, 0xab, 0xf3, 0x97, 0x0f, 0x28, 0x8b, 0x43, 0xb4, 0xfc, 0x16, 0x28, 0xdd, 0x31,
+    0x66, 0x0d, 0x1c, 0x63, 0xf8, 0xa0, 0xc8, 0x21, 0x3a, 0xfb, 0xad, 0xc5, 0x05, 0x48, 0x42, 0x51,
+    0x2e, 0x11, 0x29, 0x87, 0x19, 0xcc, 0x72, 0x8e, 0xce, 0xd7, 0x27, 0xc4, 0x44, 0xd6, 0x7c, 0x12,
+    0x83, 0x8f, 0xf6, 0x35, 0xc0, 0x08, 0x1e, 0xa3, 0x9c, 0xa7, 0x41, 0xc2, 0xd3, 0x9b, 0x62, 0xc2,
+    0x7e, 0xac, 0x17, 0x14, 0x55, 0x5e, 0x25, 0x27, 0xe4, 0x7c, 0x9a, 0xdd, 0xf2, 0x03, 0x9c, 0x66,
+    0x90, 0x60, 0x3e, 0x40, 0x23, 0x8a, 0xe7, 0x36, 0x67, 0x25, 0x77, 0x0e, 0xa4, 0x57, 0xf7, 0xc1,
+    0x6b, 0xf0, 0x3b, 0x9b, 0x9b, 0x10, 0x54, 0x30, 0x84, 0x59, 0x11, 0x27, 0x50, 0xd2, 0x0f, 0x20,
+    0x32, 0x08, 0xed, 0x6a, 0x09, 0x3b, 0x30, 0x33, 0x4b, 0xf9, 0x09, 0x24, 0x9b, 0x7e, 0x91, 0x97,
+    0xbc, 0xb5, 0xf3, 0xc2, 0xd6, 0xe9, 0x3d, 0x58, 0x08, 0x31, 0x01, 0xc2, 0x00, 0x12, 0xb8, 0xfc,
+    0x7e, 0xc0, 0x13, 0x70, 0x32, 0xa0, 0xbf, 0x1e, 0xbe, 0x86, 0x10, 0x13, 0x7a, 0xd6, 0x94, 0x44,
+    0xa5, 0x0c, 0x4d, 0xf0, 0x89, 0xce, 0x11, 0x2a, 0xb7, 0x92, 0xcc, 0x56, 0xc0, 0x2a, 0x63, 0xe8,
+    0x44, 0x55, 0x46, 0x80, 0xd3, 0x10, 0x52, 0x7b, 0x5c, 0xda, 0x34, 0x4c, 0xa7, 0xef, 0x1d, 0xfd,
+    0xb6, 0x86, 0x67, 0xb2, 0xe5, 0xb5, 0xea, 0x92, 0x07, 0xae, 0x49, 0x4f, 0x0b, 0xd3, 0xbf, 0x61,
+    0x9b, 0x52, 0xb4, 0x7a, 0xaf, 0x01, 0xc5, 0xfe, 0x2b, 0x7c, 0x54, 0x30, 0xb5, 0xf7, 0xa9, 0xd2,
+    0xba, 0x25, 0x08, 0xda, 0x5e, 0x30, 0x29, 0xa6, 0xc9, 0x1b, 0xca, 0xbe, 0x2c, 0x8c, 0xf8, 0x1a,
+    0x37, 0xab, 0x90, 0xe3, 0xcf, 0x66, 0xe4, 0xb0, 0xaf, 0xbd, 0x02, 0xd4, 0xef, 0xba, 0x04, 0xad,
+    0xf4, 0xc2, 0x3c, 0x0e, 0x81, 0x03, 0x62, 0x04, 0x03, 0x3c, 0xba, 0xbe, 0xf7, 0xda, 0x1a, 0x0b,
+    0x31, 0x51, 0x59, 0x20, 0x6e, 0xdb, 0x35, 0x3b, 0x9e, 0x8a, 0x32, 0xd7, 0xca, 0x21, 0xc0, 0xee,
+    0xcb, 0xb4, 0x90, 0xda, 0xa1, 0xd4, 0x54, 0x67, 0x03, 0x5a, 0x3d, 0x7f, 0x60, 0x16, 0x4c, 0x5d,
+    0x87, 0x1c, 0x4d, 0xab, 0xcd, 0x54, 0xae, 0xcd, 0x8c, 0xce, 0x4a, 0x31, 0xf1, 0x71, 0x62, 0xf5,
+    0x02, 0x53, 0xa5, 0x00, 0x9c, 0x0c, 0xd8, 0x8b, 0x54, 0x6f, 0xf3, 0xda, 0xd5, 0xe8, 0x72, 0x16,
+    0xd5, 0x35, 0xba, 0x8d, 0xf3, 0x29, 0x36, 0x4b, 0xca, 0xc8, 0x03, 0x9f, 0x94, 0xd3, 0x6b, 0x9e,
+    0x07, 0xb1, 0x38, 0x02, 0x81, 0xde, 0x40, 0x81, 0xa4, 0x94, 0x1f, 0x5c, 0x9d, 0x14, 0xe9, 0x0f,
+    0xac, 0xdb, 0x52, 0xbc, 0x91, 0xc6, 0xef, 0x30, 0xc3, 0x88, 0xdd, 0xd2, 0xc3, 0xca, 0x5a, 0x08,
+    0xe6, 0x9c, 0x60, 0x2e, 0xa4, 0xc6, 0xfd, 0xab, 0x86, 0x20, 0xf5, 0xf7, 0x78, 0x8d, 0x39, 0x04,
+    0xd8, 0x2a, 0x90, 0x60, 0x4a, 0xbd, 0x71, 0x7f, 0xc6, 0xff, 0x85, 0xc0, 0x96, 0x5b, 0xed, 0xff,
+    0xd8, 0x57, 0xbb, 0x95, 0x42, 0x69, 0x31, 0x19, 0xad, 0xd1, 0xc9, 0x8e, 0xe6, 0x16, 0x29, 0x7c,
+    0xe5, 0xfb, 0x17, 0x1a, 0xb7, 0x79, 0x2f, 0x71, 0x1b, 0x71, 0x23, 0x71, 0xe4, 0x51, 0xc9, 0xed,
+    0x84, 0x91, 0xcc, 0x55, 0x3b, 0x1d, 0x09, 0xe6, 0x29, 0x59, 0x5a, 0x3b, 0xaa, 0x59, 0x94, 0xb7,
+    0x07, 0x80, 0x63, 0xb9, 0x16, 0xe3, 0x50, 0xcd, 0x34, 0x23, 0x96, 0x3e, 0xee, 0x4b, 0x71, 0x1f,
+    0xa5, 0x0a, 0xd4, 0x6c, 0xc5, 0xf1, 0x02, 0x51, 0x2c, 0xc0, 0xbf, 0xdd, 0x9f, 0x41, 0x10, 0xbc,
+    0xb7, 0x59, 0xe0, 0x8c, 0xbf, 0x66, 0x1e, 0xba, 0x36, 0x0f, 0x32, 0x69, 0x8f, 0xca, 0x2d, 0xcf,
+    0x35, 0x18, 0xa0, 0x8c, 0xa3, 0x56, 0x0d, 0x20, 0x91, 0x38, 0xcd, 0xe2, 0x2a, 0x60, 0x55, 0x7a,
+    0x87, 0xd1, 0x24, 0x1b, 0x33, 0x35, 0x0e, 0x86, 0xfa, 0x49, 0x56, 0x84, 0x29, 0xa9, 0xa3, 0xa7,
+    0x79, 0x29, 0x53, 0x18, 0x55, 0xc9, 0x01, 0x3d, 0x16, 0xbc, 0x0e, 0x9c, 0x0d, 0xd8, 0xa8, 0xd0,
+    0x5b, 0x83, 0x4f, 0xbd, 0x77, 0xe1, 0x97, 0x4d, 0x88, 0xd2, 0xe2, 0x41, 0x1a, 0xce, 0xc4, 0x24,
+    0x2b, 0x7c, 0xa1, 0x7e, 0x58, 0xb6, 0xa3, 0x87, 0x50, 0x37, 0xbe, 0xda, 0xcb, 0xf3, 0xf0, 0x1e,
+    0xec, 0x88, 0xbe, 0x0d, 0x34, 0x6a, 0x25, 0x24, 0x3c, 0x96, 0x01, 0x2d, 0x33, 0xc7, 0x60, 0xc6,
+    0xd7, 0xce, 0xc4, 0x60, 0x9c, 0xe5, 0xbd, 0x10, 0x72, 0x29, 0xd4, 0x35, 0xa8, 0x99, 0x7f, 0x74,
+    0xb6, 0x41, 0x10, 0x98, 0xfc, 0xc1, 0x8f, 0xa0, 0xb2, 0x70, 0xa5, 0x03, 0xae, 0x03, 0x68, 0x00,
+    0x59, 0xd4, 0xb2, 0x8b, 0x09, 0x14, 0x47, 0x09, 0x4e, 0xf8, 0x40, 0x33, 0xe5, 0x92, 0x66, 0xaf,
+    0xf0, 0x84, 0xdb, 0x54, 0x9c, 0x36, 0xe8, 0x24, 0x97, 0x4b, 0xf8, 0x39, 0x8e, 0x53, 0x0e, 0x45,
+    0x9c, 0xb5, 0xd3, 0xcf, 0x53, 0xf9, 0x59, 0x1a, 0x4d, 0xc6, 0xa3, 0xa2, 0x4c, 0xb5, 0x2e, 0x46,
+    0x1a, 0xf6, 0xcf, 0x3f, 0xff, 0x55, 0x0d, 0x4a, 0xa5, 0x46, 0xcd, 0x84, 0x4a, 0x0e, 0x2a, 0xa5,
+    0x74, 0x34, 0x79, 0x7a, 0x24, 0x05, 0x85, 0xdc, 0x22, 0x13, 0xde, 0x82, 0xf9, 0x12, 0x90, 0x52,
+    0xc1, 0xd6, 0x55, 0x5b, 0xe7, 0x4c, 0x3b, 0x75, 0x91, 0x83, 0x63, 0x25, 0xd1, 0xc8, 0x2e, 0xcf,
+    0x8c, 0xbe, 0x2a, 0x3e, 0xb8, 0x0a, 0x89, 0x6e, 0x04, 0xdb, 0x09, 0xec, 0xeb, 0xaf, 0x1d, 0xd5,
+    0xd2, 0xe3, 0x5a, 0xed, 0x24, 0x16, 0x99, 0xa8, 0x0b, 0xc8, 0x15, 0xb9, 0xc9, 0xce, 0x15, 0x26,
+    0x25, 0x33, 0x1b, 0x8e, 0x30, 0x19, 0x38, 0x7a, 0x6a, 0x70, 0xf3, 0xd7, 0x25, 0xc4, 0x00, 0xd3,
+    0x07, 0xfd, 0x90, 0xbb, 0x3d, 0x2c, 0xdd, 0x01, 0x05, 0x5d, 0xaf, 0xb7, 0xab, 0xaa, 0x57, 0x28,
+    0xc0, 0x49, 0x51, 0xcc, 0xc4, 0xb6, 0x87, 0xfc, 0x9b, 0x0b, 0x41, 0x7c, 0x9b, 0x0b, 0xaf, 0x72,
+    0xbf, 0x92, 0xb0, 0x15, 0x9d, 0xb0, 0x75, 0x35, 0x8a, 0xbd, 0xa3, 0x62, 0x4d, 0x5d, 0x52, 0x4d,
+    0x97, 0x2d, 0xa3, 0xa6, 0xf9, 0xb2, 0xa9, 0xd6, 0x96, 0x6d, 0x23, 0x33, 0x73, 0x95, 0xc8, 0x2a,
+    0xe2, 0x29, 0x50, 0x00, 0xed, 0x0a, 0x57, 0x91, 0xe9, 0x8c, 0xd4, 0x8a, 0xfa, 0x57, 0x2f, 0x1f,
+    0x34, 0x47, 0x16, 0xdb, 0x1b, 0x1b, 0x2f, 0x1f, 0xea, 0xfc, 0x9a, 0x64, 0xa2, 0x58, 0x6c, 0xcc,
+    0xc5, 0xcb, 0x07, 0x89, 0xee, 0x35, 0xbb, 0x7a, 0xad, 0x7e, 0x2f, 0xae, 0x90, 0x5f, 0x1e, 0xe6,
+    0x1e, 0x6e, 0xda, 0x80, 0x1d, 0x47, 0xd9, 0x61, 0xc6, 0x0e, 0xa4, 0x8f, 0xaa, 0x27, 0xf7, 0x95,
+    0x60, 0xcb, 0xfa, 0x1e, 0xfb, 0x14, 0xbb, 0x76, 0x57, 0x33, 0x90, 0x53, 0x24, 0xa0, 0x66, 0x2a,
+    0xc1, 0xb9, 0x89, 0xef, 0x52, 0xa7, 0xd4, 0xa4, 0xbf, 0x1c, 0x33, 0x7f, 0x0c, 0xbe, 0x8d, 0x60,
+    0x52, 0xc9, 0x36, 0x36, 0xd8, 0x09, 0xc7, 0x0c, 0x05, 0x4a, 0x87, 0x59, 0x28, 0x58, 0x58, 0xb2,
+    0x69, 0x9c, 0xc4, 0xbc, 0x64, 0x11, 0x18, 0x32, 0x67, 0xe2, 0xe9, 0x11, 0xb6, 0x05, 0x4a, 0xca,
+    0x3e, 0x0c, 0xdf, 0x74, 0xbe, 0x0f, 0x68, 0x92, 0xca, 0x74, 0x10, 0xf9, 0x8f, 0xac, 0x8b, 0xfa,
+    0x2e, 0x09, 0x3b, 0x87, 0x91, 0x0b, 0xf6, 0x35, 0xeb, 0xde, 0x8d, 0xba, 0xb2, 0xa9, 0xd7, 0xbd,
+    0xfb, 0xbe, 0xab, 0xe9, 0x61, 0x44, 0x4d, 0x67, 0x97, 0x6d, 0xca, 0xa5, 0x17, 0xf4, 0xa9, 0x77,
+    0x2e, 0x77, 0x26, 0xca, 0xeb, 0x90, 0x5c, 0x66, 0xb7, 0x8d, 0xd0, 0xf5, 0x82, 0x88, 0x80, 0x56,
+    0x33, 0xf6, 0x20, 0x9b, 0x62, 0x53, 0x07, 0x4a, 0x4b, 0x1c, 0x23, 0xc7, 0xd1, 0x86, 0xea, 0x16,
+    0x39, 0xd8, 0x66, 0x33, 0xa8, 0xe3, 0x64, 0x43, 0x86, 0xa2, 0x14, 0x44, 0xd3, 0xaa, 0x12, 0x47,
+    0x56, 0x8d, 0x93, 0xf0, 0x06, 0x09, 0xd1, 0x70, 0xaf, 0x1b, 0xbb, 0xea, 0xdb, 0xac, 0xeb, 0xe6,
+    0xf0, 0xfb, 0x5a, 0x72, 0xd2, 0x17, 0xca, 0x52, 0x75, 0x97, 0x4e, 0x2c, 0x50, 0xaf, 0xd0, 0x8a,
+    0x56, 0xc8, 0x5e, 0x36, 0x1f, 0xb5, 0x64, 0x0d, 0x2e, 0xcd, 0x2e, 0x49, 0xcf, 0xef, 0xbb, 0x8d,
+    0xad, 0xfb, 0x2a, 0x5e, 0x13, 0x21, 0xd4, 0x53, 0xd7, 0x06, 0x09, 0x51, 0xe4, 0x7b, 0x19, 0x77,
+    0x5e, 0x81, 0x63, 0xac, 0x10, 0x03, 0x25, 0x9b, 0x30, 0x60, 0x9e, 0xb5, 0x1a, 0xc1, 0x96, 0x64,
+    0x11, 0x4e, 0x58, 0xce, 0xbb, 0x17, 0x80, 0x48, 0x72, 0xb0, 0x1a, 0xdc, 0xbc, 0x90, 0xf1, 0xbf,
+    0x1a, 0xd9, 0xc2, 0x11, 0xa2, 0x71, 0xf5, 0x0e, 0x08, 0xf0, 0xd5, 0x85, 0xd2, 0x6b, 0x7b, 0xd1,
+    0x9d, 0x0a, 0x80, 0xcc, 0xd9, 0xbc, 0x6f, 0xb3, 0x6f, 0xeb, 0x42, 0x27, 0x28, 0x12, 0x3a, 0x76,
+    0xf5, 0xe2, 0x82, 0xa1, 0x5e, 0x62, 0x75, 0xf8, 0xf4, 0xc8, 0xd9, 0x39, 0x91, 0x70, 0x71, 0x0e,
+    0x65, 0xd6, 0x4d, 0xc9, 0xcb, 0xfc, 0xe2, 0x1c, 0x51, 0xf1, 0x0b, 0xec, 0xf2, 0x81, 0x89, 0x17,
+    0x71, 0x8e, 0x5d, 0xbc, 0xab, 0x6c, 0x3c, 0x86, 0x65, 0xae, 0x82, 0x4a, 0x6f, 0x22, 0x6e, 0xe9,
+    0x4d, 0xc9, 0x7b, 0x58, 0x6d, 0x4a, 0x2d, 0x6e, 0x33, 0x15, 0x77, 0xe4, 0x24, 0xdb, 0x85, 0x6a,
+    0x1d, 0x91, 0xda, 0x2e, 0xdf, 0x5f, 0x58, 0x05, 0x9a, 0x64, 0xa8, 0xfb, 0x1e, 0x83, 0xd3, 0x85,
+    0x93, 0xbb, 0xe6, 0xa8, 0x84, 0xe6, 0xe5, 0x96, 0xe5, 0x30, 0x73, 0x1c, 0x30, 0xd6, 0x6d, 0x1b,
+    0xbb, 0xc9, 0x4b, 0x6b, 0x8d, 0x0e, 0x6f, 0x48, 0xa2, 0xd7, 0x47, 0x5e, 0x45, 0x9e, 0xa5, 0x9f,
+    0x4a, 0x60, 0x8c, 0xb7, 0xd4, 0xe4, 0xd1, 0x35, 0xc3, 0xb6, 0x31, 0x47, 0xb9, 0x4d, 0xf5, 0x20,
+    0x63, 0xe6, 0x36, 0xf3, 0xe5, 0x1e, 0xbf, 0x6e, 0x38, 0x0e, 0x6a, 0x51, 0x28, 0xeb, 0xea, 0x19,
+    0x76, 0x16, 0xb8, 0x62, 0x9e, 0x73, 0x4a, 0x54, 0x9b, 0x8e, 0x72, 0xda, 0xb6, 0xcf, 0x67, 0x02,
+    0x29, 0x12, 0xbf, 0xe6, 0x09, 0x88, 0x2d, 0x6d, 0xe6, 0x72, 0xa7, 0xd5, 0x92, 0x68, 0x16, 0xf2,
+    0x2b, 0x25, 0x5c, 0x2e, 0x08, 0xbe, 0x59, 0xb8, 0xbe, 0xa2, 0x41, 0xe6, 0x31, 0x17, 0x5a, 0xea,
+    0x54, 0xa6, 0x35, 0x49, 0x9d, 0x7a, 0xc2, 0xb2, 0xb7, 0x2b, 0x5d, 0x05, 0xe4, 0x10, 0x31, 0x21,
+    0xd4, 0x62, 0x24, 0xb3, 0x80, 0xc2, 0xd4, 0xc7, 0xb7, 0x31, 0x1e, 0x55, 0xed, 0xc0, 0x97, 0xaa,
+    0xfc, 0xf0, 0xe7, 0x37, 0xe0, 0xf5, 0xdc, 0x0a, 0xf0, 0x41, 0x7a, 0x27, 0xa4, 0x9c, 0x5c, 0xd1,
+    0x3a, 0x7d, 0x94, 0xea, 0xa4, 0x57, 0xbd, 0x68, 0x57, 0x04, 0xe8, 0x5a, 0x4b, 0x1e, 0x60, 0xa8,
+    0x12, 0xd1, 0x64, 0x7d, 0x16, 0x9d, 0xb8, 0x4e, 0x4d, 0x23, 0x70, 0x86, 0x36, 0x2b, 0xa8, 0x09,
+    0x6e, 0x39, 0x58, 0x8b, 0x34, 0xae, 0xc2, 0xd1, 0x29, 0xc1, 0xf3, 0x5b, 0xb0, 0x2c, 0x16, 0x85,
+    0xa9, 0xc0, 0x7e, 0xf8, 0xf4, 0xe9, 0xef, 0xf0, 0x16, 0xb6, 0x0b, 0x9f, 0x10, 0x1b, 0x80, 0x23,
+    0x42, 0x27, 0xcf, 0x82, 0xfd, 0x34, 0xe8, 0x9f, 0xac, 0xb0, 0xb2, 0x37, 0x88, 0xd5, 0xbf, 0x2e,
+    0xc7, 0x63, 0x9e, 0xdb, 0xec, 0xd5, 0x11, 0xa0, 0xe6, 0xbc, 0x14, 0x60, 0x63, 0xe4, 0xfb, 0x81,
+    0xbd, 0x7a, 0xbe, 0x41, 0xcc, 0x50, 0x0c, 0x79, 0x61, 0x4c, 0x02, 0x93, 0xd1, 0x79, 0x5c, 0x40,
+    0x66, 0xa6, 0xa2, 0x56, 0xf7, 0xa2, 0xaa, 0xd6, 0x20, 0x30, 0xd8, 0xc7, 0xc0, 0x81, 0x75, 0x66,
+    0xab, 0xcd, 0xc6, 0x92, 0xdf, 0x33, 0x25, 0xb7, 0x09, 0x22, 0xdb, 0x52, 0x32, 0xb1, 0xba, 0xae,
+    0x18, 0x32, 0x20, 0x57, 0xc0, 0xc3, 0xcf, 0x36, 0xb6, 0x60, 0x09, 0xa1, 0x1d, 0x1b, 0x97, 0xc9,
+    0x31, 0xe7, 0xc5, 0x2b, 0xde, 0xab, 0xe3, 0x62, 0x63, 0xe1, 0xcb, 0x8c, 0xdb, 0xdc, 0xac, 0xe2,
+    0xf1, 0x97, 0xba, 0x93, 0x8a, 0x32, 0xcd, 0x85, 0xdb, 0x18, 0xa6, 0x4a, 0xd1, 0x1d, 0x42, 0xd1,
+    0xf8, 0x33, 0x3c, 0xaa, 0x05, 0xa5, 0xf8, 0x14, 0x07, 0x02, 0xfc, 0xec, 0x6b, 0x8f, 0xf7, 0xaa,
+    0xcd, 0xbe, 0x5f, 0xe2, 0x46, 0x45, 0x12, 0x71, 0x45, 0x4b, 0x86, 0x62, 0x69, 0x23, 0x0b, 0x30,
+    0x3d, 0xd5, 0xf5, 0x11, 0xe5, 0xa8, 0x11, 0x4f, 0x8a, 0xd0, 0x6b, 0x1b, 0x44, 0x02, 0x8f, 0xfb,
+    0x90, 0x40, 0xec, 0xde, 0xa2, 0x62, 0xbd, 0xda, 0xc2, 0xb4, 0x82, 0xfa, 0x70, 0x15, 0x94, 0x3a,
+    0x07, 0xac, 0xc1, 0x7d, 0xbb, 0x04, 0x27, 0x0f, 0x08, 0xd7, 0x7b, 0x90, 0x4a, 0xda, 0xc0, 0x65,
+    0x3d, 0xf5, 0x33, 0x12, 0x55, 0xe7, 0xfd, 0x6b, 0x24, 0xf6, 0x87, 0xff, 0x4d, 0x81, 0x51, 0x6d,
+    0xfd, 0xe5, 0xf2, 0xfa, 0xb6, 0xd5, 0xc0, 0xc4, 0x55, 0x0a, 0x7d, 0x1d, 0x16, 0xb2, 0x58, 0xe1,
+    0x9f, 0xda, 0x5f, 0xc8, 0x37, 0xd8, 0xeb, 0x67, 0xf8, 0x45, 0x57, 0x2a, 0x56, 0x2c, 0x3c, 0xcb,
+    0x30, 0xe1, 0x52, 0x08, 0x96, 0xa7, 0xca, 0xcb, 0x13, 0x2b, 0xe6, 0x72, 0x64, 0x27, 0x10, 0xad,
+    0x3c, 0xd9, 0xb6, 0x7b, 0x8b, 0xe1, 0x5c, 0x92, 0xb8, 0x75, 0x71, 0x81, 0x75, 0xef, 0x15, 0xa2,
+    0xbb, 0x7c, 0xf9, 0xa0, 0x07, 0x21, 0xe7, 0x57, 0x8b, 0x42, 0xe5, 0x1b, 0x96, 0x49, 0xa1, 0x17,
+    0x59, 0x3a, 0x96, 0x50, 0x97, 0x4b, 0xb4, 0xb8, 0xa0, 0xfa, 0xcb, 0xd2, 0xb4, 0x64, 0x78, 0x2c,
+    0xa1, 0x35, 0xde, 0x1c, 0x4d, 0x2c, 0x75, 0x1f, 0xf6, 0x91, 0xaf, 0x3e, 0x71, 0xd7, 0xaa, 0xc5,
+    0xdd, 0x56, 0x03, 0xbd, 0x5d, 0xee, 0x33, 0xac, 0xaf, 0x56, 0xe5, 0x24, 0xa1, 0x46, 0x5d, 0xb8,
+    0x6f, 0xaa, 0xc0, 0x55, 0xd5, 0xdf, 0xef, 0xb5, 0xbb, 0x87, 0x64, 0x39, 0x2a, 0x05, 0xe0, 0x36,
+    0x65, 0xc2, 0xcb, 0x07, 0x67, 0xbe, 0x2e, 0xcb, 0xcd, 0x12, 0x8b, 0x16, 0xde, 0x62, 0xc0, 0x53,
+    0x25, 0xe0, 0x4d, 0x1a, 0x0b, 0x2a, 0xa8, 0xfe, 0xf9, 0x1f, 0xff, 0x89, 0x45, 0xf8, 0x3c, 0xcc,
+    0x53, 0xad, 0xb8, 0x74, 0x56, 0x64, 0xfa, 0x2d, 0x26, 0x9b, 0xa9, 0xf7, 0x80, 0x0c, 0x5e, 0x04,
+    0xa8, 0x36, 0x6f, 0x7a, 0x25, 0xb5, 0x3e, 0x46, 0x4b, 0x07, 0xbc, 0x01, 0x2f, 0x13, 0x41, 0xa1,
+    0x8b, 0xa2, 0xfb, 0x34, 0x8b, 0xe2, 0x71, 0xfc, 0xf4, 0x28, 0x40, 0x82, 0xb3, 0x32, 0x16, 0xf2,
+    0x84, 0x38, 0x4f, 0xe3, 0xa7, 0xff, 0x02, 0x31, 0xdd, 0x62, 0x49, 0x80, 0x07, 0x03, 0x28, 0x2c,
+    0x28, 0x7c, 0x5e, 0x53, 0xd9, 0xbe, 0x0b, 0x54, 0xb7, 0x82, 0x9a, 0x8c, 0x0e, 0xd1, 0x09, 0xf9,
+    0xe4, 0x8a, 0x56, 0xca, 0x88, 0xde, 0x3e, 0xa7, 0x17, 0x24, 0xd1, 0xe0, 0xbb, 0x6a, 0xca, 0xfa,
+    0x9d, 0xd5, 0xda, 0x55, 0xc8, 0x2c, 0x25, 0x2b, 0xa8, 0x84, 0xef, 0x93, 0x2c, 0x8c, 0x2a, 0xaa,
+    0xd4, 0x40, 0x20, 0x8f, 0x8d, 0xb0, 0x64, 0x91, 0x1e, 0x54, 0x8b, 0xdb, 0xda, 0x8f, 0x9e, 0xbb,
+    0xd4, 0x85, 0x74, 0xbb, 0x62, 0x0e, 0x58, 0x43, 0x3b, 0x69, 0x80, 0x99, 0x44, 0xfe, 0x05, 0x04,
+    0x55, 0xfe, 0x1d, 0xac, 0xee, 0x59, 0xf4, 0x36, 0x6e, 0xd9, 0x22, 0xbb, 0x79, 0x1d, 0xe9, 0xb1,
+    0x1c, 0x44, 0xd2, 0xd8, 0x9e, 0x8d, 0x01, 0x83, 0xb8, 0x39, 0x8a, 0xad, 0xf5, 0xce, 0x9e, 0x8d,
+    0x44, 0xfa, 0xa0, 0x65, 0x73, 0x03, 0xe7, 0x81, 0x09, 0x98, 0x4e, 0xc4, 0xd0, 0x5b, 0xe8, 0xc9,
+    0xe6, 0x08, 0xad, 0x6d, 0xa6, 0x2f, 0x73, 0x5f, 0x8c, 0x26, 0x3c, 0x2a, 0x13, 0x7e, 0xa6, 0x6f,
+    0xcd, 0xe8, 0xbe, 0x10, 0x5e, 0x22, 0xc0, 0x53, 0xb9, 0xac, 0x2c, 0x94, 0x7b, 0x70, 0x2f, 0xdc,
+    0xb4, 0xaa, 0xce, 0x9d, 0xfb, 0x02, 0xcf, 0xc6, 0x79, 0xa1, 0xa7, 0xfa, 0x56, 0x37, 0x52, 0x41,
+    0x99, 0x2e, 0x94, 0x32, 0xdd, 0x76, 0x1d, 0x0d, 0x5d, 0xdc, 0xa9, 0x29, 0xed, 0xd2, 0x5c, 0xa8,
+    0xe6, 0xcb, 0x30, 0xd1, 0x25, 0xfb, 0x97, 0x13, 0xed, 0x5e, 0x07, 0xc2, 0x26, 0x2f, 0x21, 0xb4,
+    0x4e, 0x1f, 0x66, 0x39, 0xbf, 0x8d, 0xb3, 0x52, 0xa8, 0xab, 0x83, 0xda, 0xfb, 0xcd, 0x4d, 0x55,
+    0xeb, 0x02, 0x98, 0xac, 0x33, 0xbf, 0x37, 0x41, 0xd9, 0x85, 0x08, 0xb2, 0x74, 0xa4, 0x16, 0xd3,
+    0xe5, 0x7d, 0x03, 0x10, 0x81, 0xe8, 0xc3, 0xeb, 0x05, 0xc4, 0x2a, 0x4a, 0x47, 0x49, 0x80, 0x2d,
+    0x27, 0xd1, 0xcc, 0x12, 0x20, 0x06, 0xdc, 0xa2, 0xef, 0x29, 0x25, 0x48, 0xb2, 0x5c, 0xa8, 0x8b,
+    0x29, 0x10, 0xaf, 0xa7, 0xe8, 0x3d, 0x38, 0x5e, 0x4a, 0x31, 0x4c, 0x83, 0x18, 0x26, 0xf1, 0x54,
+    0x71, 0xd4, 0xea, 0x14, 0x94, 0x39, 0xb2, 0xb3, 0xa1, 0x51, 0x68, 0x55, 0xa8, 0x9a, 0x15, 0x18,
+    0xb7, 0x2a, 0x59, 0xc0, 0x4c, 0xc9, 0x59, 0xb9, 0x03, 0xd9, 0x99, 0x53, 0xe7, 0xe5, 0x1e, 0x95,
+    0x6a, 0x32, 0x85, 0xf0, 0x2a, 0xf6, 0xcf, 0xe9, 0xce, 0x06, 0xc1, 0x13, 0xcb, 0x1b, 0xee, 0x85,
+    0x78, 0x34, 0x70, 0x27, 0x3b, 0x39, 0x94, 0xa8, 0x0b, 0x70, 0xab, 0xd8, 0xd7, 0xeb, 0x97, 0x58,
+    0x91, 0xa8, 0xdd, 0x8d, 0xc2, 0x14, 0xf4, 0xa0, 0xe0, 0xd3, 0x99, 0x60, 0x58, 0xf7, 0x27, 0x01,
+    0x82, 0xd4, 0xef, 0x78, 0x74, 0x3a, 0xd8, 0xfd, 0xc3, 0xae, 0x8b, 0x3c, 0xf3, 0x11, 0x5a, 0x22,
+    0x19, 0x8c, 0x03, 0x29, 0xb6, 0x9e, 0xae, 0xa4, 0x65, 0x54, 0x3c, 0x3d, 0x22, 0x72, 0x6c, 0x26,
+    0x95, 0xa9, 0x3a, 0xbd, 0xb7, 0x6e, 0x97, 0x42, 0xa8, 0x1b, 0x95, 0x79, 0x0c, 0x5f, 0x7c, 0x05,
+    0x11, 0xa2, 0x1c, 0x8d, 0xc0, 0x2c, 0x75, 0x24, 0x33, 0x76, 0x6c, 0xed, 0xb5, 0x42, 0xf7, 0xf4,
+    0x58, 0x84, 0xd7, 0x49, 0x0c, 0xb8, 0xac, 0xe3, 0x9a, 0xba, 0x9d, 0x00, 0xed, 0x78, 0xc3, 0xcd,
+    0x06, 0x58, 0x52, 0x6d, 0x32, 0x91, 0x1d, 0x59, 0xf4, 0xda, 0x7b, 0xd7, 0xda, 0xe8, 0xd3, 0x75,
+    0x23, 0xd7, 0x52, 0xe9, 0xbe, 0x46, 0x28, 0xa8, 0x42, 0xa4, 0xd7, 0x81, 0x7a, 0xc4, 0xf3, 0xad,
+    0x8a, 0x5a, 0x54, 0x34, 0xcc, 0x29, 0x77, 0x56, 0x72, 0xee, 0x10, 0x98, 0x62, 0x31, 0xef, 0x0a,
+    0x6f, 0x5e, 0x20, 0xa2, 0x45, 0xc0, 0x94, 0xd3, 0x21, 0x44, 0x61, 0x59, 0x64, 0x53, 0x60, 0x28,
+    0xe4, 0x0a, 0x2a, 0xe4, 0x2f, 0x73, 0xcf, 0xf2, 0x62, 0xb6, 0x0f, 0xac, 0x38, 0x26, 0xa9, 0x21,
+    0x2f, 0xa8, 0x16, 0xa9, 0xe7, 0x0e, 0x72, 0x67, 0xd2, 0xd6, 0x91, 0x3d, 0xa8, 0x44, 0xbb, 0x8d,
+    0x7c, 0x7b, 0x1e, 0x47, 0x55, 0x14, 0x77, 0x10, 0x56, 0x66, 0xba, 0x42, 0x60, 0xef, 0xc3, 0x62,
+    0x12, 0x4c, 0xe3, 0xd4, 0x6f, 0x7c, 0xff, 0x6f, 0x6c, 0x33, 0xf8, 0x0e, 0xea, 0x84, 0xef, 0x40,
+    0xac, 0x26, 0x91, 0x6e, 0xf0, 0xd3, 0x96, 0x11, 0xbb, 0x62, 0x25, 0x36, 0xad, 0x12, 0x2b, 0x7a,
+    0x0d, 0x2e, 0xeb, 0x83, 0x8a, 0x6f, 0x3a, 0xc3, 0x95, 0x13, 0x56, 0xcb, 0x52, 0x39, 0x1a, 0xdb,
+    0xa1, 0x78, 0x3f, 0x3f, 0x3d, 0xe6, 0x90, 0x20, 0xf1, 0x3f, 0xe1, 0x6d, 0xb9, 0x5f, 0x39, 0x5e,
+    0x4e, 0xe3, 0xd8, 0xef, 0x42, 0x63, 0x14, 0x3c, 0x2c, 0x57, 0x58, 0x82, 0x1d, 0x91, 0x5c, 0xf2,
+    0x55, 0xdc, 0x6a, 0xda, 0x80, 0xed, 0x5b, 0xf5, 0x81, 0x03, 0x05, 0x3b, 0xb6, 0x5b, 0x55, 0x6d,
+    0xa4, 0xac, 0x78, 0x4e, 0x09, 0x39, 0x34, 0xac, 0x0b, 0xe9, 0x58, 0x36, 0x66, 0x94, 0x5e, 0xed,
+    0x93, 0x17, 0x82, 0xea, 0x70, 0xb9, 0xf7, 0x50, 0xcd, 0xc2, 0xee, 0x2b, 0xb5, 0x2a, 0x66, 0x61,
+    0x2e, 0x9c, 0x17, 0x5a, 0x16, 0xeb, 0x32, 0x96, 0xe7, 0xb9, 0x6d, 0x25, 0x00, 0x35, 0xd9, 0x32,
+    0x79, 0x75, 0xeb, 0x99, 0x6b, 0x59, 0xd0, 0xc2, 0x0d, 0x5e, 0x7b, 0xe5, 0x05, 0xac, 0x2a, 0x2d,
+    0x96, 0x57, 0xf3, 0x0c, 0xc3, 0x9e, 0x7b, 0x3e, 0xb3, 0xfe, 0xa0, 0xe4, 0x59, 0x47, 0x25, 0x1a,
+    0x88, 0x64, 0xe0, 0xdc, 0xf5, 0xa2, 0xeb, 0x61, 0x57, 0x1b, 0xe1, 0x2c, 0xde, 0xc0, 0x84, 0x75,
+    0xdd, 0x19, 0x09, 0x76, 0xe7, 0x21, 0x84, 0x4d, 0xb2, 0x08, 0x9e, 0xdf, 0xf6, 0x86, 0x1e, 0x5b,
+    0x54, 0xf4, 0xd5, 0x92, 0x39, 0x23, 0x9d, 0x66, 0xbe, 0x57, 0x9e, 0xe2, 0x68, 0x3a, 0xcb, 0x84,
+    0x88, 0xaf, 0x13, 0xba, 0xd0, 0x99, 0xa3, 0xbb, 0x9e, 0x81, 0xfa, 0x82, 0x4e, 0x24, 0x1e, 0x7a,
+    0x5b, 0x14, 0x40, 0x5c, 0xc4, 0x10, 0x4f, 0xd0, 0x85, 0x10, 0x92, 0xb5, 0x69, 0x54, 0x4d, 0x02,
+    0xea, 0x7c, 0xe0, 0x00, 0xaf, 0xff, 0xdc, 0x15, 0xeb, 0xae, 0x07, 0xb9, 0x17, 0x1e, 0xec, 0x43,
+    0x83, 0xf0, 0xcb, 0xee, 0x3b, 0xa8, 0xfb, 0x6f, 0xfa, 0x95, 0xbc, 0x93, 0x10, 0x80, 0x30, 0xa6,
+    0xbe, 0x0c, 0x74, 0x75, 0x0d, 0xb8, 0xce, 0xe8, 0xc0, 0xbe, 0x49, 0xfe, 0x0f, 0xb2, 0x07, 0xac,
+    0x5a, 0xdc, 0x84, 0x79, 0xe1, 0x08, 0xb4, 0xf9, 0x02, 0x1f, 0x09, 0xd5, 0x33, 0x42, 0xdd, 0xc0,
+    0x89, 0xa0, 0xbf, 0x5a, 0xe7, 0x8d, 0x10, 0x4f, 0xfb, 0x83, 0xa1, 0xe9, 0xc1, 0xa8, 0xdb, 0x73,
+    0xdb, 0x20, 0x65, 0x4f, 0xdd, 0x3a, 0xe8, 0x60, 0xc6, 0xe0, 0x01, 0xa0, 0x7d, 0x35, 0xee, 0xae,
+    0x33, 0x9f, 0xcf, 0x3b, 0xd8, 0x51, 0xec, 0x40, 0x96, 0x21, 0x8f, 0x4b, 0x22, 0x4f, 0x37, 0x77,
+    0x19, 0x6d, 0x67, 0x9b, 0x3e, 0x2d, 0x25, 0x54, 0x0d, 0x60, 0x45, 0x7b, 0x3d, 0xe7, 0xd6, 0xbb,
+    0x58, 0x8a, 0x23, 0x28, 0x34, 0x99, 0x52, 0xd4, 0x6e, 0x2a, 0x41, 0xfe, 0x91, 0xf3, 0x1b, 0x90,
+    0x2c, 0x68, 0x4c, 0x60, 0x1f, 0x09, 0x7f, 0x5e, 0xe3, 0x9e, 0xfe, 0x02, 0x8e, 0x7b, 0xc4, 0x22,
+    0xcf, 0xa0, 0x90, 0x17, 0x4b, 0x9a, 0x56, 0x79, 0x9e, 0xce, 0x59, 0x57, 0x69, 0xd3, 0x68, 0x98,
+    0xc7, 0x37, 0xe6, 0x32, 0x8e, 0x7d, 0x90, 0x45, 0x5d, 0x98, 0xff, 0x63, 0xd5, 0xab, 0x79, 0x68,
+    0xed, 0xc3, 0x65, 0x53, 0xa5, 0x90, 0x94, 0x2b, 0x85, 0xb0, 0x14, 0xcf, 0xdc, 0xb1, 0x91, 0xbf,
+    0xd4, 0x96, 0xda, 0x26, 0x4e, 0x54, 0xfd, 0x0a, 0xc8, 0x21, 0xcd, 0x79, 0xfa, 0x5c, 0x60, 0x7e,
+    0x12, 0x49, 0xbf, 0x40, 0x25, 0x93, 0x71, 0xaa, 0x41, 0xff, 0xb4, 0x77, 0xe2, 0x5e, 0xec, 0x98,
+    0xe3, 0x49, 0x71, 0x1a, 0xf9, 0x4e, 0x98, 0x96, 0x69, 0xab, 0x89, 0x23, 0xaf, 0x1b, 0xcf, 0x0f,
+    0x9d, 0xae, 0x91, 0xfa, 0xd3, 0x8f, 0x39, 0x15, 0xaa, 0x9f, 0x27, 0x2e, 0x5a, 0x06, 0x9b, 0x8a,
+    0x29, 0xf2, 0xe4, 0x2f, 0x1e, 0xdf, 0x9b, 0x80, 0x21, 0x77, 0xb9, 0xa4, 0x8b, 0x6a, 0x3d, 0x7d,
+    0xf1, 0xbc, 0xae, 0x8e, 0xb7, 0xd9, 0x3d, 0x1e, 0x71, 0xdd, 0xc6, 0xa1, 0xb5, 0xcf, 0xba, 0x66,
+    0x5a, 0xc5, 0x78, 0xa3, 0x67, 0x0a, 0x8a, 0x09, 0x4f, 0x55, 0x85, 0xa6, 0xc4, 0xf1, 0x73, 0x1c,
+    0xbe, 0x2b, 0x8a, 0x99, 0x02, 0x68, 0x05, 0xa4, 0xdc, 0x6b, 0x41, 0x56, 0xf9, 0xc2, 0x46, 0xe8,
+    0xc6, 0x98, 0xf4, 0x4c, 0x8f, 0xf4, 0xaf, 0xf9, 0x22, 0xad, 0x65, 0xff, 0x0f, 0xdd, 0x51, 0xfd,
+    0xbe, 0x24, 0xb3, 0x6e, 0xac, 0x90, 0xe4, 0xf1, 0x22, 0xf3, 0x17, 0xba, 0x23, 0x37, 0x00, 0x1a,
+    0x84, 0x18, 0x00, 0xf9, 0xff, 0xd8, 0x21, 0x81, 0x01, 0x45, 0xd8, 0xc1, 0xc5, 0xa5, 0x84, 0xee,
+    0x23, 0xe8, 0x9b, 0x88, 0x51, 0x44, 0xe3, 0x78, 0x23, 0x8d, 0x43, 0x86, 0x8a, 0x7f, 0x53, 0x88,
+    0x47, 0xbf, 0x81, 0x60, 0x56, 0x14, 0x1f, 0xd7, 0xfa, 0x7f, 0x0e, 0x32, 0x0f, 0x02, 0x17, 0x73,
+    0xa3, 0x8b, 0x63, 0x01, 0xf5, 0x92, 0x7c, 0x7d, 0x8e, 0x91, 0x9f, 0xee, 0xb4, 0x65, 0xe9, 0x85,
+    0x9b, 0xe2, 0x2b, 0x87, 0xd7, 0x3c, 0x3b, 0xa0, 0x9e, 0x8c, 0x95, 0xbf, 0xab, 0xd5, 0xf0, 0x7e,
+    0x16, 0xdd, 0x93, 0x34, 0xbd, 0x37, 0x0b, 0xa3, 0xbe, 0xf8, 0x2a, 0x6f, 0x42, 0xfa, 0xcb, 0x97,
+    0x62, 0x9d, 0xf5, 0x25, 0x51, 0x54, 0x50, 0x23, 0x6a, 0x03, 0x29, 0xc7, 0xab, 0xa5, 0x35, 0x1c,
+    0xf5, 0xb4, 0xc2, 0xdb, 0xaa, 0x55, 0xb4, 0xc2, 0x68, 0x75, 0x82, 0x69, 0x7a, 0x45, 0x36, 0x02,
+    0xad, 0xee, 0x56, 0x05, 0x52, 0x0f, 0x12, 0x76, 0x16, 0x59, 0xeb, 0xb1, 0x60, 0xee, 0x33, 0xd4,
+    0x7f, 0xea, 0x51, 0xf2, 0x5b, 0xfe, 0xcb, 0x87, 0xcc, 0x2a, 0x34, 0x58, 0x83, 0x60, 0x45, 0x79,
+    0x3d, 0x8d, 0x8b, 0x26, 0xc9, 0x4a, 0x61, 0x60, 0xbf, 0x03, 0xbe, 0x0f, 0x65, 0x3f, 0xdc, 0x77,
+    0x6a, 0x5b, 0xc2, 0x8b, 0x41, 0xa5, 0xf6, 0x97, 0x12, 0x13, 0x56, 0x56, 0xfe, 0x29, 0x6e, 0xe9,
+    0x8f, 0x66, 0xcb, 0xf7, 0x87, 0xec, 0x7a, 0xfb, 0x27, 0x2a, 0x54, 0xa6, 0x31, 0xfd, 0xe7, 0xe7,
+    0xd7, 0xac, 0xcc, 0xdd, 0x6a, 0xb4, 0xd6, 0x70, 0xa8, 0x0c, 0xac, 0xa1, 0x8b, 0x65, 0x0e, 0x3c,
+    0x9a, 0xf8, 0x79, 0x9c, 0xdd, 0xa0, 0x3f, 0xc9, 0xb3, 0x44, 0xd8, 0x9d, 0x35, 0xf3, 0x47, 0x9e,
+    0x75, 0x86, 0x61, 0x71, 0x4e, 0xdf, 0x4d, 0x8f, 0x61, 0xed, 0xfc, 0xdd, 0xf0, 0xfd, 0x31, 0x76,
+    0x56, 0xbc, 0x55, 0x8b, 0xaa, 0x95, 0x6a, 0xf6, 0x48, 0x6d, 0x2b, 0x57, 0xc4, 0x7a, 0xc8, 0xa1,
+    0xd2, 0xfa, 0x4f, 0x8b, 0xd3, 0xaa, 0x83, 0x55, 0xd4, 0x65, 0xa7, 0x65, 0x9a, 0x0f, 0xfb, 0xef,
+    0x95, 0xdb, 0x3c, 0x86, 0xa0, 0x06, 0x2e, 0xb1, 0x4d, 0x78, 0x61, 0xd6, 0x7f, 0x03, 0x5f, 0x19,
+    0x45, 0xe4, 0x2c, 0x3c, 0x00, 0x00,
+};
+
+// /style.d42de52911.css (1601 octets compressés)
+constexpr uint8_t kAsset1[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x58, 0x49, 0x6f, 0xe3, 0x36,
+    0x14, 0xbe, 0xe7, 0x57, 0x08, 0x08, 0x82, 0xd8, 0xad, 0x65, 0x90, 0x72, 0xe4, 0xd8, 0x1e, 0x14,
+    0xe8, 0xb5, 0xd7, 0x16, 0x3d, 0x14, 0x83, 0x62, 0x40, 0x49, 0x94, 0xcd, 0x46, 0x12, 0x05, 0x92,
+    0xf2, 0xd2, 0xc1, 0xfc, 0xf7, 0x3e, 0x2e, 0xda, 0x25, 0x67, 0x26, 0xc5, 0x60, 0x6c, 0xeb, 0x89,
+    0x6f, 0xff, 0xde, 0xc2, 0xfc, 0xe4, 0x7d, 0x7d, 0xf0, 0xbc, 0x88, 0x5f, 0x7d, 0xc9, 0xfe, 0x65,
+    0xc5, 0xf1, 0x00, 0xbf, 0x45, 0x42, 0x85, 0x0f, 0xa4, 0x4f, 0x0f, 0xdf, 0x1e, 0x1e, 0x0e, 0x82,
+    0x73, 0x65, 0x0e, 0xc5, 0x3c, 0xe3, 0xc2, 0x97, 0xf1, 0x89, 0xe6, 0xf4, 0xe0, 0x25, 0x44, 0xbc,
+    0x7d, 0x02, 0xaa, 0xef, 0x47, 0xc0, 0xf4, 0x88, 0x22, 0x8c, 0xf0, 0xde, 0x12, 0x4a, 0x52, 0xd0,
+    0x0c, 0x68, 0x38, 0xc4, 0x71, 0xb0, 0xeb, 0xd0, 0x7c, 0x92, 0x29, 0x4d, 0xa7, 0xc1, 0xeb, 0x26,
+    0xb4, 0x74, 0x45, 0xaf, 0x9a, 0x94, 0x06, 0x69, 0x98, 0xba, 0xa3, 0x79, 0xa5, 0x68, 0x02, 0xb4,
+    0x1d, 0xdd, 0x47, 0x91, 0x3b, 0x46, 0xe2, 0x98, 0x16, 0x86, 0x37, 0x49, 0x30, 0xc1, 0x5d, 0xa2,
+    0x2f, 0x95, 0xe0, 0xda, 0xf0, 0x47, 0x8c, 0x48, 0xbc, 0x7b, 0xb1, 0xef, 0x12, 0x52, 0x1c, 0xa9,
+    0xd0, 0x92, 0xd3, 0x6d, 0xb4, 0x8d, 0x2c, 0xf1, 0x42, 0x44, 0x61, 0x7c, 0x7c, 0x4c, 0x69, 0x4c,
+    0xc2, 0x57, 0x4b, 0xe5, 0x95, 0xca, 0x58, 0x01, 0x2e, 0x89, 0x63, 0x44, 0x16, 0x41, 0x18, 0xae,
+    0xbc, 0xf6, 0x03, 0xad, 0xd1, 0x6e, 0x69, 0xcf, 0xc9, 0x13, 0x49, 0xf8, 0xe5, 0xe0, 0x21, 0x0f,
+    0xbf, 0x94, 0x57, 0x6f, 0x13, 0xc0, 0x87, 0x61, 0x81, 0x63, 0x38, 0x80, 0xf3, 0x2f, 0xfa, 0x78,
+    0x68, 0x4e, 0xa7, 0x1c, 0x0c, 0x4b, 0x49, 0xce, 0xb2, 0xdb, 0xc1, 0x7b, 0xfe, 0x83, 0x1e, 0x39,
+    0xf5, 0xfe, 0xfc, 0xed, 0x79, 0xe5, 0xfd, 0xce, 0x23, 0xae, 0xf8, 0xca, 0x93, 0xa4, 0x90, 0xbe,
+    0xa4, 0x82, 0xa5, 0x26, 0xca, 0x11, 0x4f, 0x6e, 0x26, 0xc8, 0x39, 0x11, 0x47, 0x56, 0x80, 0x12,
+    0x2d, 0x25, 0x22, 0xf1, 0xdb, 0x51, 0xf0, 0xaa, 0x80, 0x70, 0x08, 0x92, 0x30, 0x92, 0xf9, 0x47,
+    0xfd, 0x0d, 0x5e, 0x2f, 0x62, 0x26, 0xe2, 0x8c, 0x7a, 0x44, 0x79, 0x8a, 0x97, 0x2b, 0x6b, 0x08,
+    0xde, 0x82, 0x25, 0xda, 0x14, 0xbc, 0x33, 0xb6, 0x6c, 0xc2, 0xe5, 0xca, 0x53, 0x02, 0x54, 0x95,
+    0x44, 0x00, 0x93, 0xb7, 0x45, 0x4f, 0xcb, 0x15, 0x08, 0xf6, 0xbc, 0x33, 0x11, 0x0b, 0x9d, 0x3a,
+    0x63, 0xad, 0xc9, 0xec, 0xc1, 0xd1, 0x74, 0x46, 0x0c, 0x35, 0x67, 0x85, 0x7f, 0xa2, 0xec, 0x78,
+    0x82, 0xb8, 0x63, 0x84, 0xce, 0x27, 0x4d, 0x4c, 0x98, 0x2c, 0x33, 0x02, 0x4e, 0xa5, 0x19, 0xbd,
+    0x1a, 0x4f, 0xe1, 0xdb, 0x4f, 0x98, 0xa0, 0xb1, 0x62, 0x1c, 0x0c, 0x07, 0x59, 0x55, 0x5e, 0x18,
+    0xa7, 0xd6, 0x31, 0x44, 0x81, 0x40, 0x68, 0x85, 0x71, 0xed, 0xc2, 0x12, 0x75, 0x3a, 0x68, 0xb1,
+    0x0b, 0x0c, 0xf2, 0xca, 0xeb, 0xca, 0xdb, 0xa3, 0xf3, 0xc5, 0xea, 0x72, 0x6e, 0x07, 0xeb, 0x50,
+    0xd0, 0xdc, 0x23, 0x95, 0xe2, 0x3f, 0xa4, 0xcd, 0xf3, 0x8e, 0xa4, 0x04, 0x76, 0x60, 0xb6, 0xaa,
+    0x49, 0x59, 0x82, 0xf1, 0x24, 0x71, 0xba, 0xb5, 0x53, 0x80, 0x3e, 0x76, 0xd4, 0x3c, 0x10, 0x09,
+    0x2a, 0x3e, 0x22, 0x1e, 0x19, 0xeb, 0x46, 0x0a, 0x4e, 0x78, 0x9c, 0x3a, 0x03, 0x00, 0x28, 0x29,
+    0x80, 0x55, 0x9c, 0x91, 0xbc, 0x5c, 0x04, 0x6b, 0x6d, 0x1c, 0xa0, 0xe4, 0x7c, 0xf1, 0x7e, 0xf6,
+    0xb0, 0x91, 0x04, 0x4f, 0xeb, 0x1d, 0x7c, 0x2f, 0xad, 0x48, 0x59, 0x45, 0x8a, 0x29, 0x48, 0xea,
+    0xd7, 0x61, 0x4e, 0x4c, 0x49, 0xf4, 0x02, 0x85, 0x9a, 0x08, 0x17, 0xd6, 0x58, 0x5b, 0x61, 0x86,
+    0x75, 0xe4, 0x96, 0x71, 0xdc, 0x67, 0x8a, 0xe6, 0xb2, 0xeb, 0xbe, 0xf1, 0x09, 0x1b, 0x8f, 0x3c,
+    0xaf, 0x24, 0x49, 0x62, 0x6a, 0x03, 0x1b, 0x43, 0xe1, 0x6b, 0xeb, 0xde, 0xb8, 0x86, 0xa0, 0x81,
+    0x57, 0x01, 0xbf, 0x06, 0xff, 0x10, 0x9c, 0xd6, 0x4a, 0x63, 0xc1, 0xb2, 0x65, 0x81, 0xb3, 0x50,
+    0x22, 0x92, 0x67, 0x2c, 0x71, 0x27, 0x5c, 0xa9, 0xb9, 0x33, 0xd7, 0xa6, 0xa4, 0xec, 0x5b, 0xfb,
+    0x54, 0x07, 0x43, 0x11, 0x55, 0x49, 0x9f, 0x15, 0x09, 0x8b, 0x89, 0xe2, 0x3d, 0x08, 0xe1, 0x9d,
+    0x35, 0xa1, 0x41, 0xa7, 0x7b, 0x1e, 0x58, 0x1a, 0xa2, 0xa7, 0x5e, 0x96, 0x59, 0xa1, 0x95, 0xfb,
+    0x51, 0xc6, 0xe3, 0xb7, 0x26, 0xdb, 0xf2, 0x24, 0x58, 0xf1, 0xd6, 0x04, 0x74, 0xa8, 0x16, 0xbc,
+    0xa2, 0x85, 0x0e, 0x8c, 0xed, 0x93, 0x23, 0x9f, 0x5d, 0x4b, 0x31, 0x1e, 0x91, 0x82, 0xe5, 0xc4,
+    0x02, 0xa7, 0xac, 0x32, 0x49, 0x21, 0x86, 0x3b, 0x09, 0x5a, 0x53, 0x56, 0x40, 0xec, 0xe7, 0xe4,
+    0xcb, 0x0a, 0xda, 0x98, 0x94, 0x33, 0xf2, 0x6d, 0x8f, 0x1b, 0x05, 0x0c, 0x99, 0x7f, 0xdb, 0xba,
+    0x03, 0x05, 0x7b, 0x80, 0x12, 0x82, 0x0f, 0xbc, 0xc5, 0xba, 0xf0, 0x71, 0xb8, 0x9c, 0x53, 0x47,
+    0x85, 0x70, 0xc1, 0x1c, 0x2b, 0xb3, 0x4d, 0xf3, 0x5d, 0x65, 0xba, 0x2f, 0x62, 0xf4, 0xea, 0x3e,
+    0xd0, 0x3a, 0xe8, 0x2b, 0x4b, 0x28, 0x14, 0x7d, 0x26, 0xfb, 0x35, 0x61, 0x41, 0x85, 0x6c, 0x71,
+    0xcc, 0x60, 0xbb, 0x53, 0x33, 0x68, 0xbd, 0x6f, 0x2a, 0x4d, 0xf1, 0x37, 0x5a, 0xf8, 0x31, 0x11,
+    0xc9, 0x8c, 0xd9, 0x43, 0xdc, 0xb5, 0x50, 0xdd, 0x5a, 0x5c, 0x74, 0xb0, 0xbd, 0xeb, 0x81, 0xfa,
+    0x7f, 0x21, 0xb4, 0xb5, 0xeb, 0xcb, 0x97, 0x4e, 0xab, 0xf9, 0xf1, 0xa6, 0x12, 0x38, 0x9b, 0x6c,
+    0xb0, 0x60, 0xf2, 0x2a, 0xc5, 0xf3, 0xba, 0x32, 0x5b, 0x4d, 0x29, 0xa3, 0x59, 0x32, 0xad, 0xc2,
+    0x09, 0x7a, 0x0d, 0x9d, 0xa4, 0x99, 0x82, 0x77, 0x0a, 0x60, 0x60, 0xe8, 0xd3, 0xdb, 0x49, 0xf9,
+    0xac, 0x28, 0x2b, 0x3b, 0xef, 0xb5, 0x70, 0xb0, 0xc2, 0x35, 0x9a, 0x8a, 0xc2, 0xec, 0x61, 0x03,
+    0xfd, 0x9a, 0xd2, 0x76, 0x92, 0x75, 0xad, 0x5e, 0x93, 0x61, 0x8e, 0xe4, 0x70, 0x48, 0x51, 0xdf,
+    0xfa, 0x0b, 0x86, 0x08, 0x5a, 0x52, 0xa2, 0x16, 0xba, 0xb9, 0x83, 0x32, 0xb5, 0xd2, 0xa3, 0x20,
+    0x27, 0xd7, 0x45, 0xb0, 0x35, 0xc3, 0x00, 0xa7, 0x62, 0xb9, 0x6c, 0xb4, 0xdd, 0xcb, 0xb5, 0xde,
+    0x23, 0x96, 0x83, 0xc4, 0xce, 0x75, 0xab, 0x5e, 0x6b, 0xb8, 0x9f, 0xef, 0x1f, 0xcd, 0x5c, 0xdd,
+    0x3a, 0xcd, 0x84, 0x65, 0xf6, 0x88, 0xf9, 0x9d, 0x72, 0x91, 0xeb, 0xbc, 0x4a, 0x8f, 0x12, 0x49,
+    0x57, 0xb5, 0x4d, 0x06, 0xf6, 0x7d, 0x7a, 0x0d, 0xb0, 0x96, 0x3a, 0x9c, 0xbc, 0xc1, 0x0e, 0x95,
+    0xd7, 0x36, 0x2a, 0xf7, 0x80, 0xd6, 0xcb, 0x7a, 0x04, 0xb2, 0xb4, 0x67, 0xfa, 0xc5, 0x3f, 0x95,
+    0x54, 0x2c, 0xbd, 0xf9, 0x7a, 0x1e, 0x9b, 0x35, 0x0a, 0xf6, 0x81, 0x18, 0x1a, 0x21, 0x55, 0x17,
+    0x4a, 0xa7, 0xc7, 0x9b, 0xd1, 0x15, 0xdc, 0x9d, 0x6b, 0x78, 0xbd, 0xe9, 0x1e, 0xf7, 0x6d, 0xf9,
+    0x5b, 0xe8, 0x8c, 0x2b, 0x79, 0xa6, 0xea, 0x6b, 0x5d, 0x7a, 0x40, 0xc3, 0x8e, 0x42, 0x56, 0x73,
+    0x68, 0xec, 0xed, 0x42, 0xd3, 0x8b, 0x5a, 0x38, 0x33, 0x7b, 0x3a, 0x1b, 0xd0, 0x14, 0x42, 0x02,
+    0x8b, 0x90, 0xe9, 0x25, 0xa8, 0x41, 0x18, 0x5a, 0xef, 0xcc, 0x6a, 0x52, 0x27, 0xbd, 0x1b, 0x88,
+    0x09, 0x1c, 0xcc, 0xa6, 0xbc, 0x71, 0xa3, 0x9f, 0x72, 0x41, 0xad, 0xac, 0x33, 0x15, 0x0a, 0x5a,
+    0x75, 0x36, 0x8e, 0xcc, 0x21, 0xe5, 0x71, 0x25, 0xa7, 0xe2, 0x63, 0xdf, 0x98, 0x28, 0x35, 0xbb,
+    0x6c, 0xc1, 0x6d, 0xea, 0xbb, 0x76, 0x4c, 0xcd, 0x94, 0x61, 0x54, 0xcd, 0x0a, 0xf9, 0xaa, 0x57,
+    0xc8, 0x4d, 0x60, 0x26, 0x49, 0xd0, 0x26, 0x09, 0x18, 0xb5, 0x73, 0xdd, 0xce, 0x6e, 0x7b, 0xc9,
+    0xec, 0xba, 0xe6, 0x60, 0x55, 0x37, 0xdd, 0x11, 0x0e, 0x4d, 0x81, 0xc1, 0x7c, 0xb5, 0x3b, 0x70,
+    0x05, 0x7d, 0xaf, 0x70, 0xf7, 0x11, 0x9b, 0xc3, 0x81, 0x17, 0x75, 0xca, 0xf6, 0xfb, 0xfd, 0xa0,
+    0xb1, 0x43, 0xef, 0xb3, 0x4b, 0xcb, 0x4b, 0x37, 0x3d, 0x17, 0x57, 0x43, 0x5b, 0x84, 0xc6, 0xf3,
+    0xa5, 0x6e, 0x56, 0x71, 0x25, 0xa4, 0x8e, 0x4d, 0xc9, 0x59, 0xdd, 0x27, 0xe7, 0x0a, 0x1a, 0x87,
+    0x93, 0x95, 0xdb, 0x92, 0x53, 0x96, 0x81, 0x88, 0x0e, 0xa9, 0xe3, 0xd8, 0xba, 0x14, 0xb0, 0x1e,
+    0x88, 0xdb, 0x08, 0xcd, 0x3a, 0x61, 0x44, 0xb4, 0x9b, 0x3d, 0xde, 0x84, 0x09, 0x3d, 0xae, 0xfa,
+    0xc9, 0xea, 0x3f, 0xba, 0x3b, 0xcf, 0xb2, 0xbb, 0xbd, 0x3f, 0xa2, 0x0d, 0xac, 0xd5, 0xd1, 0x78,
+    0x78, 0x63, 0x68, 0x20, 0xb0, 0x1d, 0xd4, 0xe3, 0x7b, 0x98, 0xe1, 0xcd, 0xb2, 0x6b, 0xa4, 0xa4,
+    0x90, 0x9c, 0x64, 0xca, 0xcc, 0xbb, 0xb7, 0xa3, 0xa9, 0xe2, 0x69, 0x84, 0x1e, 0x4e, 0xfc, 0x5c,
+    0xef, 0xe1, 0x75, 0x34, 0x5d, 0x60, 0xf5, 0x80, 0xf8, 0x6b, 0xe1, 0x43, 0xad, 0xda, 0x0d, 0xc0,
+    0xc4, 0x0f, 0xaa, 0x47, 0xe8, 0xc4, 0x15, 0xb0, 0x16, 0x2d, 0xb0, 0xad, 0xeb, 0x56, 0x98, 0x06,
+    0xe1, 0x99, 0xde, 0x91, 0x66, 0x85, 0xd5, 0x98, 0xf5, 0x3b, 0xe7, 0xdf, 0x2b, 0x86, 0xd1, 0xce,
+    0xb3, 0x99, 0x0b, 0x5a, 0xd0, 0x24, 0xa4, 0xb7, 0x12, 0x80, 0xc2, 0xcf, 0x09, 0x51, 0xc4, 0x77,
+    0x95, 0xe0, 0x43, 0xdd, 0x26, 0xb7, 0x5f, 0x9e, 0x53, 0x02, 0xeb, 0xe0, 0xf3, 0xdf, 0x4d, 0x2d,
+    0xcf, 0x5a, 0xd3, 0xae, 0x93, 0x5a, 0x5c, 0xc6, 0x8f, 0x9d, 0xb5, 0xfe, 0x03, 0x8b, 0xcf, 0xf7,
+    0x4c, 0xbd, 0xc9, 0x19, 0x7a, 0x77, 0xf1, 0x69, 0xcd, 0xba, 0x37, 0x8d, 0xde, 0x1f, 0x3a, 0xf7,
+    0xb7, 0x94, 0xf1, 0x1a, 0xa4, 0xf5, 0x66, 0x4c, 0xda, 0x79, 0xa0, 0x7f, 0x40, 0x19, 0xdc, 0xb2,
+    0x4e, 0xb3, 0xeb, 0x4d, 0xaa, 0xb6, 0x37, 0x7c, 0xec, 0xaa, 0xf7, 0xd2, 0x6c, 0x65, 0xd7, 0x76,
+    0x18, 0xbf, 0x20, 0x1b, 0x58, 0x0d, 0xe8, 0x34, 0xe3, 0x17, 0xff, 0x56, 0x77, 0xbf, 0xda, 0x40,
+    0x70, 0xc3, 0x15, 0x4f, 0xa7, 0x39, 0x6d, 0xcd, 0xf2, 0x3b, 0x58, 0x3e, 0xdb, 0x6c, 0xa1, 0xf1,
+    0x8d, 0xea, 0xee, 0x88, 0x9b, 0x59, 0x94, 0x1b, 0xf5, 0x3e, 0x2c, 0xfc, 0x29, 0xef, 0x82, 0x2c,
+    0xa3, 0x29, 0x98, 0xbf, 0x19, 0xc0, 0xa0, 0xc1, 0xfe, 0x80, 0x5b, 0xa3, 0xf0, 0x7d, 0xee, 0x31,
+    0x56, 0x1d, 0x7b, 0xe7, 0x8a, 0x71, 0x8f, 0xbf, 0xb9, 0x6d, 0xd4, 0xd7, 0xe9, 0x94, 0x73, 0x75,
+    0xf7, 0xbe, 0x3e, 0xb8, 0xa3, 0x7e, 0xef, 0x55, 0x62, 0xd7, 0xac, 0x35, 0xbf, 0xbe, 0xd1, 0x5b,
+    0x2a, 0x48, 0x4e, 0xa5, 0xbb, 0xa1, 0x69, 0x5d, 0xe8, 0x49, 0xff, 0x49, 0x04, 0x23, 0xf4, 0x64,
+    0x1e, 0x7b, 0x6d, 0x45, 0xc2, 0x28, 0xa6, 0x0b, 0x6c, 0x64, 0x42, 0xd6, 0x01, 0xc1, 0x4c, 0xdd,
+    0x4c, 0xd4, 0x35, 0xe5, 0x1b, 0xfc, 0x0f, 0xef, 0xb0, 0xd9, 0xe9, 0x39, 0xe0, 0x0c, 0x2d, 0xa7,
+    0xb6, 0x26, 0xa7, 0x09, 0x23, 0xde, 0x42, 0x23, 0xcc, 0xdd, 0x6c, 0xb7, 0x7a, 0xdb, 0x5b, 0x1a,
+    0x81, 0xa3, 0xad, 0xff, 0x1e, 0x66, 0x07, 0xc5, 0x04, 0xe3, 0x81, 0xaa, 0xf8, 0x64, 0x35, 0xe9,
+    0x3c, 0xb4, 0xa3, 0xb5, 0xbd, 0x44, 0x23, 0x7b, 0x3d, 0x9e, 0xa8, 0xd4, 0x36, 0xe2, 0x86, 0x7b,
+    0x34, 0xfb, 0x3f, 0x6a, 0xc9, 0xb7, 0x87, 0xff, 0x00, 0x8c, 0xee, 0x84, 0xb2, 0x6f, 0x14, 0x00,
+    0x00,
+};
+
+// /index.html (1269 octets compressés)
+constexpr uint8_t kAsset2[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x57, 0xcd, 0x6e, 0x1b, 0x37,
+    0x10, 0xbe, 0xfb, 0x29, 0x58, 0x1e, 0xea, 0x4b, 0x25, 0x41, 0x86, 0x9b, 0x26, 0xe8, 0x4a, 0x40,
+    0xe0, 0x9f, 0xc6, 0x85, 0x83, 0x1a, 0xb0, 0xda, 0xa2, 0xa7, 0x80, 0x5a, 0x8e, 0x56, 0xb4, 0xb9,
+    0xe4, 0x86, 0xe4, 0xca, 0x56, 0x4f, 0x79, 0x86, 0xf6, 0xd6, 0x4b, 0x8a, 0x1e, 0x0a, 0xe7, 0xde,
+    0x73, 0x2f, 0x7a, 0x93, 0x3c, 0x41, 0x1e, 0xa1, 0x43, 0x72, 0x57, 0xfb, 0x23, 0xb5, 0xd5, 0x49,
+    0x4b, 0x0e, 0x67, 0xf8, 0xcd, 0xc7, 0x6f, 0x86, 0x54, 0xf2, 0xd9, 0xf9, 0x77, 0x67, 0xb3, 0x9f,
+    0x6e, 0x2e, 0xc8, 0xd2, 0xe5, 0x72, 0x7a, 0x94, 0xf8, 0x1f, 0x22, 0x99, 0xca, 0x26, 0x74, 0x61,
+    0xe8, 0xf4, 0x88, 0x90, 0x64, 0x09, 0x8c, 0xfb, 0x0f, 0xfc, 0xcc, 0xc1, 0x31, 0x92, 0x2e, 0x99,
+    0xb1, 0xe0, 0x26, 0xf4, 0xfb, 0xd9, 0xe5, 0xe0, 0x39, 0x25, 0xa3, 0xca, 0xe8, 0x84, 0x93, 0x30,
+    0xbd, 0x75, 0x2c, 0x83, 0xb3, 0x12, 0xc8, 0xc7, 0x77, 0x7f, 0x90, 0x33, 0xad, 0x9c, 0xd9, 0xfc,
+    0x25, 0x81, 0xc8, 0x32, 0x17, 0x9b, 0x27, 0x03, 0xc9, 0x28, 0x2e, 0x6b, 0xc5, 0x53, 0x2c, 0x87,
+    0x09, 0x5d, 0x09, 0x78, 0x28, 0xb4, 0x71, 0x94, 0xa4, 0xe8, 0x04, 0x0a, 0xe3, 0x3f, 0x08, 0xee,
+    0x96, 0x13, 0x0e, 0x2b, 0x91, 0xc2, 0x20, 0x0c, 0xbe, 0x20, 0x42, 0x09, 0x27, 0x98, 0x1c, 0xd8,
+    0x94, 0x49, 0x98, 0x8c, 0x9b, 0xdd, 0xa5, 0x50, 0xf7, 0xc4, 0x80, 0x9c, 0x50, 0xeb, 0xd6, 0x12,
+    0xec, 0x12, 0x00, 0x63, 0x2d, 0x0d, 0x2c, 0xaa, 0x99, 0x21, 0x3f, 0x3d, 0xe1, 0xf0, 0xe5, 0xc9,
+    0x8b, 0xf1, 0x78, 0x98, 0x5a, 0x5b, 0x79, 0x26, 0xa3, 0x3a, 0xbd, 0x64, 0xae, 0xf9, 0xba, 0xc6,
+    0xc5, 0x84, 0x22, 0xa9, 0x64, 0xd6, 0x4e, 0xa8, 0x87, 0x83, 0x43, 0x30, 0x94, 0x18, 0x8d, 0x7b,
+    0x52, 0x6f, 0xa4, 0x84, 0x19, 0xc1, 0x06, 0x92, 0xcd, 0x41, 0x4a, 0xe0, 0xf3, 0xf5, 0x84, 0xb2,
+    0xa2, 0x98, 0xf9, 0xd4, 0x68, 0x8c, 0x51, 0x11, 0x07, 0xa6, 0x8e, 0x83, 0xf6, 0x41, 0x9c, 0xd9,
+    0xae, 0xf0, 0x6b, 0xc6, 0x44, 0xf0, 0xb6, 0x73, 0xcd, 0x1f, 0x02, 0x1b, 0xb7, 0xd6, 0x15, 0x75,
+    0x18, 0x5b, 0xce, 0x5d, 0x5c, 0x79, 0x23, 0xa4, 0xf6, 0x8b, 0x89, 0xdd, 0x7c, 0x48, 0x4b, 0x23,
+    0xf0, 0x87, 0x70, 0xb0, 0x64, 0xa5, 0xd7, 0x4c, 0x39, 0x8b, 0xdf, 0xc4, 0xa6, 0x9b, 0x27, 0x85,
+    0xa1, 0x8a, 0x2d, 0xa6, 0x51, 0x84, 0x30, 0x3d, 0xaa, 0x27, 0x2c, 0xa4, 0x4e, 0x68, 0xb5, 0xdd,
+    0xa9, 0xc9, 0x5a, 0x45, 0xcb, 0xa0, 0x60, 0x0a, 0x24, 0xdd, 0x2e, 0xf0, 0x70, 0x1b, 0xeb, 0x4d,
+    0xd7, 0x18, 0x19, 0xb2, 0x8e, 0xb9, 0xd2, 0x36, 0xb3, 0x91, 0x2b, 0xb1, 0x42, 0x53, 0xa1, 0xa5,
+    0x70, 0x50, 0x9b, 0x5a, 0x09, 0x5a, 0xdc, 0x66, 0x9b, 0x63, 0xf0, 0x1f, 0x08, 0xc5, 0x45, 0xca,
+    0x9c, 0x36, 0xa4, 0x3f, 0x31, 0x18, 0x14, 0x80, 0xdf, 0x2a, 0xa3, 0x3d, 0x38, 0x57, 0xf5, 0x0a,
+    0x3a, 0x4d, 0x46, 0x3e, 0x64, 0x6b, 0x07, 0x2e, 0x56, 0xcd, 0xc8, 0xef, 0xe8, 0x8c, 0x56, 0x59,
+    0x2f, 0xc0, 0xb5, 0x3f, 0x51, 0x3a, 0x3d, 0xf3, 0x13, 0x8f, 0x38, 0x26, 0x80, 0xa8, 0x74, 0x69,
+    0xec, 0xc7, 0x77, 0x7f, 0x62, 0xc4, 0xe0, 0xd2, 0x89, 0x52, 0xf4, 0x02, 0x9c, 0xa3, 0xa4, 0x85,
+    0x44, 0x79, 0x75, 0x73, 0xe1, 0xd5, 0x74, 0xdb, 0x97, 0x90, 0x19, 0xea, 0x9c, 0x39, 0x24, 0x86,
+    0xf0, 0x63, 0x5d, 0xae, 0xc0, 0xb8, 0xd2, 0xe0, 0x77, 0x49, 0x7e, 0x84, 0xf9, 0xad, 0x4e, 0xef,
+    0xc1, 0xb5, 0x0e, 0x17, 0x11, 0xb4, 0x37, 0x6e, 0x0e, 0xd5, 0x0f, 0x5a, 0xc9, 0x21, 0xcc, 0x08,
+    0x65, 0xe7, 0x90, 0x6b, 0x4c, 0x4e, 0xdf, 0x83, 0x1a, 0xa4, 0xcc, 0xf0, 0x3d, 0x3a, 0x0e, 0xc6,
+    0xae, 0x92, 0x23, 0x79, 0xbb, 0xde, 0x6f, 0xde, 0xec, 0x08, 0xda, 0x4b, 0xfa, 0x24, 0x50, 0xd2,
+    0x8e, 0xf3, 0xb2, 0x74, 0x4b, 0x4c, 0x55, 0x2c, 0xfc, 0xe1, 0x20, 0x10, 0x94, 0xe1, 0x49, 0x8f,
+    0xc5, 0x43, 0xe8, 0xc2, 0x53, 0x59, 0x88, 0x0c, 0x29, 0xfa, 0x99, 0x60, 0x4b, 0xb9, 0x03, 0x87,
+    0x29, 0x15, 0xcc, 0x60, 0x11, 0xa0, 0xf4, 0x0b, 0x3c, 0xa5, 0x2d, 0x5b, 0x58, 0x76, 0xd8, 0x03,
+    0x08, 0x96, 0x15, 0x48, 0x4b, 0x5e, 0xde, 0x5c, 0x11, 0xa4, 0x72, 0x4b, 0xea, 0xf0, 0x20, 0x1e,
+    0x71, 0xb8, 0xd0, 0x26, 0x6f, 0x92, 0xb9, 0xc4, 0x11, 0x12, 0x56, 0x3a, 0x9d, 0xea, 0xbc, 0x90,
+    0xe0, 0x50, 0xcf, 0x7a, 0xb1, 0xe8, 0x66, 0x1f, 0xa8, 0x24, 0xe8, 0x58, 0x39, 0x5d, 0xa9, 0xa2,
+    0x74, 0x74, 0xfa, 0x6d, 0x00, 0xcb, 0x8f, 0x59, 0x8a, 0x25, 0x69, 0x93, 0x51, 0x58, 0xd6, 0x71,
+    0xdc, 0x61, 0x78, 0x21, 0x40, 0xf2, 0x1e, 0x03, 0x89, 0xf0, 0xe1, 0x3a, 0x53, 0x84, 0xb8, 0x75,
+    0xe1, 0x2b, 0x0b, 0x5d, 0x1f, 0x34, 0x1e, 0x69, 0xcf, 0xba, 0x85, 0x1f, 0x91, 0xf4, 0xac, 0xb1,
+    0xf9, 0x06, 0x7b, 0xdf, 0x64, 0xe0, 0x6d, 0x29, 0x0c, 0xf0, 0xde, 0x74, 0x2e, 0x94, 0x04, 0x95,
+    0x61, 0x67, 0xa6, 0xcf, 0xfa, 0x2e, 0x41, 0x4c, 0xd8, 0x83, 0x52, 0x23, 0xe6, 0x2d, 0x35, 0xbd,
+    0x02, 0x59, 0x74, 0x97, 0x8e, 0x7a, 0x69, 0xcd, 0x4b, 0xe7, 0xf9, 0x89, 0x99, 0x60, 0x8b, 0xcb,
+    0x85, 0x6b, 0x2a, 0x08, 0xb0, 0xba, 0x38, 0x33, 0x6b, 0x3a, 0x7d, 0x0d, 0xce, 0x61, 0x81, 0x6c,
+    0x7e, 0x27, 0x77, 0x78, 0xda, 0xc9, 0x28, 0xba, 0x75, 0x68, 0x1c, 0xf5, 0xcb, 0xbc, 0x68, 0x18,
+    0x08, 0x38, 0x0e, 0x53, 0x5a, 0x2d, 0x2f, 0xb0, 0x58, 0x82, 0x78, 0xe0, 0xf7, 0xa8, 0x30, 0xa9,
+    0xfd, 0xa5, 0x93, 0xa3, 0x90, 0x09, 0x67, 0xca, 0x37, 0x5a, 0x0f, 0x46, 0xb1, 0x95, 0xc8, 0x98,
+    0x83, 0xd2, 0xfc, 0x87, 0xac, 0xbc, 0x90, 0x0e, 0xaf, 0xcf, 0xb4, 0x84, 0x41, 0x66, 0x04, 0xaf,
+    0xba, 0x5b, 0x09, 0xdf, 0x84, 0x41, 0x53, 0xaa, 0x13, 0x7a, 0x2d, 0xac, 0x83, 0xd0, 0xee, 0xd1,
+    0x8c, 0xbd, 0x5e, 0xd8, 0x42, 0x2b, 0x31, 0x47, 0xd1, 0x87, 0xce, 0xd7, 0xdf, 0xc0, 0x01, 0x0a,
+    0x16, 0x41, 0xd6, 0x01, 0x67, 0xd5, 0xb8, 0x5d, 0xe2, 0x58, 0x48, 0x22, 0xc5, 0xba, 0x6a, 0x40,
+    0xf4, 0xea, 0xba, 0xba, 0x39, 0x3a, 0x07, 0x87, 0x75, 0xdc, 0x2f, 0xe6, 0x5e, 0x33, 0xf7, 0xc9,
+    0x54, 0x17, 0xc2, 0x9e, 0x8b, 0x60, 0x7a, 0xa5, 0x58, 0xea, 0x3b, 0x60, 0xbf, 0x5d, 0xb7, 0xef,
+    0xaa, 0x7e, 0x79, 0x4d, 0x67, 0xf0, 0x88, 0xb9, 0xb0, 0x05, 0xf6, 0x93, 0xe5, 0xe6, 0xc3, 0xbe,
+    0x6a, 0x72, 0xb8, 0x82, 0x19, 0x60, 0x1d, 0x5c, 0x46, 0x3f, 0x20, 0xa0, 0x93, 0xae, 0x14, 0x73,
+    0xf6, 0xb8, 0xd5, 0xf3, 0x69, 0xd7, 0x84, 0x14, 0xa5, 0xb0, 0xd4, 0x12, 0x41, 0x4c, 0xe8, 0x05,
+    0x3e, 0x65, 0x62, 0xe3, 0x71, 0x61, 0x77, 0x67, 0x50, 0x03, 0xb9, 0xb0, 0x5e, 0x8d, 0xf2, 0x38,
+    0x62, 0x41, 0x11, 0xb4, 0x23, 0x20, 0x35, 0x35, 0x8e, 0xc3, 0xba, 0xdd, 0xb3, 0x53, 0x82, 0x7d,
+    0x15, 0x09, 0xf1, 0x4f, 0x25, 0xeb, 0xa1, 0x89, 0xbc, 0xcc, 0x87, 0x1d, 0x31, 0x75, 0x5b, 0x85,
+    0x67, 0x97, 0x85, 0xc3, 0xee, 0x4b, 0xb8, 0x5b, 0x53, 0x71, 0x40, 0x51, 0xb8, 0x8e, 0x55, 0x0e,
+    0xb8, 0x3d, 0x5b, 0xe1, 0x09, 0x7c, 0x7a, 0xff, 0xcb, 0xdf, 0xe4, 0x42, 0x19, 0xc8, 0x50, 0x53,
+    0x06, 0xf6, 0x96, 0xd5, 0x41, 0xe1, 0x9c, 0x11, 0x59, 0xe6, 0xdf, 0x49, 0x15, 0xb6, 0xc2, 0x88,
+    0x3c, 0x94, 0x6d, 0xaf, 0x4b, 0x7c, 0x7a, 0xff, 0xdb, 0x13, 0x39, 0xc7, 0x4e, 0x8d, 0xbc, 0x23,
+    0x67, 0xa6, 0xbb, 0xcf, 0xff, 0x17, 0x75, 0x32, 0xaa, 0xa4, 0xda, 0x54, 0x54, 0xad, 0xef, 0x7f,
+    0x2d, 0x29, 0xa9, 0xb3, 0xea, 0x21, 0xb3, 0x7b, 0xe3, 0xa1, 0x6d, 0xe7, 0xbe, 0xdb, 0x23, 0xbd,
+    0xea, 0x5e, 0x6b, 0x56, 0xbf, 0x42, 0xbe, 0xb4, 0x11, 0x6f, 0xc3, 0x63, 0xad, 0x7b, 0x9f, 0xed,
+    0x25, 0x2b, 0xd4, 0x9e, 0x04, 0x66, 0xae, 0x75, 0xb6, 0xaf, 0xbb, 0xfd, 0x20, 0xf8, 0x3e, 0xf6,
+    0x77, 0xeb, 0x20, 0x29, 0x65, 0x08, 0x06, 0x2b, 0xec, 0x45, 0xed, 0x60, 0x3e, 0x4b, 0x89, 0xa8,
+    0xf6, 0x56, 0x5a, 0x32, 0x2a, 0xe5, 0x9e, 0x1e, 0x14, 0x87, 0xfe, 0x51, 0x5b, 0x91, 0x87, 0xb7,
+    0x9e, 0x76, 0xdd, 0x77, 0x6b, 0x9c, 0x69, 0x5e, 0xb6, 0x36, 0x67, 0xb2, 0x55, 0x6f, 0x97, 0xc2,
+    0xe4, 0x0f, 0xa8, 0x72, 0xd2, 0x7a, 0xfc, 0xff, 0x4a, 0x6e, 0x9b, 0x67, 0xe9, 0xe7, 0x2c, 0x2f,
+    0xbe, 0x26, 0xb6, 0x2c, 0xc0, 0xac, 0xfc, 0xc4, 0xb0, 0x81, 0xd1, 0x44, 0xf2, 0x5d, 0xd2, 0x6f,
+    0x53, 0xc3, 0xf0, 0xb7, 0x48, 0x81, 0xdd, 0xd7, 0xa4, 0x01, 0xc4, 0x90, 0x8d, 0xd3, 0xe7, 0x5f,
+    0xf1, 0xf9, 0xe9, 0x0b, 0x36, 0xbc, 0xc3, 0x5e, 0x12, 0xb9, 0xcd, 0x35, 0x2f, 0x65, 0x48, 0x2e,
+    0x2e, 0x8f, 0x6f, 0xfa, 0xf8, 0x94, 0x47, 0xe2, 0xc2, 0x9f, 0x9a, 0x7f, 0x00, 0x54, 0x0f, 0xff,
+    0x5c, 0xe5, 0x0c, 0x00, 0x00,
+};
+
+// /wifi.html (1332 octets compressés)
+constexpr uint8_t kAsset3[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x56, 0xcd, 0x6e, 0x1b, 0x37,
+    0x10, 0xbe, 0xfb, 0x29, 0xa6, 0x9b, 0xb4, 0x2b, 0x01, 0x5e, 0x49, 0x71, 0xda, 0x34, 0x50, 0x24,
+    0x15, 0x88, 0x6c, 0xa3, 0x01, 0xf2, 0x87, 0xd8, 0x41, 0xd0, 0x53, 0x4d, 0x2d, 0x47, 0x12, 0xe3,
+    0x5d, 0x72, 0x43, 0x72, 0x25, 0x39, 0x8e, 0x8e, 0x3d, 0xf6, 0xd6, 0x63, 0x81, 0x9e, 0xf3, 0x1c,
+    0x79, 0x93, 0x3e, 0x41, 0x1f, 0xa1, 0x43, 0x72, 0x7f, 0x24, 0x3b, 0xce, 0x45, 0x2b, 0xce, 0xff,
+    0xcf, 0x37, 0x43, 0x8e, 0xbe, 0x3b, 0x7e, 0x35, 0x3d, 0xff, 0xed, 0xf5, 0x09, 0x2c, 0x6d, 0x9e,
+    0x4d, 0x0e, 0x46, 0xee, 0x03, 0x19, 0x93, 0x8b, 0x71, 0x34, 0xd7, 0x91, 0x23, 0x20, 0xe3, 0x93,
+    0x03, 0x80, 0x51, 0x8e, 0x96, 0x41, 0xba, 0x64, 0xda, 0xa0, 0x1d, 0x47, 0x6f, 0xcf, 0x4f, 0x93,
+    0xc7, 0x91, 0x67, 0x58, 0x61, 0x33, 0x9c, 0x4c, 0x95, 0x9c, 0x8b, 0x45, 0xa9, 0x99, 0x15, 0x4a,
+    0xc2, 0x3b, 0x91, 0x9c, 0x8a, 0x51, 0x3f, 0xb0, 0x1a, 0x6d, 0xc9, 0x72, 0x1c, 0x47, 0x2b, 0x81,
+    0xeb, 0x42, 0x69, 0x1b, 0x41, 0xaa, 0xa4, 0x45, 0x49, 0xd6, 0xd6, 0x82, 0xdb, 0xe5, 0x98, 0xe3,
+    0x4a, 0xa4, 0x98, 0xf8, 0xc3, 0x21, 0x08, 0x29, 0xac, 0x60, 0x59, 0x62, 0x52, 0x96, 0xe1, 0xf8,
+    0x41, 0xf0, 0x65, 0xec, 0x55, 0x30, 0x08, 0x30, 0x53, 0xfc, 0x0a, 0xae, 0xfd, 0x5f, 0x80, 0x39,
+    0x59, 0x4a, 0xe6, 0x2c, 0x17, 0xd9, 0xd5, 0x10, 0x0c, 0x93, 0x26, 0x31, 0xa8, 0xc5, 0xfc, 0x49,
+    0xc5, 0xce, 0xd9, 0x26, 0x98, 0x1d, 0xc2, 0x8f, 0x83, 0x41, 0xb1, 0x69, 0xe9, 0x7a, 0x21, 0xe4,
+    0x10, 0x8e, 0x30, 0x07, 0x56, 0x5a, 0x55, 0xd3, 0x0b, 0xc6, 0xb9, 0x90, 0x8b, 0x21, 0x3c, 0xc0,
+    0x3c, 0xd0, 0xb6, 0xfe, 0x77, 0x79, 0xd4, 0x78, 0xb4, 0xb8, 0xb1, 0x09, 0xcb, 0xc4, 0x82, 0xd4,
+    0x53, 0x4a, 0x02, 0xf5, 0xae, 0x60, 0xc6, 0x66, 0x98, 0xed, 0x47, 0xb7, 0x46, 0xb1, 0x58, 0xda,
+    0x21, 0xc5, 0x9d, 0xf1, 0x7d, 0xff, 0x89, 0x55, 0xc5, 0x8e, 0x2b, 0x00, 0x2e, 0x4c, 0x91, 0x31,
+    0xca, 0x64, 0x96, 0xa9, 0xf4, 0x72, 0xd7, 0xae, 0x90, 0x45, 0x69, 0x0f, 0xc1, 0x60, 0x86, 0x29,
+    0x7d, 0x67, 0xa5, 0xb5, 0x54, 0xed, 0xda, 0x4f, 0x95, 0xe2, 0x83, 0xc1, 0xe0, 0xfb, 0x5b, 0x99,
+    0x0c, 0x7a, 0x8f, 0x5b, 0x07, 0xbb, 0x7e, 0x07, 0xbd, 0x87, 0xb7, 0x18, 0x33, 0x45, 0x76, 0xf3,
+    0xbd, 0x98, 0x66, 0x4a, 0x73, 0xd4, 0x44, 0x2a, 0x36, 0x60, 0x54, 0x26, 0x38, 0xdc, 0x4b, 0xd3,
+    0x74, 0x9f, 0x9b, 0x68, 0xc6, 0x45, 0x69, 0x86, 0xf0, 0xa8, 0x2d, 0xb1, 0xcf, 0xdd, 0x88, 0x8f,
+    0x78, 0xab, 0x98, 0x37, 0x82, 0x9f, 0xb1, 0xf4, 0x72, 0xa1, 0x55, 0x29, 0x79, 0x92, 0xaa, 0x4c,
+    0x91, 0xab, 0x7b, 0x83, 0xc1, 0xcf, 0xb3, 0x79, 0xd3, 0xc4, 0x8a, 0xba, 0x5e, 0x0a, 0x8b, 0x0d,
+    0xad, 0xd4, 0xc6, 0x11, 0x0b, 0x25, 0x6e, 0xb6, 0x20, 0x98, 0x1f, 0x2e, 0xd5, 0x0a, 0xf5, 0xb7,
+    0x9d, 0xfc, 0xf4, 0x68, 0xf6, 0xb0, 0xd5, 0x1c, 0xf5, 0x2b, 0x90, 0x8d, 0xfa, 0x01, 0xfb, 0x23,
+    0x87, 0x34, 0x8f, 0xbe, 0xe5, 0x91, 0x83, 0xb9, 0xc4, 0xcd, 0x0e, 0xc4, 0x89, 0x76, 0xe0, 0x78,
+    0x73, 0xa5, 0x73, 0x10, 0xdc, 0x61, 0x79, 0x2e, 0x4e, 0xe9, 0x10, 0x05, 0x98, 0x8e, 0x02, 0x14,
+    0x88, 0x3d, 0x8e, 0x08, 0xca, 0x32, 0x9a, 0xbc, 0xf9, 0xf2, 0xd9, 0x20, 0x2b, 0x37, 0xc0, 0xbf,
+    0x7c, 0xb6, 0xd4, 0x46, 0x3a, 0x8e, 0xfa, 0x5e, 0xaa, 0xd2, 0x08, 0xdd, 0xf5, 0xc6, 0xbc, 0x06,
+    0x28, 0x49, 0x73, 0x27, 0x17, 0x34, 0x3b, 0x5c, 0xa5, 0x65, 0x4e, 0x68, 0xeb, 0x2d, 0xd0, 0x9e,
+    0x64, 0xe8, 0xfe, 0x3e, 0xbd, 0x7a, 0xc6, 0x3b, 0xb1, 0x31, 0x82, 0xc7, 0xdd, 0xde, 0x8a, 0x65,
+    0x25, 0xc2, 0x18, 0xec, 0x52, 0x98, 0x70, 0xa8, 0xc2, 0x20, 0xb3, 0xaa, 0xf0, 0xa3, 0x49, 0xe0,
+    0x62, 0xb3, 0x0c, 0x79, 0x05, 0x22, 0xe4, 0x93, 0xff, 0xfe, 0xf9, 0xeb, 0x4f, 0x98, 0x66, 0xe2,
+    0x43, 0x89, 0x1f, 0xc1, 0x94, 0x1a, 0xa2, 0x33, 0x72, 0x2b, 0x51, 0x47, 0xa3, 0x7e, 0x50, 0xaa,
+    0x02, 0xeb, 0x07, 0x95, 0xea, 0x54, 0xf5, 0xcf, 0x5e, 0x15, 0x14, 0x58, 0x38, 0xf8, 0x50, 0x33,
+    0x91, 0x5e, 0x86, 0xc8, 0xdf, 0x89, 0x53, 0xd1, 0xe9, 0x46, 0xc1, 0x41, 0x65, 0x13, 0x32, 0x34,
+    0xa0, 0xab, 0x12, 0x8c, 0xfa, 0x41, 0xcf, 0x97, 0xf0, 0x46, 0xad, 0x28, 0xa1, 0x68, 0xf2, 0x52,
+    0xe5, 0xc0, 0xcb, 0x50, 0x6b, 0xe8, 0x9c, 0x9d, 0x3d, 0x3b, 0xee, 0xee, 0xd7, 0xca, 0x0f, 0x44,
+    0x15, 0x83, 0x1b, 0xc9, 0x28, 0x94, 0xcd, 0x29, 0x57, 0xeb, 0x26, 0xfc, 0xd7, 0xf8, 0xa1, 0x14,
+    0x9a, 0x92, 0xbd, 0xed, 0xa9, 0x60, 0xc6, 0xac, 0x09, 0xbf, 0xd1, 0xe4, 0x85, 0xb2, 0xc0, 0x11,
+    0x1c, 0x01, 0xef, 0x76, 0xd3, 0xc8, 0x7b, 0x57, 0xed, 0x29, 0xb8, 0x6b, 0xcf, 0x37, 0x5d, 0xee,
+    0xd5, 0xcb, 0x94, 0xb3, 0x5c, 0xd8, 0x68, 0xf2, 0xef, 0xdf, 0x7f, 0xc0, 0x19, 0x2b, 0x57, 0xb8,
+    0x60, 0x6e, 0x82, 0x00, 0x2d, 0xe9, 0x11, 0x30, 0x68, 0x10, 0x35, 0xea, 0xb6, 0x3e, 0xae, 0xfa,
+    0x0e, 0x62, 0x01, 0x6c, 0x26, 0xd5, 0xa2, 0xa8, 0xfa, 0xd0, 0xef, 0x43, 0xdf, 0x15, 0xdb, 0x15,
+    0xb5, 0x50, 0x92, 0xc3, 0xd1, 0xe0, 0x08, 0xd8, 0x0a, 0x53, 0x28, 0x25, 0xbc, 0x47, 0xef, 0x92,
+    0x49, 0x0b, 0xd4, 0x5d, 0xaa, 0x3d, 0x4d, 0x00, 0x6d, 0x16, 0xb6, 0x40, 0x60, 0xe6, 0x8a, 0x60,
+    0xa5, 0x95, 0x44, 0x90, 0x31, 0x1a, 0xeb, 0xd2, 0xa6, 0xad, 0xa6, 0x73, 0x21, 0xbf, 0x7c, 0xee,
+    0x79, 0xd3, 0x5e, 0x04, 0xe6, 0xa5, 0x4c, 0x3d, 0x72, 0xe6, 0x68, 0xd3, 0xe5, 0x4b, 0xb4, 0x94,
+    0xde, 0xa5, 0xe9, 0x74, 0x9b, 0xa1, 0xca, 0x7c, 0xd0, 0x86, 0x9c, 0x1b, 0x87, 0x3d, 0xb6, 0x66,
+    0xc2, 0x06, 0xe1, 0x4e, 0xec, 0x43, 0x8b, 0xbb, 0xf5, 0xbc, 0xd2, 0xf0, 0x52, 0x0c, 0x9d, 0x5a,
+    0xba, 0x67, 0x2c, 0xb3, 0xa5, 0x81, 0xf1, 0x78, 0xec, 0xc2, 0x6e, 0x4d, 0xba, 0x69, 0x97, 0x14,
+    0xd3, 0x35, 0x58, 0x75, 0x89, 0x12, 0xb6, 0x8d, 0xdd, 0x46, 0xf5, 0xbd, 0x51, 0xb2, 0xd3, 0x18,
+    0x86, 0x8a, 0x2d, 0x71, 0x0d, 0xaf, 0xb5, 0xca, 0x85, 0x41, 0xe7, 0x45, 0x65, 0x2b, 0x0a, 0x69,
+    0x42, 0x58, 0xb7, 0xe7, 0x22, 0x47, 0x55, 0xda, 0x9a, 0x7a, 0xe8, 0xd6, 0xe4, 0xa0, 0xbb, 0x63,
+    0xe0, 0x8e, 0x14, 0x2e, 0x7c, 0x0a, 0xbf, 0xf8, 0x38, 0xc6, 0xf7, 0xaf, 0xfd, 0x77, 0x7b, 0xd1,
+    0xe8, 0x6d, 0x0f, 0x6a, 0x6d, 0x5b, 0x6a, 0xf9, 0xf5, 0xf0, 0xb6, 0x07, 0x5f, 0x2b, 0x67, 0x3b,
+    0x21, 0x4d, 0xda, 0x21, 0x69, 0x59, 0x95, 0x78, 0x3f, 0x90, 0xb6, 0xf0, 0x4f, 0xf6, 0xa4, 0xab,
+    0x6d, 0x31, 0x86, 0xbb, 0x77, 0xc3, 0x5e, 0x0b, 0x82, 0x7c, 0x4f, 0xb8, 0x61, 0xfc, 0xf5, 0xfc,
+    0xc5, 0x73, 0xd2, 0x8c, 0xef, 0xde, 0x0d, 0x49, 0x02, 0xd3, 0xa5, 0x12, 0x46, 0x68, 0x07, 0xa7,
+    0x6a, 0x6e, 0x21, 0x49, 0x9a, 0xcd, 0x10, 0xd7, 0x76, 0xeb, 0xa8, 0x7b, 0x04, 0xd3, 0x13, 0x46,
+    0x85, 0x23, 0x82, 0x2b, 0xfd, 0xcd, 0x96, 0x56, 0xae, 0x76, 0xe2, 0x4d, 0x35, 0x32, 0x8b, 0x55,
+    0xc8, 0x9d, 0x38, 0x08, 0xc4, 0x3b, 0x9d, 0x09, 0x94, 0x66, 0xb9, 0x91, 0xe1, 0x9e, 0x9b, 0xea,
+    0x5b, 0x02, 0x6e, 0x01, 0x4c, 0xc3, 0x9b, 0x82, 0xc4, 0x2e, 0xee, 0x5f, 0xd7, 0x92, 0x5b, 0xe8,
+    0x84, 0x83, 0xa6, 0xd3, 0x16, 0xf8, 0xd3, 0xbc, 0x7b, 0xd1, 0x6a, 0x57, 0x15, 0x61, 0x45, 0x81,
+    0x92, 0x4f, 0x09, 0xa1, 0xbc, 0x13, 0x0c, 0xb6, 0x4d, 0xde, 0x6f, 0xe4, 0x9d, 0x95, 0xae, 0x77,
+    0x3f, 0x6d, 0x62, 0xba, 0x77, 0x4f, 0x56, 0xc4, 0x78, 0x2e, 0x0c, 0xc5, 0x83, 0x9a, 0xda, 0xe0,
+    0x47, 0x3e, 0x3e, 0xac, 0x70, 0xd0, 0xc1, 0xee, 0x6e, 0x79, 0xb0, 0x57, 0x68, 0x74, 0x0a, 0xc7,
+    0x38, 0x67, 0x65, 0x66, 0x6f, 0xb5, 0x99, 0xd2, 0xf8, 0x66, 0x93, 0x77, 0x2e, 0x80, 0x7d, 0xcd,
+    0x7a, 0x23, 0x7d, 0x4b, 0xbb, 0x96, 0x69, 0x2d, 0xec, 0x99, 0x20, 0x54, 0xdf, 0x1e, 0x6c, 0xda,
+    0x31, 0xbf, 0xbb, 0x84, 0x29, 0xa3, 0xb6, 0xc7, 0xf4, 0xce, 0x5b, 0x2a, 0x3e, 0x84, 0xf8, 0xf5,
+    0xab, 0xb3, 0xf3, 0xf8, 0xb0, 0xa1, 0xbb, 0xab, 0x14, 0x35, 0x3d, 0x0d, 0xae, 0x21, 0xae, 0x5a,
+    0x94, 0x9c, 0xd3, 0x26, 0x8c, 0x49, 0x94, 0x0a, 0x4f, 0x77, 0x86, 0x7f, 0x38, 0xf6, 0xe9, 0x9d,
+    0xb6, 0x5e, 0x27, 0x6e, 0xd3, 0x25, 0xa5, 0xce, 0x50, 0xa6, 0x8a, 0x23, 0x8f, 0x61, 0xdb, 0x5a,
+    0x72, 0xb7, 0xf1, 0x10, 0x2e, 0x5c, 0xbe, 0x34, 0x8e, 0x41, 0xe2, 0xed, 0x9b, 0x67, 0x53, 0x95,
+    0xd3, 0xe0, 0x39, 0x00, 0x39, 0x4e, 0x77, 0xfb, 0x43, 0x9d, 0xd2, 0xd7, 0x85, 0x6a, 0x6e, 0x77,
+    0x7b, 0xb1, 0xd3, 0xe3, 0xbd, 0xa4, 0xed, 0xc6, 0xee, 0x6e, 0x1d, 0x8f, 0xae, 0xb6, 0x2b, 0xf4,
+    0x28, 0xd5, 0xb6, 0xe3, 0x64, 0x3e, 0x7d, 0x82, 0xe8, 0x4d, 0xbd, 0xb3, 0x69, 0xb3, 0xf6, 0x7a,
+    0xbd, 0x68, 0x67, 0xda, 0x9a, 0xc5, 0xd3, 0xf1, 0xfd, 0xa6, 0x17, 0x9d, 0xcf, 0xb4, 0xa7, 0x31,
+    0x53, 0x8c, 0x77, 0xba, 0x87, 0xf0, 0xd0, 0x2d, 0xa2, 0x0a, 0x60, 0xfe, 0x4b, 0x17, 0x6d, 0xb5,
+    0xe0, 0xe9, 0x02, 0xf0, 0x8f, 0x0f, 0x7a, 0x67, 0xf8, 0xf7, 0xf9, 0xff, 0x8c, 0x5c, 0xba, 0xb7,
+    0xb0, 0x0b, 0x00, 0x00,
+};
+
+}  // namespace
+
+const EmbeddedAsset embeddedAssets[] = {
+    {"/app.a1c87db49a.js", kAsset0, sizeof(kAsset0), "application/javascript", "\"a1c87db49a\"", true},
+    {"/style.d42de52911.css", kAsset1, sizeof(kAsset1), "text/css", "\"d42de52911\"", true},
+    {"/index.html", kAsset2, sizeof(kAsset2), "text/html; charset=utf-8", "\"72d31bffa5\"", false},
+    {"/wifi.html", kAsset3, sizeof(kAsset3), "text/html; charset=utf-8", "\"68e1ff9eae\"", false},
+};
+
+const size_t embeddedAssetCount = sizeof(embeddedAssets) / sizeof(embeddedAssets[0]);
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Interface Web compilée dans le firmware (embedded_assets.cpp, généré par
+// `python3 tools/build_assets.py --embed` après toute modification de data/).
+struct EmbeddedAsset {
+  const char *path;
+  const uint8_t *data;  // Contenu gzip, en flash.
+  size_t length;
+  const char *contentType;
+  const char *etag;  // Entre guillemets, prêt pour l'en-tête ETag.
+  bool immutable;    // Nom à empreinte : mis en cache sans revalidation.
+};
+
+extern const EmbeddedAsset embeddedAssets[];
+extern const size_t embeddedAssetCount;
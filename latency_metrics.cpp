@@ -0,0 +1,156 @@
+#include "latency_metrics.h"
+
+#include <atomic>
+
+#include "config.h"
+#include "cue_timers.h"
+
+namespace {
+
+constexpr size_t kSourceCount = 7;
+constexpr size_t kStageCount = 3;
+
+constexpr const char *kSourceLabels[kSourceCount] = {"websocket", "http", "button", "multicast", "osc",
+                                                    "dmx",       "cuelist"};
+constexpr const char *kStageLabels[kStageCount] = {"led_on", "display_flushed", "broadcast_queued"};
+
+// Bornes supérieures des classes (µs), resserrées sous 10 ms où se jouent les SLA de déclenchement.
+// Une dernière classe implicite reçoit tout ce qui dépasse la dernière borne.
+constexpr uint32_t kBucketBoundsUs[] = {50,    100,   200,   300,    500,    750,    1000,   1500,
+                                        2000,  3000,  5000,  7500,   10000,  15000,  20000,  30000,
+                                        50000, 75000, 100000, 150000, 250000, 500000, 1000000};
+constexpr size_t kBoundCount = sizeof(kBucketBoundsUs) / sizeof(kBucketBoundsUs[0]);
+constexpr size_t kBucketCount = kBoundCount + 1;
+
+// Compteurs incrémentés sans verrou ; une lecture concurrente peut être décalée d'un échantillon.
+struct LatencyHistogram {
+  std::atomic<uint32_t> buckets[kBucketCount];
+
+  void record(uint32_t valueUs) {
+    size_t bucket = 0;
+    while (bucket < kBoundCount && valueUs > kBucketBoundsUs[bucket]) {
+      ++bucket;
+    }
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+LatencyHistogram histograms[kSourceCount][kStageCount];
+
+// État d'une trace : génération (bits 8+), source (bits 4-7) et étapes restant à mesurer (bits 0-2).
+// La génération change à chaque déclenchement, ce qui invalide toute mesure concurrente de l'ancienne trace.
+constexpr uint32_t kPendingMask = (1U << kStageCount) - 1;
+constexpr uint32_t kSourceShift = 4;
+constexpr uint32_t kGenerationStep = 1U << 8;
+
+struct TriggerTrace {
+  std::atomic<uint32_t> state{0};
+  std::atomic<uint32_t> receivedAtUs{0};
+};
+
+TriggerTrace traces[CUE_COUNT];
+
+uint32_t nextGeneration(uint32_t state) {
+  return (state & ~(kGenerationStep - 1)) + kGenerationStep;
+}
+
+// Quantile estimé par interpolation linéaire dans la classe qui contient le rang demandé.
+float estimateQuantileUs(const uint32_t *counts, uint32_t total, float quantile) {
+  const float rank = quantile * static_cast<float>(total);
+  uint32_t cumulative = 0;
+  for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+    if (counts[bucket] == 0) {
+      continue;
+    }
+    const float lower = bucket == 0 ? 0.0f : static_cast<float>(kBucketBoundsUs[bucket - 1]);
+    if (bucket == kBoundCount) {
+      return lower;
+    }
+    if (static_cast<float>(cumulative + counts[bucket]) >= rank) {
+      const float upper = static_cast<float>(kBucketBoundsUs[bucket]);
+      const float position = (rank - static_cast<float>(cumulative)) / static_cast<float>(counts[bucket]);
+      return lower + (upper - lower) * position;
+    }
+    cumulative += counts[bucket];
+  }
+  return 0.0f;
+}
+
+void appendSeries(String &out, size_t source, size_t stage) {
+  uint32_t counts[kBucketCount];
+  uint32_t total = 0;
+  for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+    counts[bucket] = histograms[source][stage].buckets[bucket].load(std::memory_order_relaxed);
+    total += counts[bucket];
+  }
+
+  char line[160];
+  constexpr float kQuantiles[] = {0.5f, 0.95f, 0.99f};
+  for (const float quantile : kQuantiles) {
+    const int length =
+        snprintf(line, sizeof(line), "stagecue_trigger_latency_seconds{stage=\"%s\",source=\"%s\",quantile=\"%g\"} ",
+                 kStageLabels[stage], kSourceLabels[source], static_cast<double>(quantile));
+    if (total == 0) {
+      snprintf(line + length, sizeof(line) - length, "NaN\n");
+    } else {
+      snprintf(line + length, sizeof(line) - length, "%.6f\n",
+               static_cast<double>(estimateQuantileUs(counts, total, quantile)) / 1e6);
+    }
+    out += line;
+  }
+  snprintf(line, sizeof(line), "stagecue_trigger_latency_seconds_count{stage=\"%s\",source=\"%s\"} %lu\n",
+           kStageLabels[stage], kSourceLabels[source], static_cast<unsigned long>(total));
+  out += line;
+}
+
+}  // namespace
+
+uint32_t latencyTimestampUs() {
+  return static_cast<uint32_t>(cueClockUs());
+}
+
+void beginTriggerTrace(size_t index, TriggerSource source, uint32_t receivedAtUs) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+
+  TriggerTrace &trace = traces[index];
+  // Invalide d'abord l'ancienne trace, puis publie l'horodatage avant les étapes en attente.
+  const uint32_t idle = nextGeneration(trace.state.load());
+  trace.state.store(idle);
+  trace.receivedAtUs.store(receivedAtUs);
+  trace.state.store(nextGeneration(idle) | static_cast<uint32_t>(source) << kSourceShift | kPendingMask);
+}
+
+void markTriggerStage(size_t index, LatencyStage stage) {
+  if (index >= CUE_COUNT) {
+    return;
+  }
+
+  const uint32_t bit = 1U << static_cast<uint32_t>(stage);
+  TriggerTrace &trace = traces[index];
+  uint32_t state = trace.state.load();
+  while (state & bit) {
+    const uint32_t receivedAt = trace.receivedAtUs.load();
+    if (trace.state.compare_exchange_weak(state, state & ~bit)) {
+      const size_t source = (state >> kSourceShift) & 0x0F;
+      if (source < kSourceCount) {
+        histograms[source][static_cast<size_t>(stage)].record(latencyTimestampUs() - receivedAt);
+      }
+      return;
+    }
+  }
+}
+
+String buildLatencyMetrics() {
+  String out;
+  out.reserve(kSourceCount * kStageCount * 4 * 110 + 256);
+  out += F("# HELP stagecue_trigger_latency_seconds Délai entre la réception d'un déclenchement et chaque étape.\n");
+  out += F("# TYPE stagecue_trigger_latency_seconds summary\n");
+  for (size_t stage = 0; stage < kStageCount; ++stage) {
+    for (size_t source = 0; source < kSourceCount; ++source) {
+      appendSeries(out, source, stage);
+    }
+  }
+  return out;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Origine d'un déclenchement, utilisée comme label des métriques de latence.
+enum class TriggerSource : uint8_t {
+  WebSocket = 0,
+  Http,
+  Button,
+  Multicast,
+  Osc,
+  Dmx,
+  CueList,
+};
+
+// Étapes mesurées depuis la réception du déclenchement.
+enum class LatencyStage : uint8_t {
+  LedOn = 0,
+  DisplayFlushed,
+  BroadcastQueued,
+};
+
+// Horodatage (µs, 32 bits) à relever au plus tôt : réception de la trame, de la requête ou du front.
+uint32_t latencyTimestampUs();
+// Ouvre une trace pour le cue ; la trace précédente du même cue est abandonnée.
+void beginTriggerTrace(size_t index, TriggerSource source, uint32_t receivedAtUs);
+// Enregistre le temps écoulé jusqu'à `stage` si la trace en cours ne l'a pas encore atteint.
+// Sans verrou : appelable depuis loop(), la tâche AsyncTCP, la tâche d'affichage ou esp_timer.
+void markTriggerStage(size_t index, LatencyStage stage);
+// Quantiles p50/p95/p99 par étape et par source, au format texte Prometheus.
+String buildLatencyMetrics();
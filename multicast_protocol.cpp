@@ -0,0 +1,57 @@
+#include "multicast_protocol.h"
+
+namespace {
+
+uint16_t readU16(const uint8_t *in) {
+  return static_cast<uint16_t>(in[0] | in[1] << 8);
+}
+
+uint32_t readU32(const uint8_t *in) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace
+
+bool decodeMulticastPacket(const uint8_t *data, size_t length, MulticastPacket &packet) {
+  if (data == nullptr || length < MULTICAST_HEADER_SIZE) {
+    return false;
+  }
+  if (data[0] != MULTICAST_MAGIC[0] || data[1] != MULTICAST_MAGIC[1] || data[2] != MULTICAST_MAGIC[2] ||
+      data[3] != MULTICAST_VERSION) {
+    return false;
+  }
+
+  packet.group = readU16(data + 4);
+  packet.entryCount = data[7];
+  packet.sender = readU32(data + 8);
+  packet.sequence = readU32(data + 12);
+  packet.entries = data + MULTICAST_HEADER_SIZE;
+
+  size_t offset = MULTICAST_HEADER_SIZE;
+  for (uint8_t i = 0; i < packet.entryCount; ++i) {
+    if (length - offset < MULTICAST_ENTRY_HEADER_SIZE) {
+      return false;
+    }
+    const size_t textLength = data[offset + MULTICAST_ENTRY_HEADER_SIZE - 1];
+    offset += MULTICAST_ENTRY_HEADER_SIZE;
+    if (length - offset < textLength) {
+      return false;
+    }
+    offset += textLength;
+  }
+  return offset == length;
+}
+
+void readMulticastEntry(const MulticastPacket &packet, size_t &offset, MulticastEntry &entry) {
+  const uint8_t *in = packet.entries + offset;
+  entry.position = readU16(in);
+  entry.actions = in[2];
+  entry.durationMs = readU32(in + 3);
+  entry.textLength = in[7];
+  entry.text = reinterpret_cast<const char *>(in + MULTICAST_ENTRY_HEADER_SIZE);
+  offset += MULTICAST_ENTRY_HEADER_SIZE + entry.textLength;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Déclenchement multicast UDP : un datagramme pilote tous les appareils d'un groupe.
+// -----------------------------------------------------------------------------
+// En-tête (16 octets) : ['S']['C']['M'][version:u8][groupe:u16][réservé:u8][nombre:u8]
+//                       [émetteur:u32][séquence:u32]
+// puis nombre × [position:u16][actions:u8][durée ms:u32][longueur:u8][texte UTF-8].
+// Les champs multi-octets sont codés en little-endian. Le groupe 0 s'adresse à tous les
+// appareils ; une position désigne un emplacement de la scène, que chaque appareil associe à
+// ses cues locaux (multicastCuePositions). L'émetteur peut répéter un même datagramme : la
+// séquence, propre à chaque émetteur, permet d'en écarter les copies.
+
+constexpr uint8_t MULTICAST_MAGIC[3] = {'S', 'C', 'M'};
+constexpr uint8_t MULTICAST_VERSION = 1;
+constexpr uint16_t MULTICAST_ALL_GROUPS = 0;
+constexpr uint16_t MULTICAST_NO_POSITION = 0;
+
+constexpr size_t MULTICAST_HEADER_SIZE = 16;
+constexpr size_t MULTICAST_ENTRY_HEADER_SIZE = 8;
+
+// Actions d'une entrée (combinables : le texte est appliqué avant le déclenchement).
+constexpr uint8_t MULTICAST_ACTION_TRIGGER = 0x01;
+constexpr uint8_t MULTICAST_ACTION_SET_TEXT = 0x02;
+constexpr uint8_t MULTICAST_ACTION_PERSIST = 0x04;
+
+struct MulticastPacket {
+  uint16_t group = 0;
+  uint8_t entryCount = 0;
+  uint32_t sender = 0;
+  uint32_t sequence = 0;
+  const uint8_t *entries = nullptr;  // Pointe dans le datagramme reçu (aucune copie).
+};
+
+struct MulticastEntry {
+  uint16_t position = MULTICAST_NO_POSITION;
+  uint8_t actions = 0;
+  uint32_t durationMs = 0;  // 0 : durée configurée pour le cue.
+  const char *text = nullptr;
+  uint8_t textLength = 0;
+
+  bool trigger() const { return (actions & MULTICAST_ACTION_TRIGGER) != 0; }
+  bool hasText() const { return (actions & MULTICAST_ACTION_SET_TEXT) != 0; }
+  bool persist() const { return (actions & MULTICAST_ACTION_PERSIST) != 0; }
+};
+
+// Valide l'en-tête et toutes les entrées ; un datagramme mal formé est rejeté en entier.
+bool decodeMulticastPacket(const uint8_t *data, size_t length, MulticastPacket &packet);
+// Lit l'entrée située à `offset` d'un paquet validé et avance `offset` sur la suivante.
+void readMulticastEntry(const MulticastPacket &packet, size_t &offset, MulticastEntry &entry);
+
+// Écarte les datagrammes déjà vus (copies redondantes, réordonnancement) en retenant la dernière
+// séquence des Senders émetteurs les plus récents. Les séquences sont comparées modulo 2^32.
+template <size_t Senders>
+class MulticastSequenceFilter {
+  static_assert(Senders > 0, "Au moins un émetteur");
+
+ public:
+  bool accept(uint32_t sender, uint32_t sequence) {
+    ++clock;
+    Slot *oldest = &slots[0];
+    for (Slot &slot : slots) {
+      if (slot.used && slot.sender == sender) {
+        if (static_cast<int32_t>(sequence - slot.sequence) <= 0) {
+          return false;
+        }
+        slot.sequence = sequence;
+        slot.lastSeen = clock;
+        return true;
+      }
+      if (!slot.used || (oldest->used && slot.lastSeen < oldest->lastSeen)) {
+        oldest = &slot;
+      }
+    }
+    // Émetteur inconnu : remplace l'emplacement libre ou le moins récemment entendu.
+    oldest->used = true;
+    oldest->sender = sender;
+    oldest->sequence = sequence;
+    oldest->lastSeen = clock;
+    return true;
+  }
+
+ private:
+  struct Slot {
+    bool used;
+    uint32_t sender;
+    uint32_t sequence;
+    uint32_t lastSeen;
+  };
+
+  Slot slots[Senders] = {};
+  uint32_t clock = 0;
+};
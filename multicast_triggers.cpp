@@ -0,0 +1,129 @@
+#include "multicast_triggers.h"
+
+#include <AsyncUDP.h>
+#include <WiFi.h>
+#include <string.h>
+
+#include "config.h"
+#include "cues.h"
+#include "latency_metrics.h"
+#include "multicast_protocol.h"
+
+namespace {
+
+AsyncUDP udp;
+bool listening = false;
+uint32_t lastAttemptMs = 0;
+bool attempted = false;
+
+// Utilisé uniquement par la tâche AsyncUDP, qui traite les datagrammes un par un.
+MulticastSequenceFilter<MULTICAST_MAX_SENDERS> sequences;
+// Tampons de handlePacket(), hors de la pile de la tâche AsyncUDP (CUE_COUNT opérations) : même
+// garantie qu'au-dessus, un seul datagramme traité à la fois.
+CueOperation operations[CUE_COUNT];
+bool mapped[CUE_COUNT];
+
+bool addressesThisDevice(uint16_t group) {
+  return group == MULTICAST_ALL_GROUPS || group == MULTICAST_GROUP_ID;
+}
+
+// Fusionne l'entrée dans l'opération de chaque cue local placé à sa position.
+void mapEntry(const MulticastEntry &entry) {
+  if (entry.position == MULTICAST_NO_POSITION) {
+    return;
+  }
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (multicastCuePositions[i] != entry.position) {
+      continue;
+    }
+    CueOperation &operation = operations[i];
+    if (!mapped[i]) {
+      operation = CueOperation{i, nullptr, 0, false, false, 0};
+      mapped[i] = true;
+    }
+    if (entry.hasText()) {
+      operation.text = entry.text;
+      operation.textLength = entry.textLength;
+      operation.persist = entry.persist();
+    }
+    if (entry.trigger()) {
+      operation.trigger = true;
+      operation.durationMs = entry.durationMs;
+    }
+  }
+}
+
+// Tout le datagramme est appliqué d'un bloc : mêmes LEDs allumées au même instant et une seule
+// trame "batch" diffusée, quel que soit le nombre d'entrées.
+void handlePacket(AsyncUDPPacket &packet) {
+  const uint32_t receivedAtUs = latencyTimestampUs();
+  MulticastPacket decoded;
+  if (!decodeMulticastPacket(packet.data(), packet.length(), decoded)) {
+    Serial.printf("[UDP] ❗ Datagramme multicast invalide (%u octets)\n", static_cast<unsigned>(packet.length()));
+    return;
+  }
+  if (!addressesThisDevice(decoded.group) || !sequences.accept(decoded.sender, decoded.sequence)) {
+    return;
+  }
+
+  memset(mapped, 0, sizeof(mapped));
+  size_t offset = 0;
+  for (uint8_t i = 0; i < decoded.entryCount; ++i) {
+    MulticastEntry entry;
+    readMulticastEntry(decoded, offset, entry);
+    mapEntry(entry);
+  }
+
+  // Compactage sur place : l'opération du cue i ne peut que reculer (count <= i).
+  size_t count = 0;
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    if (!mapped[i]) {
+      continue;
+    }
+    if (operations[i].trigger) {
+      beginTriggerTrace(i, TriggerSource::Multicast, receivedAtUs);
+    }
+    operations[count++] = operations[i];
+  }
+  if (count > 0) {
+    applyCueBatch(operations, count);
+  }
+}
+
+void startListening() {
+  const IPAddress group(MULTICAST_ADDRESS[0], MULTICAST_ADDRESS[1], MULTICAST_ADDRESS[2], MULTICAST_ADDRESS[3]);
+  if (!udp.listenMulticast(group, MULTICAST_PORT)) {
+    Serial.println("[UDP] ⚠️ Impossible de rejoindre le groupe multicast, nouvel essai plus tard");
+    return;
+  }
+  udp.onPacket(handlePacket);
+  listening = true;
+  Serial.printf("[UDP] 📡 Écoute multicast %s:%u (groupe %u)\n", group.toString().c_str(),
+                static_cast<unsigned>(MULTICAST_PORT), static_cast<unsigned>(MULTICAST_GROUP_ID));
+}
+
+}  // namespace
+
+void serviceMulticastTriggers() {
+  if (!MULTICAST_TRIGGERS_ENABLED) {
+    return;
+  }
+
+  const bool connected = WiFi.status() == WL_CONNECTED;
+  if (listening) {
+    if (!connected) {
+      udp.close();
+      listening = false;
+      Serial.println("[UDP] ℹ️ Wi-Fi perdu, écoute multicast suspendue");
+    }
+    return;
+  }
+
+  const uint32_t now = millis();
+  if (!connected || (attempted && now - lastAttemptMs < UDP_LISTEN_RETRY_INTERVAL_MS)) {
+    return;
+  }
+  attempted = true;
+  lastAttemptMs = now;
+  startListening();
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Rejoint le groupe multicast dès que la station Wi-Fi est connectée et le quitte à la
+// déconnexion (appelé depuis loop()). Les datagrammes sont traités dans la tâche AsyncUDP.
+void serviceMulticastTriggers();
@@ -0,0 +1,235 @@
+#include "osc_protocol.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr char kBundleTag[] = "#bundle";  // 8 octets avec le NUL.
+constexpr size_t kBundleHeaderSize = 16;
+constexpr int64_t kNtpToUnixSeconds = 2208988800LL;
+
+uint32_t readU32(const uint8_t *in) {
+  return static_cast<uint32_t>(in[0]) << 24 | static_cast<uint32_t>(in[1]) << 16 |
+         static_cast<uint32_t>(in[2]) << 8 | in[3];
+}
+
+uint64_t readU64(const uint8_t *in) {
+  return static_cast<uint64_t>(readU32(in)) << 32 | readU32(in + 4);
+}
+
+size_t padded(size_t length) {
+  return (length + 3) & ~static_cast<size_t>(3);
+}
+
+// Longueur d'une chaîne OSC (NUL et bourrage compris), 0 si elle déborde de `available`.
+size_t stringSize(const uint8_t *data, size_t available, size_t &length) {
+  const void *end = memchr(data, '\0', available);
+  if (end == nullptr) {
+    return 0;
+  }
+  length = static_cast<const uint8_t *>(end) - data;
+  const size_t size = padded(length + 1);
+  return size <= available ? size : 0;
+}
+
+// Taille occupée par un argument du type donné ; false si le type est inconnu ou la donnée
+// tronquée. Les types sans donnée (T, F, N, I) occupent 0 octet.
+bool argumentSize(char type, const uint8_t *data, size_t available, size_t &size) {
+  size_t length = 0;
+  switch (type) {
+    case 'i':
+    case 'f':
+    case 'c':
+    case 'r':
+    case 'm':
+      size = 4;
+      break;
+    case 'h':
+    case 'd':
+    case 't':
+      size = 8;
+      break;
+    case 's':
+    case 'S':
+      size = stringSize(data, available, length);
+      return size != 0;
+    case 'b':
+      if (available < 4 || readU32(data) > available - 4) {
+        return false;
+      }
+      size = 4 + padded(readU32(data));
+      break;
+    case 'T':
+    case 'F':
+    case 'N':
+    case 'I':
+      size = 0;
+      break;
+    default:
+      return false;
+  }
+  return size <= available;
+}
+
+bool parseMessage(const uint8_t *data, size_t length, OscMessage &message) {
+  size_t addressLength = 0;
+  const size_t addressSize = stringSize(data, length, addressLength);
+  if (addressSize == 0 || data[0] != '/') {
+    return false;
+  }
+  message.address = reinterpret_cast<const char *>(data);
+  message.typeTags = "";
+  message.arguments = data + addressSize;
+  message.argumentsLength = 0;
+
+  // Les anciens émetteurs omettent parfois la chaîne de types : message sans argument.
+  if (addressSize == length) {
+    return true;
+  }
+  if (data[addressSize] != ',') {
+    return false;
+  }
+  size_t tagsLength = 0;
+  const size_t tagsSize = stringSize(data + addressSize, length - addressSize, tagsLength);
+  if (tagsSize == 0) {
+    return false;
+  }
+  message.typeTags = reinterpret_cast<const char *>(data + addressSize + 1);
+  message.arguments = data + addressSize + tagsSize;
+  message.argumentsLength = length - addressSize - tagsSize;
+
+  size_t offset = 0;
+  for (const char *tag = message.typeTags; *tag != '\0'; ++tag) {
+    if (*tag == '[' || *tag == ']') {
+      continue;  // Délimiteurs de tableau : aucun octet associé.
+    }
+    size_t size = 0;
+    if (!argumentSize(*tag, message.arguments + offset, message.argumentsLength - offset, size)) {
+      return false;
+    }
+    offset += size;
+  }
+  return offset == message.argumentsLength;
+}
+
+bool isBundle(const uint8_t *data, size_t length) {
+  return length >= sizeof(kBundleTag) && memcmp(data, kBundleTag, sizeof(kBundleTag)) == 0;
+}
+
+// Premier passage sans gestionnaire (validation), second passage avec.
+bool walkPacket(const uint8_t *data, size_t length, uint64_t timetag, size_t depth, OscMessageHandler handler,
+                void *context) {
+  if (length == 0 || length % 4 != 0) {
+    return false;
+  }
+
+  if (!isBundle(data, length)) {
+    OscMessage message;
+    if (!parseMessage(data, length, message)) {
+      return false;
+    }
+    if (handler != nullptr) {
+      handler(message, timetag, context);
+    }
+    return true;
+  }
+
+  if (depth >= OSC_MAX_BUNDLE_DEPTH || length < kBundleHeaderSize) {
+    return false;
+  }
+  const uint64_t bundleTimetag = readU64(data + sizeof(kBundleTag));
+  size_t offset = kBundleHeaderSize;
+  while (offset < length) {
+    if (length - offset < 4) {
+      return false;
+    }
+    const size_t elementSize = readU32(data + offset);
+    offset += 4;
+    if (elementSize > length - offset ||
+        !walkPacket(data + offset, elementSize, bundleTimetag, depth + 1, handler, context)) {
+      return false;
+    }
+    offset += elementSize;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool OscArgumentReader::next(OscArgument &argument) {
+  while (*tags == '[' || *tags == ']') {
+    ++tags;
+  }
+  if (*tags == '\0') {
+    return false;
+  }
+
+  argument = OscArgument();
+  argument.type = *tags++;
+  size_t size = 0;
+  if (!argumentSize(argument.type, data, remaining, size)) {
+    return false;
+  }
+
+  switch (argument.type) {
+    case 'i':
+      argument.integer = static_cast<int32_t>(readU32(data));
+      break;
+    case 'h':
+      argument.integer = static_cast<int64_t>(readU64(data));
+      break;
+    case 'f': {
+      const uint32_t bits = readU32(data);
+      float value = 0;
+      memcpy(&value, &bits, sizeof(value));
+      argument.real = value;
+      break;
+    }
+    case 'd': {
+      const uint64_t bits = readU64(data);
+      memcpy(&argument.real, &bits, sizeof(argument.real));
+      break;
+    }
+    case 's':
+    case 'S':
+      argument.string = reinterpret_cast<const char *>(data);
+      argument.length = strlen(argument.string);
+      break;
+    case 'b':
+      argument.length = readU32(data);
+      argument.blob = data + 4;
+      break;
+    case 't':
+      argument.timetag = readU64(data);
+      break;
+    case 'T':
+      argument.integer = 1;
+      break;
+    default:
+      break;
+  }
+  data += size;
+  remaining -= size;
+  return true;
+}
+
+OscTimetagPlan planOscTimetag(uint64_t timetag, int64_t nowUnixUs, int64_t maxLeadUs, int64_t &leadUs) {
+  leadUs = 0;
+  if (timetag == OSC_TIMETAG_IMMEDIATE) {
+    return OscTimetagPlan::Immediate;
+  }
+  const int64_t targetUs = (static_cast<int64_t>(timetag >> 32) - kNtpToUnixSeconds) * 1000000LL +
+                           static_cast<int64_t>(((timetag & 0xFFFFFFFFULL) * 1000000ULL) >> 32);
+  if (targetUs <= nowUnixUs) {
+    return OscTimetagPlan::Immediate;
+  }
+  leadUs = targetUs - nowUnixUs;
+  return leadUs > maxLeadUs ? OscTimetagPlan::Rejected : OscTimetagPlan::Scheduled;
+}
+
+bool parseOscPacket(const uint8_t *data, size_t length, OscMessageHandler handler, void *context) {
+  if (data == nullptr || !walkPacket(data, length, OSC_TIMETAG_IMMEDIATE, 0, nullptr, nullptr)) {
+    return false;
+  }
+  return handler == nullptr || walkPacket(data, length, OSC_TIMETAG_IMMEDIATE, 0, handler, context);
+}
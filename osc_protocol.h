@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Open Sound Control 1.0 : analyse sans allocation des messages et bundles reçus.
+// -----------------------------------------------------------------------------
+// Message : [adresse][",typetags"][arguments], chaque chaîne terminée par un NUL et complétée à
+// un multiple de 4 octets, nombres en big-endian. Bundle : ["#bundle"][timetag:u64] puis
+// éléments [taille:i32][message ou bundle]. Les messages rendus pointent directement dans le
+// datagramme reçu, qui doit rester valide pendant l'appel du gestionnaire.
+
+// Timetag NTP (secondes depuis 1900 en 32.32) ; la valeur 1 signifie "immédiatement".
+constexpr uint64_t OSC_TIMETAG_IMMEDIATE = 1;
+// Profondeur maximale de bundles imbriqués acceptée.
+constexpr size_t OSC_MAX_BUNDLE_DEPTH = 4;
+
+struct OscMessage {
+  const char *address = nullptr;
+  const char *typeTags = "";  // Sans la virgule initiale.
+  const uint8_t *arguments = nullptr;
+  size_t argumentsLength = 0;
+};
+
+struct OscArgument {
+  char type = 0;
+  int64_t integer = 0;  // i, h, et T (1) / F (0).
+  double real = 0;      // f, d.
+  const char *string = nullptr;  // s, S : terminée par NUL.
+  const uint8_t *blob = nullptr;  // b.
+  size_t length = 0;  // Longueur de la chaîne ou du blob.
+  uint64_t timetag = 0;  // t.
+
+  bool isNumber() const { return type == 'i' || type == 'h' || type == 'f' || type == 'd'; }
+  double number() const { return type == 'f' || type == 'd' ? real : static_cast<double>(integer); }
+};
+
+enum class OscTimetagPlan : uint8_t { Immediate, Scheduled, Rejected };
+
+// Situe un timetag par rapport à l'heure murale `nowUnixUs` (µs depuis 1970) : immédiat pour
+// OSC_TIMETAG_IMMEDIATE ou un instant passé (OSC 1.0), rejeté au-delà de `maxLeadUs`, sinon
+// programmé `leadUs` plus tard.
+OscTimetagPlan planOscTimetag(uint64_t timetag, int64_t nowUnixUs, int64_t maxLeadUs, int64_t &leadUs);
+
+// Parcourt les arguments d'un message validé par parseOscPacket().
+class OscArgumentReader {
+ public:
+  explicit OscArgumentReader(const OscMessage &message)
+      : tags(message.typeTags), data(message.arguments), remaining(message.argumentsLength) {}
+  bool next(OscArgument &argument);
+
+ private:
+  const char *tags;
+  const uint8_t *data;
+  size_t remaining;
+};
+
+// Appelé pour chaque message, dans l'ordre, avec le timetag du bundle qui le contient
+// (OSC_TIMETAG_IMMEDIATE hors bundle).
+using OscMessageHandler = void (*)(const OscMessage &message, uint64_t timetag, void *context);
+
+// Valide tout le paquet avant d'appeler `handler` : un paquet mal formé n'a aucun effet, et les
+// messages d'un bundle sont rendus ensemble. Retourne false si le paquet est rejeté.
+bool parseOscPacket(const uint8_t *data, size_t length, OscMessageHandler handler, void *context);
@@ -0,0 +1,248 @@
+#include "osc_server.h"
+
+#include <AsyncUDP.h>
+#include <WiFi.h>
+#include <sys/time.h>
+
+#include "config.h"
+#include "cue_timers.h"
+#include "cues.h"
+#include "latency_metrics.h"
+#include "osc_protocol.h"
+
+namespace {
+
+constexpr char kCuePrefix[] = "/stagecue/cue/";
+constexpr time_t kMinValidUnixTime = 1600000000;  // En deçà, l'heure NTP n'est pas encore reçue.
+
+AsyncUDP udp;
+bool listening = false;
+bool timeConfigured = false;
+uint32_t lastAttemptMs = 0;
+bool attempted = false;
+
+enum class OscCueAction : uint8_t { Go, Text };
+
+// "/stagecue/cue/{n}/go" ou "/stagecue/cue/{n}/text", n à partir de 1 comme dans l'interface.
+bool parseCueAddress(const char *address, size_t &index, OscCueAction &action) {
+  if (strncmp(address, kCuePrefix, sizeof(kCuePrefix) - 1) != 0) {
+    return false;
+  }
+  const char *cursor = address + sizeof(kCuePrefix) - 1;
+  size_t number = 0;
+  const char *digits = cursor;
+  while (*cursor >= '0' && *cursor <= '9' && cursor - digits < 3) {
+    number = number * 10 + static_cast<size_t>(*cursor - '0');
+    ++cursor;
+  }
+  if (cursor == digits || number == 0 || number > CUE_COUNT) {
+    return false;
+  }
+  index = number - 1;
+  if (strcmp(cursor, "/go") == 0) {
+    action = OscCueAction::Go;
+    return true;
+  }
+  if (strcmp(cursor, "/text") == 0) {
+    action = OscCueAction::Text;
+    return true;
+  }
+  return false;
+}
+
+// Les timetags sont exprimés en heure murale : convertis vers cueClockUs() grâce à l'heure NTP.
+// Sans heure NTP, un bundle programmé s'exécute immédiatement, avec un avertissement.
+OscTimetagPlan planTimetag(uint64_t timetag, uint64_t &localUs) {
+  if (timetag == OSC_TIMETAG_IMMEDIATE) {
+    return OscTimetagPlan::Immediate;
+  }
+
+  timeval now = {};
+  gettimeofday(&now, nullptr);
+  const uint64_t clockNowUs = cueClockUs();
+  if (now.tv_sec < kMinValidUnixTime) {
+    Serial.println("[OSC] ⚠️ Heure NTP inconnue, bundle programmé exécuté immédiatement");
+    return OscTimetagPlan::Immediate;
+  }
+
+  const int64_t nowUs = static_cast<int64_t>(now.tv_sec) * 1000000LL + now.tv_usec;
+  int64_t leadUs = 0;
+  const OscTimetagPlan plan =
+      planOscTimetag(timetag, nowUs, static_cast<int64_t>(TRIGGER_AT_MAX_LEAD_MS) * 1000LL, leadUs);
+  if (plan == OscTimetagPlan::Scheduled) {
+    localUs = clockNowUs + static_cast<uint64_t>(leadUs);
+  }
+  return plan;
+}
+
+struct ScheduledGo {
+  size_t index;
+  uint64_t startAtUs;
+  uint32_t durationMs;
+};
+
+// Opérations d'un paquet : les messages immédiats sont appliqués ensemble, comme un lot.
+struct OscDispatch {
+  CueOperation operations[CUE_BATCH_MAX_OPERATIONS];
+  size_t operationCount = 0;
+  ScheduledGo scheduled[CUE_BATCH_MAX_OPERATIONS];
+  size_t scheduledCount = 0;
+  size_t dropped = 0;
+};
+
+// Lot du paquet en cours, hors de la pile de la tâche AsyncUDP (~1,4 Ko) : AsyncUDP n'appelle
+// handlePacket() que pour un paquet à la fois.
+OscDispatch packetDispatch;
+
+// Argument facultatif de /go : entier = durée (ms). Un flottant nul ou F correspond au
+// relâchement d'un bouton de surface de contrôle et n'entraîne aucun déclenchement.
+bool readGoArguments(const OscMessage &message, uint32_t &durationMs) {
+  OscArgumentReader reader(message);
+  OscArgument argument;
+  durationMs = 0;
+  if (!reader.next(argument)) {
+    return true;
+  }
+  if (argument.type == 'i' || argument.type == 'h') {
+    durationMs = argument.integer > 0 ? static_cast<uint32_t>(argument.integer) : 0;
+    return true;
+  }
+  if (argument.type == 'f' || argument.type == 'd') {
+    return argument.real != 0;
+  }
+  return argument.type != 'F';
+}
+
+// /text : chaîne obligatoire, puis persistance facultative (T/F ou entier), activée par défaut.
+bool readTextArguments(const OscMessage &message, CueOperation &operation) {
+  OscArgumentReader reader(message);
+  OscArgument argument;
+  if (!reader.next(argument) || (argument.type != 's' && argument.type != 'S')) {
+    return false;
+  }
+  operation.text = argument.string;
+  operation.textLength = argument.length;
+  operation.persist = true;
+  if (reader.next(argument) && (argument.type == 'T' || argument.type == 'F' || argument.isNumber())) {
+    operation.persist = argument.number() != 0;
+  }
+  return true;
+}
+
+void collectMessage(const OscMessage &message, uint64_t timetag, void *context) {
+  OscDispatch &dispatch = *static_cast<OscDispatch *>(context);
+  size_t index = 0;
+  OscCueAction action = OscCueAction::Go;
+  if (!parseCueAddress(message.address, index, action)) {
+    return;
+  }
+
+  if (action == OscCueAction::Text) {
+    // Le texte est appliqué dès réception, même dans un bundle programmé : l'écran est prêt au GO.
+    CueOperation operation{index, nullptr, 0, true, false, 0};
+    if (!readTextArguments(message, operation)) {
+      return;
+    }
+    if (dispatch.operationCount == CUE_BATCH_MAX_OPERATIONS) {
+      ++dispatch.dropped;
+      return;
+    }
+    dispatch.operations[dispatch.operationCount++] = operation;
+    return;
+  }
+
+  uint32_t durationMs = 0;
+  if (!readGoArguments(message, durationMs)) {
+    return;
+  }
+  uint64_t startAtUs = 0;
+  switch (planTimetag(timetag, startAtUs)) {
+    case OscTimetagPlan::Rejected:
+      ++dispatch.dropped;
+      return;
+    case OscTimetagPlan::Scheduled:
+      if (dispatch.scheduledCount == CUE_BATCH_MAX_OPERATIONS) {
+        ++dispatch.dropped;
+        return;
+      }
+      dispatch.scheduled[dispatch.scheduledCount++] = ScheduledGo{index, startAtUs, durationMs};
+      return;
+    case OscTimetagPlan::Immediate:
+    default:
+      if (dispatch.operationCount == CUE_BATCH_MAX_OPERATIONS) {
+        ++dispatch.dropped;
+        return;
+      }
+      dispatch.operations[dispatch.operationCount++] = CueOperation{index, nullptr, 0, false, true, durationMs};
+      return;
+  }
+}
+
+void handlePacket(AsyncUDPPacket &packet) {
+  const uint32_t receivedAtUs = latencyTimestampUs();
+  OscDispatch &dispatch = packetDispatch;
+  dispatch.operationCount = 0;
+  dispatch.scheduledCount = 0;
+  dispatch.dropped = 0;
+  if (!parseOscPacket(packet.data(), packet.length(), collectMessage, &dispatch)) {
+    Serial.printf("[OSC] ❗ Paquet invalide (%u octets)\n", static_cast<unsigned>(packet.length()));
+    return;
+  }
+
+  for (size_t i = 0; i < dispatch.operationCount; ++i) {
+    if (dispatch.operations[i].trigger) {
+      beginTriggerTrace(dispatch.operations[i].index, TriggerSource::Osc, receivedAtUs);
+    }
+  }
+  if (dispatch.operationCount > 0) {
+    applyCueBatch(dispatch.operations, dispatch.operationCount);
+  }
+  for (size_t i = 0; i < dispatch.scheduledCount; ++i) {
+    const ScheduledGo &go = dispatch.scheduled[i];
+    triggerCueAt(go.index, go.startAtUs, go.durationMs);
+  }
+  if (dispatch.dropped > 0) {
+    Serial.printf("[OSC] ⚠️ %u message(s) ignoré(s) (lot trop long ou timetag trop lointain)\n",
+                  static_cast<unsigned>(dispatch.dropped));
+  }
+}
+
+void startListening() {
+  if (!udp.listen(OSC_PORT)) {
+    Serial.println("[OSC] ⚠️ Impossible d'ouvrir le port OSC, nouvel essai plus tard");
+    return;
+  }
+  udp.onPacket(handlePacket);
+  listening = true;
+  Serial.printf("[OSC] 🎛️ Serveur OSC à l'écoute sur le port %u\n", static_cast<unsigned>(OSC_PORT));
+}
+
+}  // namespace
+
+void serviceOscServer() {
+  if (!OSC_SERVER_ENABLED) {
+    return;
+  }
+
+  const bool connected = WiFi.status() == WL_CONNECTED;
+  if (listening) {
+    if (!connected) {
+      udp.close();
+      listening = false;
+      Serial.println("[OSC] ℹ️ Wi-Fi perdu, serveur OSC suspendu");
+    }
+    return;
+  }
+
+  const uint32_t now = millis();
+  if (!connected || (attempted && now - lastAttemptMs < UDP_LISTEN_RETRY_INTERVAL_MS)) {
+    return;
+  }
+  if (!timeConfigured) {
+    configTime(0, 0, NTP_SERVER);
+    timeConfigured = true;
+  }
+  attempted = true;
+  lastAttemptMs = now;
+  startListening();
+}
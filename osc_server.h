@@ -0,0 +1,7 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Ouvre le port OSC et lance la synchronisation NTP dès que la station Wi-Fi est connectée
+// (appelé depuis loop()). Les paquets sont traités dans la tâche AsyncUDP.
+void serviceOscServer();
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// File circulaire sans verrou pour un seul producteur et un seul consommateur (ex. ISR -> loop()).
+// Capacity doit être une puissance de deux ; push() et pop() sont utilisables depuis une ISR.
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity doit être une puissance de deux");
+
+ public:
+  bool push(const T &item) {
+    const uint32_t write = writeIndex.load(std::memory_order_relaxed);
+    const uint32_t read = readIndex.load(std::memory_order_acquire);
+    if (write - read == Capacity) {
+      return false;
+    }
+    slots[write & (Capacity - 1)] = item;
+    writeIndex.store(write + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    const uint32_t read = readIndex.load(std::memory_order_relaxed);
+    const uint32_t write = writeIndex.load(std::memory_order_acquire);
+    if (read == write) {
+      return false;
+    }
+    item = slots[read & (Capacity - 1)];
+    readIndex.store(read + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return readIndex.load(std::memory_order_acquire) == writeIndex.load(std::memory_order_acquire);
+  }
+
+ private:
+  T slots[Capacity] = {};
+  std::atomic<uint32_t> writeIndex{0};
+  std::atomic<uint32_t> readIndex{0};
+};
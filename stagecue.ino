@@ -1,7 +1,11 @@
 #include "config.h"
+#include "cue_list.h"
 #include "display_manager.h"
+#include "dmx_input.h"
 #include "web_server.h"
 #include "cues.h"
+#include "multicast_triggers.h"
+#include "osc_server.h"
 #include "wifi_portal.h"
 
 #if defined(ESP_PLATFORM)
@@ -41,16 +45,16 @@ void setup() {
   logChipInfo();
   initDisplay();
   initCues();
-  const bool wifiConnected = startWiFiWithPortal();
-  if (wifiConnected) {
-    Serial.println("[Core] ✅ Connecté au Wi-Fi");
-  } else {
-    Serial.println("[Core] ⚠️ Portail Wi-Fi actif");
-  }
+  startWiFiWithPortal();
   startWebServer();
 }
 
 void loop() {
   updateCues();
-  handleWiFiPortal();
+  serviceWebSocketClients();
+  serviceCueList();
+  updateWiFi();
+  serviceMulticastTriggers();
+  serviceOscServer();
+  serviceDmxInput();
 }
@@ -0,0 +1,168 @@
+// Micro-benchmarks hôte des fonctions chaudes d'un déclenchement : temps par appel et
+// allocations par appel, comptées en remplaçant operator new. Les chiffres de temps sont ceux
+// de la machine hôte (à comparer entre deux versions, pas à transposer sur l'ESP32) ; le
+// nombre d'allocations, lui, suit la politique de String du cœur ESP32 (shims/WString.h).
+//   make -C tests bench
+//   make -C tests bench ARDUINOJSON_DIR=~/Arduino/libraries/ArduinoJson/src   (avec buildCueJson)
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <new>
+
+#include <ESPAsyncWebServer.h>
+#include <Wire.h>
+
+#include "config.h"
+#include "cue_store.h"
+#include "display_manager.h"
+#include "latency_metrics.h"
+#include "text_layout.h"
+#include "web_request.h"
+#if defined(BENCH_ARDUINOJSON)
+#include "cue_json.h"
+#endif
+
+namespace {
+
+size_t allocationCount = 0;
+
+}  // namespace
+
+void *operator new(size_t size) {
+  ++allocationCount;
+  if (void *block = malloc(size != 0 ? size : 1)) {
+    return block;
+  }
+  throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  ++allocationCount;
+  return malloc(size != 0 ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+  return operator new(size, tag);
+}
+
+void operator delete(void *block) noexcept {
+  free(block);
+}
+
+void operator delete[](void *block) noexcept {
+  free(block);
+}
+
+void operator delete(void *block, size_t) noexcept {
+  free(block);
+}
+
+void operator delete[](void *block, size_t) noexcept {
+  free(block);
+}
+
+// Les métriques de latence ne sont pas liées à ce banc.
+void markTriggerStage(size_t, LatencyStage) {}
+
+namespace {
+
+volatile size_t sink = 0;
+
+template <typename Body>
+void measure(const char *name, size_t iterations, Body &&body) {
+  body();  // Chauffe : tampons internes déjà dimensionnés.
+  const size_t allocationsBefore = allocationCount;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    body();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+  const double allocations =
+      static_cast<double>(allocationCount - allocationsBefore) / static_cast<double>(iterations);
+  printf("%-44s %10.1f ns/op %8.2f alloc/op\n", name, ns, allocations);
+}
+
+// Texte tel que reçu d'un formulaire : blancs à retirer, accents, au-delà de MAX_CUE_TEXT_LENGTH.
+const char kRawText[] = "  Entrée côté cour : noir salle, plein feu, rideau, top acte deux scène trois  \t";
+const char kShortText[] = "Rideau";
+const char kWrappedText[] = "Entree cour et jardin noir salle plein feu rideau top acte deux";
+const char kFormText[] = "Entr%C3%A9e+c%C3%B4t%C3%A9+cour+%26+jardin";
+
+}  // namespace
+
+int main() {
+  constexpr size_t kIterations = 200000;
+  printf("%zu itérations par mesure, hôte : temps indicatifs, allocations exactes\n\n", kIterations);
+
+  measure("trimCueText (nettoyage d'un texte de cue)", kIterations, [] {
+    sink = sink + trimCueText(kRawText, sizeof(kRawText) - 1, MAX_CUE_TEXT_LENGTH).length;
+  });
+
+  CueStore store;
+  bool flip = false;
+  measure("CueStore::assignText (texte alterné)", kIterations, [&] {
+    flip = !flip;
+    const CueTextView text = flip ? trimCueText(kRawText, sizeof(kRawText) - 1, MAX_CUE_TEXT_LENGTH)
+                                  : CueTextView{kShortText, sizeof(kShortText) - 1};
+    sink = sink + store.assignText(0, text.data, text.length);
+  });
+
+  measure("layoutWrappedText (64 octets, 128 px)", kIterations, [] {
+    TextLine lines[8];
+    sink = sink + layoutWrappedText(kWrappedText, sizeof(kWrappedText) - 1, SCREEN_WIDTH, lines, 8);
+  });
+
+  Wire.record = false;
+  initDisplay();
+  measure("updateDisplay, texte inchangé (rendu + diff)", kIterations / 10,
+          [] { updateDisplay(0, kWrappedText, sizeof(kWrappedText) - 1); });
+  measure("updateDisplay, texte alterné (rendu + envoi)", kIterations / 10, [&] {
+    flip = !flip;
+    if (flip) {
+      updateDisplay(0, kWrappedText, sizeof(kWrappedText) - 1);
+    } else {
+      updateDisplay(0, kRawText, sizeof(kRawText) - 1);
+    }
+  });
+
+  const String form(kFormText);
+  measure("urlDecode (champ de formulaire, 41 octets)", kIterations, [&] { sink = sink + urlDecode(form).length(); });
+
+  AsyncWebServerRequest headerRequest;
+  headerRequest.addHeader("X-StageCue-Token", API_AUTH_TOKEN);
+  measure("isAuthorized, en-tête X-StageCue-Token", kIterations,
+          [&] { sink = sink + isAuthorized(&headerRequest); });
+
+  AsyncWebServerRequest bearerRequest;
+  String bearer("Bearer ");
+  bearer += API_AUTH_TOKEN;
+  bearerRequest.addHeader("Authorization", bearer);
+  measure("isAuthorized, en-tête Authorization: Bearer", kIterations,
+          [&] { sink = sink + isAuthorized(&bearerRequest); });
+
+  AsyncWebServerRequest paramRequest;
+  paramRequest.addParam("token", API_AUTH_TOKEN);
+  measure("isAuthorized, paramètre token", kIterations, [&] { sink = sink + isAuthorized(&paramRequest); });
+
+  AsyncWebServerRequest anonymousRequest;
+  measure("isAuthorized, refusé (aucun jeton)", kIterations,
+          [&] { sink = sink + isAuthorized(&anonymousRequest); });
+
+#if defined(BENCH_ARDUINOJSON)
+  CueTextCopy text;
+  store.copyText(0, text);
+  const CueJsonState state{0, true, true, text};
+  measure("buildCueJson (un cue, texte de 64 octets)", kIterations,
+          [&] { sink = sink + buildCueJson("cue", state).length(); });
+#else
+  printf("%-44s non mesuré : ARDUINOJSON_DIR non fourni\n", "buildCueJson");
+#endif
+  return 0;
+}
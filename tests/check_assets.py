@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Vérifie la sortie de tools/build_assets.py sur un jeu d'essai.
+
+Pour chaque ligne du manifeste : le .gz se décompresse vers le fichier source (ou la page
+réécrite), l'ETag est l'empreinte SHA-256 tronquée de ce contenu, les fichiers à empreinte
+sont immuables et les pages revalidées, le type MIME suit l'extension.
+
+Usage : python3 check_assets.py <dossier source> <dossier produit>
+"""
+
+import gzip
+import hashlib
+import sys
+from pathlib import Path
+
+HASH_LENGTH = 10
+CONTENT_TYPES = {".html": "text/html; charset=utf-8", ".css": "text/css", ".js": "application/javascript"}
+
+
+def digest(data: bytes) -> str:
+    return hashlib.sha256(data).hexdigest()[:HASH_LENGTH]
+
+
+def main() -> int:
+    source, output = Path(sys.argv[1]), Path(sys.argv[2])
+    errors = []
+
+    def expect(condition: bool, message: str) -> None:
+        if not condition:
+            errors.append(message)
+
+    entries = {}
+    for line in (output / "assets.manifest").read_text(encoding="utf-8").splitlines():
+        url, etag, immutable, content_type = line.split("\t")
+        entries[url] = (etag, immutable == "1", content_type)
+
+    renamed = {}
+    for path in sorted(source.iterdir()):
+        if path.suffix == ".html":
+            continue
+        data = path.read_bytes()
+        url = f"/{path.stem}.{digest(data)}{path.suffix}"
+        renamed[path.name] = url.lstrip("/")
+        expect(url in entries, f"{url} absent du manifeste")
+        if url not in entries:
+            continue
+        etag, immutable, content_type = entries[url]
+        expect(etag == digest(data), f"{url} : ETag {etag} au lieu de {digest(data)}")
+        expect(immutable, f"{url} : un nom à empreinte doit être immuable")
+        expect(content_type == CONTENT_TYPES[path.suffix], f"{url} : type {content_type}")
+        expect(gzip.decompress((output / f"{url.lstrip('/')}.gz").read_bytes()) == data,
+               f"{url} : contenu décompressé différent de {path.name}")
+
+    for path in sorted(source.glob("*.html")):
+        url = f"/{path.name}"
+        expect(url in entries, f"{url} absent du manifeste")
+        if url not in entries:
+            continue
+        etag, immutable, content_type = entries[url]
+        page = gzip.decompress((output / f"{path.name}.gz").read_bytes())
+        text = page.decode("utf-8")
+        expect(etag == digest(page), f"{url} : ETag {etag} au lieu de {digest(page)}")
+        expect(not immutable, f"{url} : une page doit être revalidée")
+        expect(content_type == CONTENT_TYPES[".html"], f"{url} : type {content_type}")
+        for original, fingerprinted in renamed.items():
+            expect(f'="{fingerprinted}"' in text, f"{url} : référence à {fingerprinted} manquante")
+            expect(f'="{original}"' not in text and f'="/{original}"' not in text,
+                   f"{url} : référence à {original} non réécrite")
+        expect('href="https://example.org/app.js"' in text, f"{url} : lien externe modifié")
+
+    expect(len(entries) == len(list(source.iterdir())), f"{len(entries)} entrées pour {len(list(source.iterdir()))} fichiers")
+    for error in errors:
+        print(f"  check_assets : {error}", file=sys.stderr)
+    print(f"{len(entries)} ressources, {len(errors)} vérifications en échec")
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
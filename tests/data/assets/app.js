@@ -0,0 +1,2 @@
+// Jeu d'essai pour tools/build_assets.py.
+document.querySelector("p").textContent = "Côté jardin";
@@ -0,0 +1,59 @@
+#pragma once
+
+// Adafruit_GFX factice : curseur, police fixe de 6 px d'avance (5 px de glyphe) et tracé par
+// drawPixel(). Les motifs des glyphes sont arbitraires mais distincts d'un caractère à l'autre.
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Adafruit_GFX {
+ public:
+  Adafruit_GFX(int16_t w, int16_t h) : width(w), height(h) {}
+  virtual ~Adafruit_GFX() = default;
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  void setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+  }
+  void setTextSize(uint8_t) {}
+  void setTextWrap(bool) {}
+  void setTextColor(uint16_t color) { textColor = color; }
+  void setRotation(uint8_t) {}
+
+  size_t write(uint8_t c) {
+    if (c == '\n') {
+      cursorX = 0;
+      cursorY += 8;
+      return 1;
+    }
+    if (c == '\r') {
+      return 1;
+    }
+    for (int16_t column = 0; column < 5; ++column) {
+      const uint8_t bits = static_cast<uint8_t>((c * 7 + column * 13) | 1) & 0x7F;
+      for (int16_t row = 0; row < 7; ++row) {
+        if (bits & (1 << row)) {
+          drawPixel(static_cast<int16_t>(cursorX + column), static_cast<int16_t>(cursorY + row), textColor);
+        }
+      }
+    }
+    cursorX += 6;
+    return 1;
+  }
+
+  size_t write(const uint8_t *buffer, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      write(buffer[i]);
+    }
+    return size;
+  }
+
+ protected:
+  int16_t width;
+  int16_t height;
+  int16_t cursorX = 0;
+  int16_t cursorY = 0;
+  uint16_t textColor = 1;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+// Adafruit_SSD1306 factice : tampon d'image réel (une page = 8 lignes, un octet par colonne),
+// commandes envoyées sur le TwoWire factice comme le fait la bibliothèque (octet de contrôle 0x00).
+// Comme elle, chaque commande, begin() et display() passent le bus à clkDuring puis le remettent
+// à clkAfter (100 kHz par défaut).
+
+#include <string.h>
+
+#include <vector>
+
+#include "Adafruit_GFX.h"
+#include "Wire.h"
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+
+class Adafruit_SSD1306 : public Adafruit_GFX {
+ public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi, int8_t, uint32_t clkDuring = 400000UL,
+                   uint32_t clkAfter = 100000UL)
+      : Adafruit_GFX(w, h),
+        wire(twi),
+        buffer(static_cast<size_t>(w) * ((h + 7) / 8)),
+        wireClkDuring(clkDuring),
+        wireClkAfter(clkAfter) {}
+
+  bool begin(uint8_t, uint8_t address) {
+    i2cAddress = address;
+    wire->setClock(wireClkDuring);
+    wire->beginTransmission(address);
+    const bool ok = wire->endTransmission() == 0;
+    wire->setClock(wireClkAfter);
+    return ok;
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (x < 0 || y < 0 || x >= width || y >= height) {
+      return;
+    }
+    uint8_t &cell = buffer[static_cast<size_t>(x) + static_cast<size_t>(y / 8) * width];
+    const uint8_t bit = static_cast<uint8_t>(1 << (y & 7));
+    cell = color == SSD1306_BLACK ? cell & ~bit : cell | bit;
+  }
+
+  void clearDisplay() { memset(buffer.data(), 0, buffer.size()); }
+  // Transfert complet du tampon : compté, pas journalisé octet par octet.
+  void display() {
+    wire->setClock(wireClkDuring);
+    ++fullFrames;
+    wire->setClock(wireClkAfter);
+  }
+  uint8_t *getBuffer() { return buffer.data(); }
+
+  void ssd1306_command(uint8_t command) {
+    wire->setClock(wireClkDuring);
+    wire->beginTransmission(i2cAddress);
+    wire->write(static_cast<uint8_t>(0x00));
+    wire->write(command);
+    wire->endTransmission();
+    wire->setClock(wireClkAfter);
+  }
+
+  size_t fullFrames = 0;
+
+ private:
+  TwoWire *wire;
+  std::vector<uint8_t> buffer;
+  uint8_t i2cAddress = 0;
+  uint32_t wireClkDuring;
+  uint32_t wireClkAfter;
+};
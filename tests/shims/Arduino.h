@@ -0,0 +1,48 @@
+#pragma once
+
+// Sous-ensemble d'Arduino.h pour les tests hôte : types de base, niveaux logiques, horloge,
+// String (WString.h) et port série (sorties ignorées).
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <thread>
+
+#include "WString.h"
+
+constexpr uint8_t LOW = 0;
+constexpr uint8_t HIGH = 1;
+
+inline uint32_t micros() {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+inline uint32_t millis() {
+  return micros() / 1000;
+}
+
+inline void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+struct HardwareSerial {
+  template <typename... Args>
+  int printf(const char *, Args...) {
+    return 0;
+  }
+  template <typename T>
+  size_t print(const T &) {
+    return 0;
+  }
+  template <typename T>
+  size_t println(const T &) {
+    return 0;
+  }
+};
+
+inline HardwareSerial Serial;
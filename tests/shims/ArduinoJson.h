@@ -0,0 +1,31 @@
+#pragma once
+
+// ArduinoJson factice : seules les macros de dimensionnement et les types de documents (déclarés,
+// sans sérialisation), pour vérifier les capacités sans la bibliothèque. Tailles d'ArduinoJson 6 sur une cible
+// 32 bits (ESP32) : un emplacement de variant occupe 16 octets.
+
+#include <stddef.h>
+
+#define JSON_ARRAY_SIZE(n) ((n) * 16)
+#define JSON_OBJECT_SIZE(n) ((n) * 16)
+#define JSON_STRING_SIZE(n) ((n) + 1)
+
+class JsonObject;
+
+class DynamicJsonDocument {
+ public:
+  explicit DynamicJsonDocument(size_t capacity) : capacity_(capacity) {}
+  size_t capacity() const { return capacity_; }
+
+ private:
+  size_t capacity_;
+};
+
+template <size_t Capacity>
+class StaticJsonDocument {
+ public:
+  size_t capacity() const { return Capacity; }
+
+ private:
+  char pool_[Capacity];
+};
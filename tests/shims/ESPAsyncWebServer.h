@@ -0,0 +1,60 @@
+#pragma once
+
+// Requête ESPAsyncWebServer réduite aux en-têtes et paramètres. Mêmes signatures que la
+// bibliothèque : les noms sont reçus en const String &, si bien qu'un littéral devient une
+// String temporaire à chaque appel (comptée par tests/bench_hot_paths.cpp).
+
+#include <vector>
+
+#include "Arduino.h"
+
+class AsyncWebHeader {
+ public:
+  AsyncWebHeader(const String &name, const String &value) : name_(name), value_(value) {}
+  const String &name() const { return name_; }
+  const String &value() const { return value_; }
+
+ private:
+  String name_;
+  String value_;
+};
+
+class AsyncWebParameter {
+ public:
+  AsyncWebParameter(const String &name, const String &value) : name_(name), value_(value) {}
+  const String &name() const { return name_; }
+  const String &value() const { return value_; }
+
+ private:
+  String name_;
+  String value_;
+};
+
+class AsyncWebServerRequest {
+ public:
+  void addHeader(const String &name, const String &value) { headers_.emplace_back(name, value); }
+  void addParam(const String &name, const String &value) { params_.emplace_back(name, value); }
+
+  bool hasHeader(const String &name) const { return getHeader(name) != nullptr; }
+  AsyncWebHeader *getHeader(const String &name) const {
+    for (const AsyncWebHeader &header : headers_) {
+      if (header.name().equalsIgnoreCase(name)) {
+        return const_cast<AsyncWebHeader *>(&header);
+      }
+    }
+    return nullptr;
+  }
+  bool hasParam(const String &name, bool = false, bool = false) const { return getParam(name) != nullptr; }
+  AsyncWebParameter *getParam(const String &name, bool = false, bool = false) const {
+    for (const AsyncWebParameter &param : params_) {
+      if (param.name() == name) {
+        return const_cast<AsyncWebParameter *>(&param);
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  std::vector<AsyncWebHeader> headers_;
+  std::vector<AsyncWebParameter> params_;
+};
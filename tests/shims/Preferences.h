@@ -0,0 +1,101 @@
+#pragma once
+
+// Preferences (NVS) factice : un magasin en mémoire partagé par toutes les instances, avec
+// compteurs d'écritures. `beforePutBytes`, s'il est défini, est appelé au début de chaque
+// putBytes() (simulation d'une écriture flash lente) ; `failPutBytes` fait échouer les écritures.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "WString.h"
+
+struct PreferencesStore {
+  struct Entry {
+    bool isString = false;
+    std::vector<uint8_t> bytes;
+  };
+
+  std::map<std::string, std::map<std::string, Entry>> namespaces;
+  size_t putBytesCalls = 0;
+  size_t putStringCalls = 0;
+  size_t removeCalls = 0;
+  bool failPutBytes = false;
+  std::function<void()> beforePutBytes;
+};
+
+inline PreferencesStore preferencesStore;
+
+class Preferences {
+ public:
+  bool begin(const char *name, bool = false) {
+    space = &preferencesStore.namespaces[name];
+    return true;
+  }
+  void end() { space = nullptr; }
+
+  bool isKey(const char *key) { return find(key) != nullptr; }
+  bool remove(const char *key) {
+    ++preferencesStore.removeCalls;
+    return space != nullptr && space->erase(key) > 0;
+  }
+
+  size_t putString(const char *key, const char *value) {
+    ++preferencesStore.putStringCalls;
+    const size_t length = strlen(value);
+    PreferencesStore::Entry &entry = (*space)[key];
+    entry.isString = true;
+    entry.bytes.assign(value, value + length);
+    return length;
+  }
+  String getString(const char *key, const String &defaultValue = String()) {
+    const PreferencesStore::Entry *entry = find(key);
+    if (entry == nullptr || !entry->isString) {
+      return defaultValue;
+    }
+    const std::string text(entry->bytes.begin(), entry->bytes.end());
+    return String(text.c_str());
+  }
+
+  size_t putBytes(const char *key, const void *value, size_t length) {
+    if (preferencesStore.beforePutBytes) {
+      preferencesStore.beforePutBytes();
+    }
+    ++preferencesStore.putBytesCalls;
+    if (preferencesStore.failPutBytes || space == nullptr) {
+      return 0;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(value);
+    PreferencesStore::Entry &entry = (*space)[key];
+    entry.isString = false;
+    entry.bytes.assign(bytes, bytes + length);
+    return length;
+  }
+  size_t getBytesLength(const char *key) {
+    const PreferencesStore::Entry *entry = find(key);
+    return entry != nullptr && !entry->isString ? entry->bytes.size() : 0;
+  }
+  size_t getBytes(const char *key, void *buffer, size_t maxLength) {
+    const PreferencesStore::Entry *entry = find(key);
+    if (entry == nullptr || entry->isString || entry->bytes.size() > maxLength) {
+      return 0;
+    }
+    memcpy(buffer, entry->bytes.data(), entry->bytes.size());
+    return entry->bytes.size();
+  }
+
+ private:
+  const PreferencesStore::Entry *find(const char *key) const {
+    if (space == nullptr) {
+      return nullptr;
+    }
+    const auto found = space->find(key);
+    return found != space->end() ? &found->second : nullptr;
+  }
+
+  std::map<std::string, PreferencesStore::Entry> *space = nullptr;
+};
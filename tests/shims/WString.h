@@ -0,0 +1,179 @@
+#pragma once
+
+// String d'Arduino réduite à ce qu'utilisent les unités mesurées sur l'hôte. Même politique
+// d'allocation que le cœur ESP32 : tampon interne de 10 caractères (SSO, cible 32 bits), puis
+// tampon sur le tas agrandi à la taille exacte demandée, sans marge. Les allocations passent par
+// ::operator new pour être comptées par tests/bench_hot_paths.cpp.
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include <new>
+
+class String {
+ public:
+  String() { sso_[0] = '\0'; }
+  String(const char *text) : String() {
+    if (text != nullptr) {
+      assign(text, strlen(text));
+    }
+  }
+  explicit String(int value) : String(static_cast<long>(value)) {}
+  explicit String(unsigned int value) : String(static_cast<unsigned long>(value)) {}
+  explicit String(long value) : String() {
+    char digits[24];
+    assign(digits, static_cast<size_t>(snprintf(digits, sizeof(digits), "%ld", value)));
+  }
+  explicit String(unsigned long value) : String() {
+    char digits[24];
+    assign(digits, static_cast<size_t>(snprintf(digits, sizeof(digits), "%lu", value)));
+  }
+  String(const String &other) : String() { assign(other.c_str(), other.length_); }
+  String(String &&other) noexcept : String() { *this = static_cast<String &&>(other); }
+  ~String() { ::operator delete(heap_); }
+
+  String &operator=(const String &other) {
+    if (this != &other) {
+      assign(other.c_str(), other.length_);
+    }
+    return *this;
+  }
+  String &operator=(String &&other) noexcept {
+    if (this != &other) {
+      if (other.heap_ != nullptr) {
+        ::operator delete(heap_);
+        heap_ = other.heap_;
+        capacity_ = other.capacity_;
+        length_ = other.length_;
+        other.heap_ = nullptr;
+        other.capacity_ = kSsoCapacity;
+        other.length_ = 0;
+        other.sso_[0] = '\0';
+      } else {
+        assign(other.sso_, other.length_);
+      }
+    }
+    return *this;
+  }
+
+  bool reserve(size_t size) {
+    if (size <= capacity_) {
+      return true;
+    }
+    char *grown = static_cast<char *>(::operator new(size + 1));
+    memcpy(grown, c_str(), length_ + 1);
+    ::operator delete(heap_);
+    heap_ = grown;
+    capacity_ = size;
+    return true;
+  }
+
+  size_t length() const { return length_; }
+  bool isEmpty() const { return length_ == 0; }
+  const char *c_str() const { return heap_ != nullptr ? heap_ : sso_; }
+  char operator[](size_t index) const { return index < length_ ? c_str()[index] : '\0'; }
+
+  bool concat(const char *text, size_t length) {
+    reserve(length_ + length);
+    memcpy(buffer() + length_, text, length);
+    length_ += length;
+    buffer()[length_] = '\0';
+    return true;
+  }
+  bool concat(const char *text) { return text != nullptr && concat(text, strlen(text)); }
+  bool concat(char c) { return concat(&c, 1); }
+  String &operator+=(const char *text) {
+    concat(text);
+    return *this;
+  }
+  String &operator+=(char c) {
+    concat(c);
+    return *this;
+  }
+
+  bool operator==(const char *text) const { return strcmp(c_str(), text != nullptr ? text : "") == 0; }
+  bool operator==(const String &other) const {
+    return length_ == other.length_ && memcmp(c_str(), other.c_str(), length_) == 0;
+  }
+  bool equalsIgnoreCase(const String &other) const {
+    return length_ == other.length_ && strcasecmp(c_str(), other.c_str()) == 0;
+  }
+  bool startsWith(const char *prefix) const {
+    const size_t length = strlen(prefix);
+    return length <= length_ && memcmp(c_str(), prefix, length) == 0;
+  }
+
+  bool endsWith(const char *suffix) const {
+    const size_t length = strlen(suffix);
+    return length <= length_ && memcmp(c_str() + length_ - length, suffix, length) == 0;
+  }
+
+  int indexOf(char c, size_t from = 0) const {
+    const char *found = from < length_ ? static_cast<const char *>(memchr(c_str() + from, c, length_ - from)) : nullptr;
+    return found != nullptr ? static_cast<int>(found - c_str()) : -1;
+  }
+
+  String substring(size_t from) const { return substring(from, length_); }
+  String substring(size_t from, size_t to) const {
+    String out;
+    if (from < to && from < length_) {
+      out.assign(c_str() + from, (to > length_ ? length_ : to) - from);
+    }
+    return out;
+  }
+
+  void trim() {
+    const char *text = c_str();
+    size_t start = 0;
+    while (start < length_ && isspace(static_cast<unsigned char>(text[start]))) {
+      ++start;
+    }
+    size_t end = length_;
+    while (end > start && isspace(static_cast<unsigned char>(text[end - 1]))) {
+      --end;
+    }
+    length_ = end - start;
+    memmove(buffer(), text + start, length_);
+    buffer()[length_] = '\0';
+  }
+
+ private:
+  static constexpr size_t kSsoCapacity = 10;
+
+  char *buffer() { return heap_ != nullptr ? heap_ : sso_; }
+
+  void assign(const char *text, size_t length) {
+    reserve(length);
+    memmove(buffer(), text, length);
+    length_ = length;
+    buffer()[length_] = '\0';
+  }
+
+  char *heap_ = nullptr;
+  size_t capacity_ = kSsoCapacity;
+  size_t length_ = 0;
+  char sso_[kSsoCapacity + 1];
+};
+
+inline String operator+(const String &lhs, const String &rhs) {
+  String out(lhs);
+  out.concat(rhs.c_str(), rhs.length());
+  return out;
+}
+
+inline String operator+(const char *lhs, const String &rhs) {
+  return String(lhs) + rhs;
+}
+
+inline String operator+(const String &lhs, const char *rhs) {
+  return lhs + String(rhs);
+}
+
+// Résultat des concaténations chez Arduino ; ArduinoJson le traite comme une String.
+class StringSumHelper : public String {
+ public:
+  using String::String;
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+// TwoWire factice : chaque transaction I2C est journalisée (adresse puis octets écrits).
+// `beforeEnd`, s'il est défini, est appelé à chaque fin de transaction (simulation d'un bus lent).
+// `acknowledges`, s'il est défini, remplace `absent` pour décider de l'acquittement (bus derrière
+// un multiplexeur, où la présence dépend du canal ouvert). `record` à false coupe le journal
+// (mesures sans allocation parasite). Chaque transaction retient l'horloge du bus au moment de
+// son envoi ; `clockChanges` liste les appels à setClock(). Les multiplexeurs TCA9548A (0x70-0x77)
+// sont simulés : chaque transaction retient le premier multiplexeur dont un canal est ouvert.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <vector>
+
+class TwoWire {
+ public:
+  struct Transaction {
+    uint8_t address;
+    std::vector<uint8_t> bytes;
+    uint32_t clockHz = 0;
+    uint8_t muxAddress = 0;   // 0 : aucun canal ouvert.
+    uint8_t muxChannels = 0;  // Masque des canaux ouverts sur muxAddress.
+  };
+
+  static constexpr uint8_t kFirstMux = 0x70;
+  static constexpr uint8_t kLastMux = 0x77;
+
+  void begin(int, int) {}
+  void setClock(uint32_t frequency) {
+    clockHz = frequency;
+    if (record) {
+      clockChanges.push_back(frequency);
+    }
+  }
+
+  void beginTransmission(uint8_t address) {
+    current.address = address;
+    current.bytes.clear();
+  }
+  size_t write(uint8_t value) {
+    current.bytes.push_back(value);
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t length) {
+    current.bytes.insert(current.bytes.end(), data, data + length);
+    return length;
+  }
+  // 0 = acquitté ; 2 = adresse non acquittée (périphérique absent).
+  uint8_t endTransmission() {
+    if (beforeEnd) {
+      beforeEnd();
+    }
+    current.clockHz = clockHz;
+    current.muxAddress = 0;
+    current.muxChannels = 0;
+    for (uint8_t mux = 0; mux <= kLastMux - kFirstMux; ++mux) {
+      if (muxChannels[mux] != 0) {
+        current.muxAddress = static_cast<uint8_t>(kFirstMux + mux);
+        current.muxChannels = muxChannels[mux];
+        break;
+      }
+    }
+    if (record) {
+      log.push_back(current);
+    }
+    const bool acknowledged = acknowledges ? acknowledges(current) : !absent[current.address];
+    if (acknowledged && current.address >= kFirstMux && current.address <= kLastMux && current.bytes.size() == 1) {
+      muxChannels[current.address - kFirstMux] = current.bytes[0];
+    }
+    return acknowledged ? 0 : 2;
+  }
+
+  std::vector<Transaction> log;
+  std::vector<uint32_t> clockChanges;
+  uint32_t clockHz = 100000;  // Défaut du cœur ESP32.
+  bool record = true;
+  bool absent[128] = {};
+  uint8_t muxChannels[kLastMux - kFirstMux + 1] = {};
+  std::function<void()> beforeEnd;
+  std::function<bool(const Transaction &)> acknowledges;
+
+ private:
+  Transaction current{0, {}, 0, 0, 0};
+};
+
+inline TwoWire Wire;
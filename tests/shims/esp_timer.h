@@ -0,0 +1,86 @@
+#pragma once
+
+// Sous-ensemble de esp_timer pour les tests hôte : horloge avancée par le test (advanceEspTimer),
+// rappels exécutés dans le thread appelant. Chaque appel note s'il a eu lieu en section critique.
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+
+using esp_err_t = int;
+constexpr esp_err_t ESP_OK = 0;
+constexpr esp_err_t ESP_ERR_INVALID_STATE = 0x103;
+
+using esp_timer_cb_t = void (*)(void *);
+enum esp_timer_dispatch_t { ESP_TIMER_TASK };
+
+struct esp_timer_create_args_t {
+  esp_timer_cb_t callback;
+  void *arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char *name;
+  bool skip_unhandled_events;
+};
+
+struct esp_timer {
+  esp_timer_cb_t callback = nullptr;
+  void *arg = nullptr;
+  bool armed = false;
+  int64_t deadlineUs = 0;
+};
+using esp_timer_handle_t = esp_timer *;
+
+struct EspTimerShim {
+  int64_t nowUs = 1000000;
+  esp_timer timer;
+  size_t callsInCriticalSection = 0;
+};
+
+inline EspTimerShim espTimerShim;
+
+inline void noteEspTimerCall() {
+  if (criticalSectionDepth > 0) {
+    ++espTimerShim.callsInCriticalSection;
+  }
+}
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *handle) {
+  espTimerShim.timer = esp_timer();
+  espTimerShim.timer.callback = args->callback;
+  espTimerShim.timer.arg = args->arg;
+  *handle = &espTimerShim.timer;
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs) {
+  noteEspTimerCall();
+  if (timer->armed) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  timer->armed = true;
+  timer->deadlineUs = espTimerShim.nowUs + static_cast<int64_t>(timeoutUs);
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  noteEspTimerCall();
+  if (!timer->armed) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  timer->armed = false;
+  return ESP_OK;
+}
+
+inline int64_t esp_timer_get_time() {
+  return espTimerShim.nowUs;
+}
+
+// Avance l'horloge de `us` et exécute le rappel si l'échéance du timer est atteinte.
+inline void advanceEspTimer(int64_t us) {
+  espTimerShim.nowUs += us;
+  esp_timer &timer = espTimerShim.timer;
+  if (timer.armed && timer.deadlineUs <= espTimerShim.nowUs) {
+    timer.armed = false;
+    timer.callback(timer.arg);
+  }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+// Sous-ensemble de FreeRTOS pour les tests hôte : une section critique est un std::mutex.
+// criticalSectionDepth compte les sections ouvertes par le thread courant.
+
+#include <stdint.h>
+
+#include <mutex>
+
+using BaseType_t = int;
+using UBaseType_t = unsigned;
+using TickType_t = uint32_t;
+
+constexpr BaseType_t pdTRUE = 1;
+constexpr BaseType_t pdFALSE = 0;
+constexpr BaseType_t pdPASS = 1;
+constexpr TickType_t portMAX_DELAY = 0xFFFFFFFF;
+constexpr BaseType_t tskNO_AFFINITY = 0x7FFFFFFF;
+
+struct portMUX_TYPE {
+  std::mutex mutex;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED \
+  {}
+inline thread_local int criticalSectionDepth = 0;
+
+#define portENTER_CRITICAL(mux) ((mux)->mutex.lock(), ++criticalSectionDepth)
+#define portEXIT_CRITICAL(mux) (--criticalSectionDepth, (mux)->mutex.unlock())
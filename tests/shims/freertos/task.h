@@ -0,0 +1,74 @@
+#pragma once
+
+// Tâches FreeRTOS simulées par des std::thread, avec leurs notifications (compteur). Les tests
+// attendent qu'une tâche soit de nouveau bloquée sans notification en attente (waitForHostTasksIdle).
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "FreeRTOS.h"
+
+struct HostTask {
+  std::mutex mutex;
+  std::condition_variable changed;
+  uint32_t notifications = 0;
+  bool waiting = false;
+};
+
+using TaskHandle_t = HostTask *;
+using TaskFunction_t = void (*)(void *);
+
+inline thread_local HostTask *currentHostTask = nullptr;
+inline std::mutex hostTasksLock;
+inline std::vector<HostTask *> hostTasks;
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *, uint32_t, void *parameter,
+                                          UBaseType_t, TaskHandle_t *handle, BaseType_t) {
+  HostTask *task = new HostTask();
+  {
+    std::lock_guard<std::mutex> guard(hostTasksLock);
+    hostTasks.push_back(task);
+  }
+  if (handle != nullptr) {
+    *handle = task;
+  }
+  // Tâche sans fin, comme sur la cible : le processus se termine sans la rejoindre.
+  std::thread([function, parameter, task]() {
+    currentHostTask = task;
+    function(parameter);
+  }).detach();
+  return pdPASS;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t task) {
+  std::lock_guard<std::mutex> guard(task->mutex);
+  ++task->notifications;
+  task->changed.notify_all();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t) {
+  HostTask *task = currentHostTask;
+  std::unique_lock<std::mutex> lock(task->mutex);
+  task->waiting = true;
+  task->changed.notify_all();
+  task->changed.wait(lock, [task]() { return task->notifications > 0; });
+  task->waiting = false;
+  const uint32_t value = task->notifications;
+  task->notifications = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+// Attend que chaque tâche créée soit bloquée dans ulTaskNotifyTake() sans notification en attente.
+inline void waitForHostTasksIdle() {
+  std::vector<HostTask *> tasks;
+  {
+    std::lock_guard<std::mutex> guard(hostTasksLock);
+    tasks = hostTasks;
+  }
+  for (HostTask *task : tasks) {
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->changed.wait(lock, [task]() { return task->waiting && task->notifications == 0; });
+  }
+}
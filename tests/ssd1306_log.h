@@ -0,0 +1,79 @@
+#pragma once
+
+// Relecture du journal du TwoWire factice (shims/Wire.h) en plages envoyées à un SSD1306 :
+// une fenêtre (PAGEADDR p p, COLUMNADDR a b en une transaction), puis les données (octet de
+// contrôle 0x40) par paquets. Les sélections de canal des multiplexeurs sont ignorées : chaque
+// plage retient le canal ouvert lors de son envoi (sentTo).
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Adafruit_SSD1306.h>
+#include <Wire.h>
+
+#include <vector>
+
+#include "config.h"
+
+struct PageSpan {
+  uint8_t address;
+  uint8_t muxAddress;  // Canal ouvert lors de l'envoi (TwoWire::Transaction).
+  uint8_t muxChannels;
+  uint8_t page;
+  uint8_t firstColumn;
+  uint8_t lastColumn;
+  std::vector<uint8_t> data;
+  size_t largestChunk;
+  uint32_t slowestClockHz;  // Horloge la plus lente parmi la fenêtre et les paquets de données.
+};
+
+// Fenêtre d'écriture en une transaction : 0x00, PAGEADDR p p, COLUMNADDR a b.
+inline bool isSsd1306Window(const TwoWire::Transaction &transaction) {
+  const std::vector<uint8_t> &bytes = transaction.bytes;
+  return bytes.size() == 7 && bytes[0] == 0x00 && bytes[1] == SSD1306_PAGEADDR && bytes[2] == bytes[3] &&
+         bytes[4] == SSD1306_COLUMNADDR && bytes[5] <= bytes[6];
+}
+
+// false si le journal ne suit pas exactement ce format.
+inline bool decodePageSpans(const std::vector<TwoWire::Transaction> &log, std::vector<PageSpan> &spans) {
+  size_t i = 0;
+  while (i < log.size()) {
+    if (log[i].address >= TwoWire::kFirstMux && log[i].address <= TwoWire::kLastMux) {
+      ++i;
+      continue;
+    }
+    if (!isSsd1306Window(log[i])) {
+      return false;
+    }
+    const std::vector<uint8_t> &window = log[i].bytes;
+    PageSpan span{log[i].address, log[i].muxAddress, log[i].muxChannels, window[2], window[5], window[6], {}, 0,
+                  log[i].clockHz};
+    ++i;
+    const size_t expected = static_cast<size_t>(span.lastColumn - span.firstColumn) + 1;
+    while (span.data.size() < expected) {
+      if (i >= log.size() || log[i].bytes.empty() || log[i].bytes[0] != 0x40 || log[i].address != span.address) {
+        return false;
+      }
+      const size_t chunk = log[i].bytes.size() - 1;
+      span.data.insert(span.data.end(), log[i].bytes.begin() + 1, log[i].bytes.end());
+      span.largestChunk = chunk > span.largestChunk ? chunk : span.largestChunk;
+      span.slowestClockHz = log[i].clockHz < span.slowestClockHz ? log[i].clockHz : span.slowestClockHz;
+      ++i;
+    }
+    if (span.data.size() != expected) {
+      return false;
+    }
+    spans.push_back(span);
+  }
+  return true;
+}
+
+// Vrai si la plage a été envoyée à l'écran placé en `location` : même adresse, et seul son canal
+// ouvert (aucun canal pour un écran relié directement au bus).
+inline bool sentTo(const PageSpan &span, const DisplayLocation &location) {
+  if (location.muxAddress == DISPLAY_NO_MUX) {
+    return span.address == location.address && span.muxAddress == 0;
+  }
+  return span.address == location.address && span.muxAddress == location.muxAddress &&
+         span.muxChannels == (1U << location.muxChannel);
+}
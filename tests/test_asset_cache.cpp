@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "asset_cache.h"
+#include "test_support.h"
+
+namespace {
+
+constexpr const char *kEtag = "\"24c9f22c1e\"";
+
+bool sameText(const char *expected, const char *actual) {
+  return actual != nullptr && strcmp(expected, actual) == 0;
+}
+
+// Manifeste produit par tools/build_assets.py sur data/assets (règle du Makefile).
+std::vector<std::string> manifestLines() {
+  std::vector<std::string> lines;
+  FILE *file = fopen(ASSET_MANIFEST_PATH, "r");
+  CHECK(file != nullptr);
+  if (file == nullptr) {
+    return lines;
+  }
+  char buffer[256];
+  while (fgets(buffer, sizeof(buffer), file) != nullptr) {
+    lines.emplace_back(buffer);
+  }
+  fclose(file);
+  return lines;
+}
+
+}  // namespace
+
+TEST(missing_header_sends_body_with_policy) {
+  const AssetCacheDecision page = decideAssetCache(nullptr, kEtag, false);
+  CHECK(!page.notModified);
+  CHECK(sameText("no-cache", page.cacheControl));
+
+  const AssetCacheDecision script = decideAssetCache(nullptr, kEtag, true);
+  CHECK(!script.notModified);
+  CHECK(sameText("public, max-age=31536000, immutable", script.cacheControl));
+}
+
+TEST(matching_etag_answers_not_modified) {
+  CHECK(decideAssetCache("\"24c9f22c1e\"", kEtag, false).notModified);
+  CHECK(decideAssetCache("\"0000000000\", \"24c9f22c1e\"", kEtag, false).notModified);
+  CHECK(decideAssetCache("\"0000000000\",\"24c9f22c1e\" ", kEtag, false).notModified);
+  CHECK(decideAssetCache("W/\"24c9f22c1e\"", kEtag, false).notModified);
+  CHECK(decideAssetCache("*", kEtag, false).notModified);
+  // La politique de cache accompagne aussi le 304.
+  CHECK(sameText("no-cache", decideAssetCache(kEtag, kEtag, false).cacheControl));
+  CHECK(sameText("public, max-age=31536000, immutable", decideAssetCache(kEtag, kEtag, true).cacheControl));
+}
+
+TEST(other_etags_send_body) {
+  CHECK(!decideAssetCache("", kEtag, false).notModified);
+  CHECK(!decideAssetCache("\"0000000000\"", kEtag, false).notModified);
+  CHECK(!decideAssetCache("\"24c9f22c1\"", kEtag, false).notModified);    // Préfixe.
+  CHECK(!decideAssetCache("\"24c9f22c1e0\"", kEtag, false).notModified);  // Plus long.
+  CHECK(!decideAssetCache("24c9f22c1e", kEtag, false).notModified);       // Sans guillemets.
+  CHECK(!decideAssetCache("W/", kEtag, false).notModified);
+  CHECK(!decideAssetCache(" , ,", kEtag, false).notModified);
+}
+
+TEST(parses_generated_manifest) {
+  const std::vector<std::string> lines = manifestLines();
+  CHECK_EQ(3, lines.size());
+  size_t pages = 0;
+  size_t immutables = 0;
+  for (const std::string &line : lines) {
+    CompressedAsset asset;
+    CHECK(parseAssetManifestLine(String(line.c_str()), asset));
+    CHECK_EQ(12, asset.etag.length());  // Empreinte de 10 caractères entre guillemets.
+    CHECK(asset.etag.startsWith("\"") && asset.etag.endsWith("\""));
+    CHECK(!asset.contentType.endsWith("\n"));
+    if (asset.path == "/index.html") {
+      ++pages;
+      CHECK(!asset.immutable);
+      CHECK(asset.contentType == "text/html; charset=utf-8");
+    } else {
+      ++immutables;
+      CHECK(asset.immutable);
+      CHECK(asset.path.endsWith(".js") || asset.path.endsWith(".css"));
+    }
+  }
+  CHECK_EQ(1, pages);
+  CHECK_EQ(2, immutables);
+}
+
+TEST(rejects_malformed_manifest_lines) {
+  CompressedAsset asset;
+  CHECK(!parseAssetManifestLine("", asset));
+  CHECK(!parseAssetManifestLine("/index.html", asset));
+  CHECK(!parseAssetManifestLine("/index.html\t24c9f22c1e\t0", asset));
+  CHECK(!parseAssetManifestLine("index.html\t24c9f22c1e\t0\ttext/html", asset));  // Chemin relatif.
+
+  CHECK(parseAssetManifestLine("/app.a7575d99c3.js\ta7575d99c3\t1\tapplication/javascript\r\n", asset));
+  CHECK(asset.path == "/app.a7575d99c3.js");
+  CHECK(asset.etag == "\"a7575d99c3\"");
+  CHECK(asset.immutable);
+  CHECK(asset.contentType == "application/javascript");
+}
@@ -0,0 +1,173 @@
+#include <vector>
+
+#include "button_debounce.h"
+#include "test_support.h"
+
+namespace {
+
+constexpr uint32_t kDebounceUs = 40000;
+constexpr int kReleased = 1;  // Entrée en pull-up : appui au niveau bas.
+constexpr int kPressed = 0;
+
+struct Press {
+  size_t index;
+  uint32_t pressedAtUs;
+};
+
+// Banc de deux boutons avec une file de quatre fronts ; les niveaux « réels » sont ceux que
+// lirait digitalRead() pendant le traitement.
+struct Bench {
+  DebouncedButtons<2, 4> buttons{kDebounceUs, kPressed};
+  int levels[2] = {kReleased, kReleased};
+  std::vector<Press> presses;
+
+  Bench() {
+    buttons.configure(0, kReleased);
+    buttons.configure(1, kReleased);
+  }
+
+  void edge(size_t index, int level, uint32_t timestampUs) {
+    levels[index] = level;
+    buttons.pushEdge({static_cast<uint8_t>(index), static_cast<uint8_t>(level), timestampUs});
+  }
+
+  void process(uint32_t nowUs, bool pollLevels = false) {
+    buttons.process(
+        nowUs, pollLevels, [this](size_t index) { return levels[index]; },
+        [this](size_t index, uint32_t pressedAtUs) { presses.push_back({index, pressedAtUs}); });
+  }
+};
+
+}  // namespace
+
+TEST(bounce_burst_gives_one_press_dated_from_first_edge) {
+  ButtonDebouncer button;
+  button.configure(kReleased);
+  uint32_t pressedAtUs = 0;
+  const uint32_t burst[] = {1000, 1300, 1900, 2600, 4000};
+  int level = kPressed;
+  for (uint32_t at : burst) {
+    CHECK(!button.settle(at, kDebounceUs, kPressed, pressedAtUs));
+    button.recordEdge(level, at);
+    level = level == kPressed ? kReleased : kPressed;
+  }
+  // Stable depuis le dernier rebond (4000 µs) : rien avant 44000 µs.
+  CHECK(!button.settle(4000 + kDebounceUs - 1, kDebounceUs, kPressed, pressedAtUs));
+  CHECK(button.settle(4000 + kDebounceUs, kDebounceUs, kPressed, pressedAtUs));
+  CHECK_EQ(1000, pressedAtUs);
+  CHECK(!button.settle(200000, kDebounceUs, kPressed, pressedAtUs));
+}
+
+TEST(bounce_back_to_released_gives_no_press) {
+  ButtonDebouncer button;
+  button.configure(kReleased);
+  uint32_t pressedAtUs = 0;
+  button.recordEdge(kPressed, 1000);
+  button.recordEdge(kReleased, 1500);
+  CHECK(!button.settle(100000, kDebounceUs, kPressed, pressedAtUs));
+}
+
+TEST(long_press_fires_once_and_release_is_silent) {
+  Bench bench;
+  bench.edge(0, kPressed, 10000);
+  bench.edge(0, kReleased, 10200);
+  bench.edge(0, kPressed, 10500);
+  bench.process(20000);
+  CHECK_EQ(0, bench.presses.size());
+
+  // Maintenu deux secondes, avec des passages de loop() réguliers.
+  for (uint32_t now = 50000; now < 2000000; now += 10000) {
+    bench.process(now);
+  }
+  CHECK_EQ(1, bench.presses.size());
+  CHECK_EQ(0, bench.presses[0].index);
+  CHECK_EQ(10000, bench.presses[0].pressedAtUs);
+
+  bench.edge(0, kReleased, 2000000);
+  bench.edge(0, kPressed, 2000300);
+  bench.edge(0, kReleased, 2000600);
+  bench.process(2100000);
+  CHECK_EQ(1, bench.presses.size());
+}
+
+TEST(slow_loop_replays_edges_with_their_own_timestamps) {
+  Bench bench;
+  // Deux appuis francs traités en une seule fois, bien après coup.
+  bench.edge(1, kPressed, 1000);
+  bench.edge(1, kReleased, 100000);
+  bench.edge(1, kPressed, 200000);
+  bench.process(500000);
+  CHECK_EQ(2, bench.presses.size());
+  if (bench.presses.size() == 2) {
+    CHECK_EQ(1000, bench.presses[0].pressedAtUs);
+    CHECK_EQ(200000, bench.presses[1].pressedAtUs);
+  }
+}
+
+TEST(edge_from_concurrent_isr_counts_as_recent) {
+  ButtonDebouncer button;
+  button.configure(kReleased);
+  uint32_t pressedAtUs = 0;
+  button.recordEdge(kPressed, 50000);
+  // `nowUs` lu avant le front : la différence négative ne doit pas valider.
+  CHECK(!button.settle(49990, kDebounceUs, kPressed, pressedAtUs));
+  CHECK(button.settle(50000 + kDebounceUs, kDebounceUs, kPressed, pressedAtUs));
+}
+
+TEST(full_ring_falls_back_to_level_polling) {
+  Bench bench;
+  // Quatre places : les rebonds du bouton 1 et l'appui du bouton 0 sont perdus.
+  bench.edge(1, kPressed, 1000);
+  bench.edge(1, kReleased, 1100);
+  bench.edge(1, kPressed, 1200);
+  bench.edge(1, kReleased, 1300);
+  bench.edge(0, kPressed, 1400);
+  bench.edge(1, kPressed, 1500);
+  bench.process(2000);
+  CHECK_EQ(0, bench.presses.size());
+
+  // Les niveaux lus au débordement complètent les fronts perdus : le bouton 0 est daté de ce
+  // traitement, le bouton 1 du début de sa rafale, encore en cours.
+  bench.process(2000 + kDebounceUs);
+  CHECK_EQ(2, bench.presses.size());
+  for (const Press &press : bench.presses) {
+    CHECK_EQ(press.index == 0 ? 2000 : 1000, press.pressedAtUs);
+  }
+
+  // Débordement consommé : plus de lecture des niveaux sans nouveau front.
+  bench.levels[0] = kReleased;
+  bench.process(200000);
+  bench.levels[0] = kPressed;
+  bench.process(400000);
+  CHECK_EQ(2, bench.presses.size());
+}
+
+TEST(polling_without_interrupts_debounces_levels) {
+  Bench bench;
+  bench.levels[0] = kPressed;
+  bench.process(1000, true);
+  bench.levels[0] = kReleased;  // Rebond vu par la lecture suivante.
+  bench.process(5000, true);
+  bench.levels[0] = kPressed;
+  bench.process(9000, true);
+  bench.process(9000 + kDebounceUs - 1, true);
+  CHECK_EQ(0, bench.presses.size());
+  bench.process(9000 + kDebounceUs, true);
+  CHECK_EQ(1, bench.presses.size());
+  if (!bench.presses.empty()) {
+    CHECK_EQ(1000, bench.presses[0].pressedAtUs);
+  }
+}
+
+TEST(ignores_unconfigured_and_out_of_range_buttons) {
+  DebouncedButtons<2, 4> buttons{kDebounceUs, kPressed};
+  buttons.configure(0, kReleased);
+  size_t presses = 0;
+  buttons.pushEdge({1, static_cast<uint8_t>(kPressed), 1000});
+  buttons.pushEdge({7, static_cast<uint8_t>(kPressed), 1000});
+  buttons.process(
+      100000, true, [](size_t) { return kPressed; }, [&](size_t index, uint32_t) { presses += index == 0 ? 1 : 100; });
+  buttons.process(
+      200000, false, [](size_t) { return kPressed; }, [&](size_t index, uint32_t) { presses += index == 0 ? 1 : 100; });
+  CHECK_EQ(1, presses);  // Seul le bouton 0, configuré, est lu.
+}
@@ -0,0 +1,80 @@
+#include "clock_offset.h"
+#include "test_support.h"
+
+namespace {
+
+constexpr uint32_t kMaxRoundTripUs = 100000;
+constexpr uint32_t kDriftPpm = 100;
+constexpr int64_t kTrueOffsetUs = 5000000;  // Contrôleur en avance de 5 s.
+
+using Estimator = ClockOffsetEstimator<4>;
+
+// Échange simulé : le contrôleur horodate sa réponse après `upUs` de trajet aller, la réponse
+// revient en `downUs`. Un trajet asymétrique fausse l'écart mesuré de (upUs - downUs) / 2.
+bool exchange(Estimator &clock, uint64_t sentAtUs, uint32_t upUs, uint32_t downUs) {
+  const int64_t remoteUs = static_cast<int64_t>(sentAtUs + upUs) + kTrueOffsetUs;
+  return clock.addSample(sentAtUs, remoteUs, sentAtUs + upUs + downUs);
+}
+
+}  // namespace
+
+TEST(no_sample_is_invalid) {
+  const Estimator clock(kMaxRoundTripUs, kDriftPpm);
+  CHECK(!clock.estimate(0).valid);
+  CHECK_EQ(0, clock.sampleCount());
+}
+
+TEST(symmetric_exchange_gives_exact_offset) {
+  Estimator clock(kMaxRoundTripUs, kDriftPpm);
+  CHECK(exchange(clock, 1000000, 2000, 2000));
+  const ClockEstimate estimate = clock.estimate(1004000);
+  CHECK(estimate.valid);
+  CHECK_EQ(kTrueOffsetUs, estimate.offsetUs);
+  CHECK_EQ(2000, estimate.uncertaintyUs);  // Demi aller-retour, sans dérive mesurable.
+}
+
+TEST(selects_minimum_uncertainty_sample) {
+  Estimator clock(kMaxRoundTripUs, kDriftPpm);
+  CHECK(exchange(clock, 1000000, 30000, 2000));  // Lent et asymétrique : écart faussé de 14 ms.
+  CHECK(exchange(clock, 1100000, 500, 500));     // Court : retenu.
+  CHECK(exchange(clock, 1200000, 10000, 10000));
+  const ClockEstimate estimate = clock.estimate(1300500);
+  CHECK(estimate.valid);
+  CHECK_EQ(kTrueOffsetUs, estimate.offsetUs);
+  // 500 µs de demi aller-retour + 200 ms d'âge (depuis le milieu de l'échange) à 100 ppm.
+  CHECK_EQ(500 + 20, estimate.uncertaintyUs);
+}
+
+TEST(drift_ages_out_old_samples) {
+  Estimator clock(kMaxRoundTripUs, kDriftPpm);
+  CHECK(exchange(clock, 0, 100, 100));               // Très court, mais ancien.
+  CHECK(exchange(clock, 60000000, 1000, 1000));      // Une minute plus tard, plus long.
+
+  // Juste après le second échange, l'ancien a accumulé 6 ms de dérive possible : le récent gagne.
+  ClockEstimate estimate = clock.estimate(60002000);
+  CHECK_EQ(1000, estimate.uncertaintyUs);
+
+  // Sans nouvel échange, l'incertitude retenue croît avec l'âge de l'échange.
+  estimate = clock.estimate(60002000 + 10000000);
+  CHECK_EQ(1000 + 1000, estimate.uncertaintyUs);
+}
+
+TEST(rejects_invalid_round_trips) {
+  Estimator clock(kMaxRoundTripUs, kDriftPpm);
+  CHECK(!clock.addSample(2000, kTrueOffsetUs, 1000));                    // Réponse avant la sonde.
+  CHECK(!clock.addSample(0, kTrueOffsetUs, kMaxRoundTripUs + 1));        // Aller-retour trop long.
+  CHECK_EQ(0, clock.sampleCount());
+  CHECK(!clock.estimate(kMaxRoundTripUs).valid);
+  CHECK(clock.addSample(0, kTrueOffsetUs, kMaxRoundTripUs));             // À la limite : accepté.
+  CHECK_EQ(1, clock.sampleCount());
+}
+
+TEST(window_keeps_latest_samples) {
+  Estimator clock(kMaxRoundTripUs, kDriftPpm);
+  CHECK(exchange(clock, 0, 50, 50));  // Le meilleur échange, puis évincé par les quatre suivants.
+  for (uint64_t i = 1; i <= 4; ++i) {
+    CHECK(exchange(clock, i * 1000, 400, 400));
+  }
+  CHECK_EQ(4, clock.sampleCount());
+  CHECK_EQ(400, clock.estimate(5000).uncertaintyUs);
+}
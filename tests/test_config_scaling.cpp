@@ -0,0 +1,188 @@
+// Vérifications à 64 cues (compilé avec -DSTAGECUE_CUE_COUNT=64) : capacités des documents JSON,
+// tables de configuration et adressage des écrans derrière des multiplexeurs TCA9548A.
+
+#include <string.h>
+
+#include <type_traits>
+#include <vector>
+
+#include <Wire.h>
+
+#include "config.h"
+#include "cue_json.h"
+#include "cue_store.h"
+#include "display_manager.h"
+#include "latency_metrics.h"
+#include "test_support.h"
+
+static_assert(CUE_COUNT == 64, "Ce test se compile avec -DSTAGECUE_CUE_COUNT=64");
+
+// Quatre multiplexeurs (0x70-0x73), huit canaux, deux écrans par canal (0x3C, 0x3D). Les cues
+// voisins sont sur des multiplexeurs différents : l'ordre de rafraîchissement doit les regrouper.
+const DisplayLocation displayLocations[] = {
+    {0x70, 0, 0x3C}, {0x71, 0, 0x3C}, {0x72, 0, 0x3C}, {0x73, 0, 0x3C}, {0x70, 1, 0x3C}, {0x71, 1, 0x3C}, {0x72, 1, 0x3C}, {0x73, 1, 0x3C},
+    {0x70, 2, 0x3C}, {0x71, 2, 0x3C}, {0x72, 2, 0x3C}, {0x73, 2, 0x3C}, {0x70, 3, 0x3C}, {0x71, 3, 0x3C}, {0x72, 3, 0x3C}, {0x73, 3, 0x3C},
+    {0x70, 4, 0x3C}, {0x71, 4, 0x3C}, {0x72, 4, 0x3C}, {0x73, 4, 0x3C}, {0x70, 5, 0x3C}, {0x71, 5, 0x3C}, {0x72, 5, 0x3C}, {0x73, 5, 0x3C},
+    {0x70, 6, 0x3C}, {0x71, 6, 0x3C}, {0x72, 6, 0x3C}, {0x73, 6, 0x3C}, {0x70, 7, 0x3C}, {0x71, 7, 0x3C}, {0x72, 7, 0x3C}, {0x73, 7, 0x3C},
+    {0x70, 0, 0x3D}, {0x71, 0, 0x3D}, {0x72, 0, 0x3D}, {0x73, 0, 0x3D}, {0x70, 1, 0x3D}, {0x71, 1, 0x3D}, {0x72, 1, 0x3D}, {0x73, 1, 0x3D},
+    {0x70, 2, 0x3D}, {0x71, 2, 0x3D}, {0x72, 2, 0x3D}, {0x73, 2, 0x3D}, {0x70, 3, 0x3D}, {0x71, 3, 0x3D}, {0x72, 3, 0x3D}, {0x73, 3, 0x3D},
+    {0x70, 4, 0x3D}, {0x71, 4, 0x3D}, {0x72, 4, 0x3D}, {0x73, 4, 0x3D}, {0x70, 5, 0x3D}, {0x71, 5, 0x3D}, {0x72, 5, 0x3D}, {0x73, 5, 0x3D},
+    {0x70, 6, 0x3D}, {0x71, 6, 0x3D}, {0x72, 6, 0x3D}, {0x73, 6, 0x3D}, {0x70, 7, 0x3D}, {0x71, 7, 0x3D}, {0x72, 7, 0x3D}, {0x73, 7, 0x3D},
+};
+static_assert(sizeof(displayLocations) / sizeof(displayLocations[0]) == CUE_COUNT,
+              "displayLocations doit contenir une entrée par cue");
+
+// Les métriques de latence ne sont pas liées à ce test.
+void markTriggerStage(size_t, LatencyStage) {}
+
+// Un cue seul reste sur la pile ; la liste de 64 cues (plus de 9 Kio) passe sur le tas.
+static_assert(std::is_base_of<StaticJsonDocument<CUE_JSON_CAPACITY>, CueJsonDocument>::value,
+              "Le document d'un cue doit rester sur la pile");
+static_assert(std::is_base_of<DynamicJsonDocument, CueListJsonDocument>::value,
+              "Le document de 64 cues doit être alloué sur le tas");
+static_assert(cueListJsonCapacity(3) <= JSON_STACK_CAPACITY_LIMIT,
+              "La configuration par défaut (3 cues) doit rester sur la pile");
+
+namespace {
+
+constexpr uint8_t kFirstMux = 0x70;
+constexpr uint8_t kLastMux = 0x77;
+
+// Bus simulé : canaux ouverts de chaque multiplexeur et écrans présents. Chaque transaction
+// adressée à un écran est attribuée au seul écran joignable, -1 si aucun, -2 si plusieurs
+// écrans de même adresse répondent ensemble.
+struct MuxBus {
+  uint8_t openChannels[8] = {0};
+  bool muxAbsent[8] = {false};
+  bool displayAbsent[CUE_COUNT] = {false};
+  std::vector<int> targets;
+  size_t muxWrites = 0;
+
+  bool acknowledge(const TwoWire::Transaction &transaction) {
+    if (transaction.address >= kFirstMux && transaction.address <= kLastMux) {
+      const size_t mux = transaction.address - kFirstMux;
+      targets.push_back(-1);
+      if (muxAbsent[mux] || transaction.bytes.size() != 1) {
+        return false;
+      }
+      openChannels[mux] = transaction.bytes[0];
+      ++muxWrites;
+      return true;
+    }
+    int target = -1;
+    for (size_t i = 0; i < CUE_COUNT; ++i) {
+      const DisplayLocation &location = displayLocations[i];
+      const bool reachable = location.address == transaction.address &&
+                             (location.muxAddress == DISPLAY_NO_MUX ||
+                              (!muxAbsent[location.muxAddress - kFirstMux] &&
+                               (openChannels[location.muxAddress - kFirstMux] & (1U << location.muxChannel)) != 0));
+      if (reachable && !displayAbsent[i]) {
+        target = target == -1 ? static_cast<int>(i) : -2;
+      }
+    }
+    targets.push_back(target);
+    return target >= 0;
+  }
+};
+
+MuxBus bus;
+
+// Les canaux restent ouverts d'un test à l'autre, comme sur le vrai bus.
+void resetBus() {
+  MuxBus fresh;
+  memcpy(fresh.openChannels, bus.openChannels, sizeof(fresh.openChannels));
+  bus = fresh;
+  Wire.log.clear();
+  Wire.acknowledges = [](const TwoWire::Transaction &transaction) { return bus.acknowledge(transaction); };
+}
+
+// Transactions d'écran (hors multiplexeurs) émises depuis `from`, toutes destinées à `index`.
+bool onlyReaches(size_t from, size_t index) {
+  size_t displayTransactions = 0;
+  for (size_t t = from; t < Wire.log.size(); ++t) {
+    const uint8_t address = Wire.log[t].address;
+    if (address >= kFirstMux && address <= kLastMux) {
+      continue;
+    }
+    ++displayTransactions;
+    if (bus.targets[t] != static_cast<int>(index)) {
+      return false;
+    }
+  }
+  return displayTransactions > 0;
+}
+
+}  // namespace
+
+TEST(cue_store_holds_64_texts) {
+  CueStore store;
+  const char text[] = "Cue 64";
+  CHECK(store.assignText(CUE_COUNT - 1, text, sizeof(text) - 1));
+  CueTextCopy copy;
+  store.copyText(CUE_COUNT - 1, copy);
+  CHECK_EQ(sizeof(text) - 1, copy.length);
+  store.copyText(0, copy);
+  CHECK_EQ(0, copy.length);
+}
+
+TEST(init_reaches_each_display_through_its_mux_channel) {
+  resetBus();
+  initDisplay();
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    CHECK(isDisplayReady(i));
+  }
+  for (const int target : bus.targets) {
+    CHECK(target != -2);
+  }
+  // Trié par (multiplexeur, canal) : 32 ouvertures de canal et 3 fermetures de multiplexeur.
+  CHECK_EQ(35, bus.muxWrites);
+}
+
+TEST(each_update_reaches_only_its_display) {
+  // Pas premier avec 64 : tous les cues, en sautant d'un multiplexeur et d'un canal à l'autre.
+  for (size_t step = 0; step < CUE_COUNT; ++step) {
+    const size_t index = (step * 37) % CUE_COUNT;
+    const size_t from = Wire.log.size();
+    const char text[] = {'C', static_cast<char>('A' + step % 26), '\0'};
+    updateDisplay(index, text, 2);
+    CHECK(onlyReaches(from, index));
+  }
+}
+
+TEST(unreachable_mux_keeps_frame_in_sync_with_panel) {
+  resetBus();
+  initDisplay();
+  const size_t index = 5;  // Multiplexeur 0x71, canal 1.
+  updateDisplay(index, "Rideau", 6);
+
+  updateDisplay(0, "Cour", 4);  // Multiplexeur 0x70 : le canal de l'écran 5 sera rouvert.
+
+  // Multiplexeur muet pendant un changement : rien n'est envoyé, l'écran montre toujours "Rideau".
+  bus.muxAbsent[1] = true;
+  size_t from = Wire.log.size();
+  updateDisplay(index, "Noir", 4);
+  CHECK(!onlyReaches(from, index));
+
+  // De retour, le même texte doit partir : l'image de référence est celle de l'écran.
+  bus.muxAbsent[1] = false;
+  from = Wire.log.size();
+  updateDisplay(index, "Noir", 4);
+  CHECK(onlyReaches(from, index));
+  from = Wire.log.size();
+  updateDisplay(index, "Noir", 4);
+  CHECK(!onlyReaches(from, index));
+}
+
+TEST(missing_display_and_mux_are_isolated) {
+  resetBus();
+  bus.displayAbsent[37] = true;
+  bus.muxAbsent[3] = true;  // 0x73 : les 16 écrans de ses canaux.
+  initDisplay();
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    const bool expected = i != 37 && displayLocations[i].muxAddress != 0x73;
+    CHECK_EQ(expected, isDisplayReady(i));
+  }
+  for (const int target : bus.targets) {
+    CHECK(target != -2);
+  }
+}
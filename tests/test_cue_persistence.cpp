@@ -0,0 +1,272 @@
+#include <Preferences.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config.h"
+#include "cue_persistence.h"
+#include "test_support.h"
+
+namespace {
+
+constexpr const char *kNamespace = "cue_texts";
+constexpr const char *kBlobKey = "texts";
+
+std::map<std::string, PreferencesStore::Entry> &nvs() {
+  return preferencesStore.namespaces[kNamespace];
+}
+
+void resetNvs() {
+  preferencesStore = PreferencesStore();
+}
+
+void putLegacyText(size_t index, const char *text) {
+  Preferences prefs;
+  prefs.begin(kNamespace);
+  prefs.putString(("cue" + std::to_string(index)).c_str(), text);
+  preferencesStore.putStringCalls = 0;
+}
+
+std::string persistedText(size_t index) {
+  char text[MAX_CUE_TEXT_LENGTH];
+  size_t length = 0;
+  if (!loadPersistedCueText(index, text, length)) {
+    return "<absent>";
+  }
+  return std::string(text, length);
+}
+
+void persist(size_t index, const std::string &text) {
+  persistCueTextDeferred(index, text.data(), text.size());
+}
+
+uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1U) != 0 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+// L'état de cue_persistence.cpp est global et ne se réinitialise pas : chaque étape s'exécute
+// dans un processus fils (module neuf, NVS factice héritée du parent), comme après un
+// redémarrage. Le blob écrit par le fils est renvoyé au parent par un tube.
+std::vector<uint8_t> runIsolated(const std::function<void()> &body) {
+  int channel[2];
+  if (pipe(channel) != 0) {
+    CHECK(false);
+    return {};
+  }
+  fflush(nullptr);
+  const int failuresBefore = test::failures();
+  const pid_t child = fork();
+  if (child == 0) {
+    close(channel[0]);
+    body();
+    const auto found = nvs().find(kBlobKey);
+    if (found != nvs().end()) {
+      const std::vector<uint8_t> &bytes = found->second.bytes;
+      if (write(channel[1], bytes.data(), bytes.size()) != static_cast<ssize_t>(bytes.size())) {
+        _exit(2);
+      }
+    }
+    fflush(nullptr);
+    _exit(test::failures() == failuresBefore ? 0 : 1);
+  }
+  close(channel[1]);
+  std::vector<uint8_t> blob;
+  uint8_t chunk[256];
+  ssize_t received;
+  while ((received = read(channel[0], chunk, sizeof(chunk))) > 0) {
+    blob.insert(blob.end(), chunk, chunk + received);
+  }
+  close(channel[0]);
+  int status = 0;
+  waitpid(child, &status, 0);
+  CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  return blob;
+}
+
+void storeBlob(const std::vector<uint8_t> &blob) {
+  PreferencesStore::Entry &entry = nvs()[kBlobKey];
+  entry.isString = false;
+  entry.bytes = blob;
+}
+
+// Blob valide : cue 0 et cue 2 renseignés, cue 1 absent.
+std::vector<uint8_t> validBlob() {
+  resetNvs();
+  return runIsolated([] {
+    initCuePersistence();
+    persist(0, "Rideau");
+    persist(2, "Côté jardin");
+    flushCuePersistence();
+  });
+}
+
+}  // namespace
+
+TEST(migrates_legacy_keys_into_crc_blob) {
+  resetNvs();
+  putLegacyText(0, "Rideau");
+  putLegacyText(2, "Noir salle");
+  const std::vector<uint8_t> blob = runIsolated([] {
+    initCuePersistence();
+    CHECK(persistedText(0) == "Rideau");
+    CHECK(persistedText(1) == "<absent>");
+    CHECK(persistedText(2) == "Noir salle");
+    CHECK_EQ(1, preferencesStore.putBytesCalls);
+    CHECK(nvs().count("cue0") == 0);
+    CHECK(nvs().count("cue2") == 0);
+  });
+
+  // En-tête : "SCUE", version 1, CUE_COUNT, longueur puis CRC32 de la charge utile.
+  CHECK(blob.size() > 12);
+  if (blob.size() > 12) {
+    CHECK(blob[0] == 'S' && blob[1] == 'C' && blob[2] == 'U' && blob[3] == 'E');
+    CHECK_EQ(1, blob[4]);
+    CHECK_EQ(CUE_COUNT, blob[5]);
+    CHECK_EQ(blob.size() - 12, blob[6] | blob[7] << 8);
+    const uint32_t stored = blob[8] | blob[9] << 8 | blob[10] << 16 | static_cast<uint32_t>(blob[11]) << 24;
+    CHECK_EQ(crc32(blob.data() + 12, blob.size() - 12), stored);
+  }
+}
+
+TEST(rapid_edits_collapse_into_one_write) {
+  resetNvs();
+  runIsolated([] {
+    initCuePersistence();
+    for (int edit = 0; edit < 20; ++edit) {
+      persist(static_cast<size_t>(edit) % CUE_COUNT, "Edition " + std::to_string(edit));
+    }
+    const uint32_t now = millis();
+    serviceCuePersistence(now);
+    serviceCuePersistence(now + CUE_PERSIST_DEBOUNCE_MS - 100);
+    CHECK_EQ(0, preferencesStore.putBytesCalls);
+    serviceCuePersistence(now + CUE_PERSIST_DEBOUNCE_MS);
+    CHECK_EQ(1, preferencesStore.putBytesCalls);
+    serviceCuePersistence(now + 2 * CUE_PERSIST_DEBOUNCE_MS);
+    CHECK_EQ(1, preferencesStore.putBytesCalls);
+  });
+}
+
+TEST(rejects_blob_with_bad_crc_or_size) {
+  const std::vector<uint8_t> valid = validBlob();
+  CHECK(valid.size() > 12);
+  if (valid.size() <= 12) {
+    return;
+  }
+
+  std::vector<std::vector<uint8_t>> corrupted;
+  corrupted.push_back(valid);
+  corrupted.back()[14] ^= 0x01;  // Charge utile modifiée : CRC faux.
+  corrupted.push_back(valid);
+  corrupted.back()[8] ^= 0x80;  // CRC stocké modifié.
+  corrupted.push_back(valid);
+  corrupted.back().pop_back();  // Tronqué.
+  corrupted.push_back(valid);
+  corrupted.back().push_back(0);  // Octet en trop.
+  corrupted.push_back(std::vector<uint8_t>(valid.begin(), valid.begin() + 8));  // En-tête incomplet.
+
+  for (const std::vector<uint8_t> &blob : corrupted) {
+    resetNvs();
+    storeBlob(blob);
+    runIsolated([] {
+      initCuePersistence();
+      for (size_t i = 0; i < CUE_COUNT; ++i) {
+        CHECK(persistedText(i) == "<absent>");
+      }
+      CHECK_EQ(0, preferencesStore.putBytesCalls);
+    });
+  }
+}
+
+TEST(forced_flush_waits_for_running_write) {
+  resetNvs();
+  const std::vector<uint8_t> blob = runIsolated([] {
+    initCuePersistence();
+    persist(0, "Avant");
+
+    // L'écriture lancée par loop() reste bloquée dans putBytes() jusqu'à `release`.
+    std::atomic<bool> inWrite{false};
+    std::atomic<bool> release{false};
+    preferencesStore.beforePutBytes = [&] {
+      if (preferencesStore.putBytesCalls == 0) {
+        inWrite = true;
+        while (!release) {
+          std::this_thread::yield();
+        }
+      }
+    };
+    std::thread loopTask([] { serviceCuePersistence(millis() + CUE_PERSIST_DEBOUNCE_MS); });
+    while (!inWrite) {
+      std::this_thread::yield();
+    }
+
+    persist(0, "Apres");
+    std::atomic<bool> flushed{false};
+    std::thread restart([&] {
+      flushCuePersistence();
+      flushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CHECK(!flushed);  // Attend la fin de l'écriture en cours.
+    release = true;
+    loopTask.join();
+    restart.join();
+    preferencesStore.beforePutBytes = nullptr;
+    CHECK(flushed);
+    CHECK_EQ(2, preferencesStore.putBytesCalls);
+  });
+
+  storeBlob(blob);
+  runIsolated([] {
+    initCuePersistence();
+    CHECK(persistedText(0) == "Apres");
+  });
+}
+
+TEST(failed_write_is_retried) {
+  resetNvs();
+  runIsolated([] {
+    initCuePersistence();
+    persist(1, "Top");
+    preferencesStore.failPutBytes = true;
+    flushCuePersistence();
+    CHECK_EQ(1, preferencesStore.putBytesCalls);
+    preferencesStore.failPutBytes = false;
+    flushCuePersistence();
+    CHECK_EQ(2, preferencesStore.putBytesCalls);
+  });
+}
+
+TEST(reload_round_trip) {
+  const std::string longest(MAX_CUE_TEXT_LENGTH, 'x');
+  resetNvs();
+  const std::vector<uint8_t> blob = runIsolated([&] {
+    initCuePersistence();
+    persist(0, "Entrée côté cour");
+    persist(CUE_COUNT - 1, longest);
+    flushCuePersistence();
+  });
+
+  resetNvs();
+  storeBlob(blob);
+  runIsolated([&] {
+    initCuePersistence();
+    CHECK(persistedText(0) == "Entrée côté cour");
+    CHECK(persistedText(CUE_COUNT - 1) == longest);
+    for (size_t i = 1; i + 1 < CUE_COUNT; ++i) {
+      CHECK(persistedText(i) == "<absent>");
+    }
+    CHECK_EQ(0, preferencesStore.putBytesCalls);  // Lecture seule au démarrage.
+  });
+}
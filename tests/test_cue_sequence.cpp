@@ -0,0 +1,146 @@
+#include "cue_sequence.h"
+#include "test_support.h"
+
+namespace {
+
+CueStep fire(uint8_t target, uint32_t delayMs, bool autoFollow) {
+  CueStep step{};
+  step.action = CueStepAction::Fire;
+  step.target = target;
+  step.textId = CUE_STEP_NO_TEXT;
+  step.delayMs = delayMs;
+  step.autoFollow = autoFollow;
+  return step;
+}
+
+// Points de GO : 0 (suivi de 1 et 2 enchaînés), 3, 4.
+const CueStep kSteps[] = {
+    fire(0, 0, false), fire(1, 1000, true), fire(2, 500, true), fire(0, 0, false), fire(1, 200, false),
+};
+constexpr size_t kStepCount = sizeof(kSteps) / sizeof(kSteps[0]);
+
+}  // namespace
+
+TEST(go_plays_auto_follow_chain) {
+  CueSequence sequence;
+  sequence.load(kSteps, kStepCount);
+  DueCueStep out[8];
+
+  sequence.go(1000000);
+  CHECK_EQ(3, sequence.playhead());  // Le curseur saute les pas enchaînés.
+  CHECK(sequence.running());
+  CHECK_EQ(1000000, sequence.nextDueUs());
+
+  // Interrogé en retard : les échéances restent celles prévues, sans dérive.
+  size_t count = sequence.poll(2400000, out, 8);
+  CHECK_EQ(2, count);
+  CHECK_EQ(0, out[0].index);
+  CHECK_EQ(1000000, out[0].dueUs);
+  CHECK_EQ(1, out[1].index);
+  CHECK_EQ(2000000, out[1].dueUs);
+
+  CHECK_EQ(0, sequence.poll(2499999, out, 8));
+  count = sequence.poll(2700000, out, 8);
+  CHECK_EQ(1, count);
+  CHECK_EQ(2, out[0].index);
+  CHECK_EQ(2500000, out[0].dueUs);
+  CHECK(!sequence.running());
+}
+
+TEST(go_point_waits_for_its_own_go) {
+  CueSequence sequence;
+  sequence.load(kSteps, kStepCount);
+  DueCueStep out[8];
+  sequence.go(0);
+  CHECK_EQ(3, sequence.poll(UINT64_MAX, out, 8));  // S'arrête avant le pas 3 (GO requis).
+  CHECK(!sequence.running());
+  CHECK_EQ(3, sequence.playhead());
+}
+
+TEST(poll_respects_capacity) {
+  CueStep chain[6];
+  for (uint8_t i = 0; i < 6; ++i) {
+    chain[i] = fire(i, 0, i != 0);
+  }
+  CueSequence sequence;
+  sequence.load(chain, 6);
+  DueCueStep out[4];
+  sequence.go(0);
+
+  // Six pas dus au même instant : rendus par lots de la capacité fournie, dans l'ordre.
+  CHECK_EQ(4, sequence.poll(0, out, 4));
+  CHECK_EQ(3, out[3].index);
+  CHECK(sequence.running());
+  CHECK_EQ(2, sequence.poll(0, out, 4));
+  CHECK_EQ(4, out[0].index);
+  CHECK_EQ(5, out[1].index);
+  CHECK(!sequence.running());
+  CHECK_EQ(0, sequence.poll(0, out, 0));
+}
+
+TEST(back_returns_to_previous_go_point) {
+  CueSequence sequence;
+  sequence.load(kSteps, kStepCount);
+  CHECK(sequence.jump(4));
+  CHECK(sequence.back());
+  CHECK_EQ(3, sequence.playhead());
+  CHECK(sequence.back());
+  CHECK_EQ(0, sequence.playhead());  // Les pas enchaînés 1 et 2 ne sont pas des points de GO.
+  CHECK(!sequence.back());
+}
+
+TEST(back_and_jump_cancel_running_chain) {
+  CueSequence sequence;
+  sequence.load(kSteps, kStepCount);
+  DueCueStep out[8];
+
+  sequence.go(0);
+  CHECK(sequence.back());
+  CHECK(!sequence.running());
+  CHECK_EQ(0, sequence.poll(UINT64_MAX, out, 8));
+
+  sequence.go(0);
+  CHECK(sequence.jump(4));
+  CHECK(!sequence.running());
+  CHECK_EQ(4, sequence.playhead());
+  CHECK(!sequence.jump(kStepCount));  // Hors liste : curseur inchangé.
+  CHECK_EQ(4, sequence.playhead());
+
+  sequence.go(0);
+  CHECK_EQ(5, sequence.playhead());
+  CHECK_EQ(0, sequence.poll(199999, out, 8));
+  CHECK_EQ(1, sequence.poll(200000, out, 8));
+  CHECK_EQ(4, out[0].index);
+
+  sequence.go(0);  // Fin de liste : sans effet.
+  CHECK(!sequence.running());
+}
+
+TEST(go_replaces_running_chain) {
+  CueSequence sequence;
+  sequence.load(kSteps, kStepCount);
+  DueCueStep out[8];
+  sequence.go(0);
+  CHECK_EQ(1, sequence.poll(0, out, 8));
+  sequence.go(10);  // Le pas 3 remplace la fin de l'enchaînement (pas 1 et 2 abandonnés).
+  CHECK_EQ(1, sequence.poll(100000000, out, 8));
+  CHECK_EQ(3, out[0].index);
+  CHECK_EQ(10, out[0].dueUs);
+}
+
+TEST(stop_and_reload) {
+  CueSequence sequence;
+  sequence.load(kSteps, kStepCount);
+  DueCueStep out[8];
+  sequence.go(0);
+  sequence.stop();
+  CHECK(!sequence.running());
+  CHECK_EQ(3, sequence.playhead());  // Le curseur reste en place.
+  CHECK_EQ(0, sequence.poll(UINT64_MAX, out, 8));
+
+  sequence.load(nullptr, 5);
+  CHECK_EQ(0, sequence.size());
+  CHECK_EQ(0, sequence.playhead());
+  sequence.go(0);
+  CHECK(!sequence.running());
+}
@@ -0,0 +1,98 @@
+#include <string>
+
+#include "cue_store.h"
+#include "test_support.h"
+
+namespace {
+
+std::string str(CueTextView view) {
+  return std::string(view.data, view.length);
+}
+
+void selectOnly(bool *selected, size_t index) {
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    selected[i] = i == index;
+  }
+}
+
+}  // namespace
+
+TEST(trim_removes_surrounding_blanks) {
+  const char text[] = " \t Entrée jardin \r\n";
+  CHECK(str(trimCueText(text, sizeof(text) - 1, MAX_CUE_TEXT_LENGTH)) == "Entrée jardin");
+  CHECK(str(trimCueText("   ", 3, MAX_CUE_TEXT_LENGTH)).empty());
+  CHECK(str(trimCueText(nullptr, 12, MAX_CUE_TEXT_LENGTH)).empty());
+  // La vue pointe dans le texte d'origine : aucune copie.
+  CHECK(trimCueText(text, sizeof(text) - 1, MAX_CUE_TEXT_LENGTH).data == text + 3);
+}
+
+TEST(trim_truncates_on_character_boundary) {
+  // "é" occupe deux octets (0xC3 0xA9) : une coupe au milieu recule avant le caractère.
+  const char text[] = "abcé";
+  CHECK(str(trimCueText(text, 5, 5)) == "abcé");
+  CHECK(str(trimCueText(text, 5, 4)) == "abc");
+  CHECK(str(trimCueText(text, 5, 3)) == "abc");
+  const char euro[] = "a€";  // Trois octets.
+  CHECK(str(trimCueText(euro, 4, 3)) == "a");
+  CHECK(str(trimCueText(euro, 4, 2)) == "a");
+  // Blancs retirés avant la troncature.
+  CHECK(str(trimCueText("  abcdef", 8, 3)) == "abc");
+}
+
+TEST(new_store_is_empty) {
+  const CueStore store;
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    CueTextCopy copy;
+    copy.length = 99;
+    store.copyText(i, copy);
+    CHECK_EQ(0, copy.length);
+    CHECK_EQ('\0', copy.text[0]);
+  }
+}
+
+TEST(assign_reports_changes_only) {
+  CueStore store;
+  CHECK(store.assignText(0, "Noir salle", 10));
+  CHECK(!store.assignText(0, "Noir salle", 10));
+  CHECK(store.assignText(0, "Noir salla", 10));  // Même longueur, octets différents.
+  CHECK(store.assignText(0, "Noir", 4));         // Préfixe : longueur différente.
+  CHECK(store.assignText(0, "", 0));
+  CHECK(!store.assignText(0, "", 0));
+
+  CueTextCopy copy;
+  store.assignText(1, "Rideau", 6);
+  store.copyText(1, copy);
+  CHECK(str(copy.view()) == "Rideau");
+  CHECK_EQ('\0', copy.text[copy.length]);
+  store.copyText(0, copy);
+  CHECK_EQ(0, copy.length);
+}
+
+TEST(assign_caps_length) {
+  CueStore store;
+  char longText[MAX_CUE_TEXT_LENGTH + 10];
+  memset(longText, 'x', sizeof(longText));
+  CHECK(store.assignText(0, longText, sizeof(longText)));
+  CHECK(!store.assignText(0, longText, MAX_CUE_TEXT_LENGTH));  // Identique après coupe.
+  CueTextCopy copy;
+  store.copyText(0, copy);
+  CHECK_EQ(MAX_CUE_TEXT_LENGTH, copy.length);
+  CHECK_EQ('\0', copy.text[MAX_CUE_TEXT_LENGTH]);
+}
+
+TEST(copy_texts_fills_selected_only) {
+  CueStore store;
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    const std::string text = "Cue " + std::to_string(i + 1);
+    store.assignText(i, text.data(), text.size());
+  }
+
+  bool selected[CUE_COUNT];
+  selectOnly(selected, CUE_COUNT - 1);
+  CueTextCopy copies[CUE_COUNT];
+  store.copyTexts(selected, copies);
+  CHECK(str(copies[CUE_COUNT - 1].view()) == "Cue " + std::to_string(CUE_COUNT));
+  for (size_t i = 0; i + 1 < CUE_COUNT; ++i) {
+    CHECK_EQ(0, copies[i].length);  // Non sélectionné : laissé intact.
+  }
+}
@@ -0,0 +1,164 @@
+#include <esp_timer.h>
+
+#include <functional>
+#include <vector>
+
+#include "config.h"
+#include "cue_timers.h"
+#include "test_support.h"
+
+namespace {
+
+struct Output {
+  size_t index;
+  bool active;
+};
+
+std::vector<Output> outputs;
+size_t outputsInCriticalSection = 0;
+// Exécuté au début d'une sortie, comme une autre tâche qui passerait entre le déverrouillage et
+// l'écriture de la sortie.
+std::function<void()> beforeOutput;
+
+void recordOutput(size_t index, bool active) {
+  if (criticalSectionDepth > 0) {
+    ++outputsInCriticalSection;
+  }
+  if (beforeOutput) {
+    std::function<void()> interleaved = std::move(beforeOutput);
+    beforeOutput = nullptr;
+    interleaved();
+  }
+  outputs.push_back({index, active});
+}
+
+// Dernier niveau écrit pour un cue ; -1 s'il n'a jamais été écrit.
+int lastOutput(size_t index) {
+  for (auto it = outputs.rbegin(); it != outputs.rend(); ++it) {
+    if (it->index == index) {
+      return it->active ? 1 : 0;
+    }
+  }
+  return -1;
+}
+
+std::vector<size_t> expiredCues;
+std::vector<uint64_t> startTargets;
+
+void dispatchEvents() {
+  dispatchCueTimerEvents([](size_t, uint64_t targetUs, uint64_t) { startTargets.push_back(targetUs); },
+                         [](size_t index) { expiredCues.push_back(index); });
+}
+
+uint64_t now() {
+  return cueClockUs();
+}
+
+int64_t armedInUs() {
+  return espTimerShim.timer.armed ? espTimerShim.timer.deadlineUs - espTimerShim.nowUs : -1;
+}
+
+// Module à état global : initialisé une fois, chaque test laisse tous les cues éteints.
+struct Setup {
+  Setup() { initCueTimers(recordOutput); }
+} setup;
+
+void reset() {
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    stopCueTimer(i);
+  }
+  dispatchEvents();
+  outputs.clear();
+  expiredCues.clear();
+  startTargets.clear();
+}
+
+}  // namespace
+
+TEST(expiry_turns_output_off_outside_lock) {
+  reset();
+  startCueTimer(0, 100, now());
+  CHECK_EQ(1, lastOutput(0));
+  CHECK_EQ(100000, armedInUs());
+  CHECK(isCueTimerRunning(0));
+
+  advanceEspTimer(99999);
+  CHECK_EQ(1, lastOutput(0));
+  advanceEspTimer(1);
+  CHECK_EQ(0, lastOutput(0));
+  CHECK(!isCueTimerRunning(0));
+  CHECK_EQ(-1, armedInUs());
+
+  dispatchEvents();
+  CHECK_EQ(1, expiredCues.size());
+  CHECK_EQ(0, outputsInCriticalSection);
+  CHECK_EQ(0, espTimerShim.callsInCriticalSection);
+}
+
+TEST(scheduled_start_then_expiry_from_target) {
+  reset();
+  const uint64_t target = now() + 50000;
+  scheduleCueStart(1, target, 200);
+  CHECK_EQ(-1, lastOutput(1));
+  CHECK_EQ(50000, armedInUs());
+
+  advanceEspTimer(50000 + 300);  // Rappel en retard : l'extinction reste calée sur la cible.
+  CHECK_EQ(1, lastOutput(1));
+  CHECK_EQ(200000 - 300, armedInUs());
+  dispatchEvents();
+  CHECK_EQ(1, startTargets.size());
+  if (!startTargets.empty()) {
+    CHECK_EQ(target, startTargets[0]);
+  }
+
+  advanceEspTimer(200000 - 300);
+  CHECK_EQ(0, lastOutput(1));
+  CHECK_EQ(0, outputsInCriticalSection);
+  CHECK_EQ(0, espTimerShim.callsInCriticalSection);
+}
+
+TEST(batch_start_arms_earliest_deadline) {
+  reset();
+  bool selected[CUE_COUNT] = {false};
+  uint32_t durations[CUE_COUNT] = {0};
+  selected[0] = selected[CUE_COUNT - 1] = true;
+  durations[0] = 300;
+  durations[CUE_COUNT - 1] = 100;
+  startCueTimers(selected, durations, now());
+  CHECK_EQ(1, lastOutput(0));
+  CHECK_EQ(1, lastOutput(CUE_COUNT - 1));
+  CHECK_EQ(100000, armedInUs());
+
+  stopCueTimer(CUE_COUNT - 1);
+  CHECK_EQ(0, lastOutput(CUE_COUNT - 1));
+  CHECK_EQ(300000, armedInUs());
+  CHECK_EQ(0, outputsInCriticalSection);
+  CHECK_EQ(0, espTimerShim.callsInCriticalSection);
+}
+
+TEST(stale_output_is_rewritten_after_concurrent_stop) {
+  reset();
+  // Entre le déverrouillage de startCueTimer() et l'allumage, une autre tâche arrête le cue :
+  // l'allumage tardif ne doit pas rester la dernière écriture.
+  beforeOutput = [] { stopCueTimer(0); };
+  startCueTimer(0, 1000, now());
+  CHECK(!isCueTimerRunning(0));
+  CHECK_EQ(0, lastOutput(0));
+  CHECK_EQ(-1, armedInUs());
+}
+
+TEST(stale_rearm_is_redone_after_concurrent_schedule) {
+  reset();
+  // Pendant l'application d'un départ à 1 s, une autre tâche programme une échéance à 10 ms :
+  // le timer doit finir armé sur la plus proche.
+  beforeOutput = [] { startCueTimer(1, 10, now()); };
+  startCueTimer(0, 1000, now());
+  CHECK_EQ(10000, armedInUs());
+  CHECK_EQ(1, lastOutput(0));
+  CHECK_EQ(1, lastOutput(1));
+
+  advanceEspTimer(10000);
+  CHECK_EQ(0, lastOutput(1));
+  CHECK_EQ(1, lastOutput(0));
+  CHECK_EQ(990000, armedInUs());
+}
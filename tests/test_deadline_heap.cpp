@@ -0,0 +1,137 @@
+#include <stdlib.h>
+
+#include "deadline_heap.h"
+#include "test_support.h"
+
+namespace {
+
+// Vide le tas à `now` et vérifie que les identifiants sortent par échéance croissante.
+template <size_t Capacity>
+size_t drainInOrder(DeadlineHeap<Capacity> &heap, uint64_t now, const uint64_t *deadlines) {
+  size_t popped = 0;
+  uint64_t previous = 0;
+  size_t id = 0;
+  while (heap.popDue(now, id)) {
+    CHECK(deadlines[id] >= previous);
+    previous = deadlines[id];
+    ++popped;
+  }
+  return popped;
+}
+
+}  // namespace
+
+TEST(pops_in_deadline_order) {
+  DeadlineHeap<8> heap;
+  const uint64_t deadlines[8] = {500, 100, 700, 300, 300, 900, 0, 200};
+  for (size_t id = 0; id < 8; ++id) {
+    heap.schedule(id, deadlines[id]);
+  }
+  CHECK_EQ(0, heap.nextDeadline());
+  CHECK_EQ(8, drainInOrder(heap, UINT64_MAX, deadlines));
+  CHECK(heap.empty());
+}
+
+TEST(pops_only_due_deadlines) {
+  DeadlineHeap<4> heap;
+  heap.schedule(0, 100);
+  heap.schedule(1, 200);
+  size_t id = 99;
+  CHECK(!heap.popDue(99, id));
+  CHECK_EQ(99, id);
+  CHECK(heap.popDue(100, id));
+  CHECK_EQ(0, id);
+  CHECK(!heap.popDue(150, id));
+  CHECK_EQ(200, heap.nextDeadline());
+}
+
+TEST(rearm_moves_existing_entry) {
+  DeadlineHeap<4> heap;
+  heap.schedule(0, 100);
+  heap.schedule(1, 200);
+  heap.schedule(2, 300);
+
+  // Reprogrammé plus tard puis plus tôt : une seule entrée, à sa dernière échéance.
+  heap.schedule(0, 400);
+  CHECK_EQ(200, heap.nextDeadline());
+  heap.schedule(2, 50);
+  CHECK_EQ(50, heap.nextDeadline());
+
+  size_t order[3] = {};
+  size_t popped = 0;
+  size_t id = 0;
+  while (heap.popDue(UINT64_MAX, id)) {
+    if (popped < 3) {
+      order[popped] = id;
+    }
+    ++popped;
+  }
+  CHECK_EQ(3, popped);
+  CHECK_EQ(2, order[0]);
+  CHECK_EQ(1, order[1]);
+  CHECK_EQ(0, order[2]);
+}
+
+TEST(cancel_removes_entry) {
+  DeadlineHeap<4> heap;
+  heap.schedule(0, 100);
+  heap.schedule(1, 200);
+  heap.schedule(2, 300);
+
+  heap.cancel(0);
+  CHECK(!heap.contains(0));
+  CHECK_EQ(200, heap.nextDeadline());
+  heap.cancel(2);  // Dernière position du tas.
+  heap.cancel(2);  // Déjà annulé : sans effet.
+  heap.cancel(7);  // Hors capacité : ignoré.
+  CHECK(heap.contains(1));
+
+  size_t id = 0;
+  CHECK(heap.popDue(UINT64_MAX, id));
+  CHECK_EQ(1, id);
+  CHECK(heap.empty());
+
+  // Un identifiant annulé se reprogramme normalement.
+  heap.schedule(0, 10);
+  CHECK(heap.contains(0));
+  CHECK_EQ(10, heap.nextDeadline());
+}
+
+TEST(random_operations_match_reference) {
+  constexpr size_t kCapacity = 64;
+  DeadlineHeap<kCapacity> heap;
+  uint64_t reference[kCapacity] = {};
+  bool present[kCapacity] = {};
+  srand(1);
+
+  for (int step = 0; step < 20000; ++step) {
+    const size_t id = static_cast<size_t>(rand()) % kCapacity;
+    if (rand() % 3 == 0) {
+      heap.cancel(id);
+      present[id] = false;
+    } else {
+      reference[id] = static_cast<uint64_t>(rand() % 1000);
+      heap.schedule(id, reference[id]);
+      present[id] = true;
+    }
+
+    uint64_t earliest = UINT64_MAX;
+    for (size_t i = 0; i < kCapacity; ++i) {
+      CHECK(heap.contains(i) == present[i]);
+      if (present[i] && reference[i] < earliest) {
+        earliest = reference[i];
+      }
+    }
+    if (earliest == UINT64_MAX) {
+      CHECK(heap.empty());
+    } else {
+      CHECK_EQ(earliest, heap.nextDeadline());
+    }
+  }
+
+  size_t remaining = 0;
+  for (bool entry : present) {
+    remaining += entry;
+  }
+  CHECK_EQ(remaining, drainInOrder(heap, UINT64_MAX, reference));
+}
@@ -0,0 +1,171 @@
+// Boîte aux lettres de la tâche d'affichage (ESP_PLATFORM), avec la tâche FreeRTOS simulée par
+// un std::thread : une case par écran, la dernière demande remplace celle en attente.
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "display_manager.h"
+#include "latency_metrics.h"
+#include "ssd1306_log.h"
+#include "test_support.h"
+
+#include <freertos/task.h>
+
+void markTriggerStage(size_t, LatencyStage) {}
+
+namespace {
+
+// Bus I2C bloqué à la demande : la tâche d'affichage s'arrête au milieu d'un rendu.
+std::mutex gateMutex;
+std::condition_variable gateChanged;
+bool gateClosed = false;
+bool gateReached = false;
+
+void closeGate() {
+  std::lock_guard<std::mutex> guard(gateMutex);
+  gateClosed = true;
+  gateReached = false;
+}
+
+void waitGateReached() {
+  std::unique_lock<std::mutex> lock(gateMutex);
+  gateChanged.wait(lock, []() { return gateReached; });
+}
+
+void openGate() {
+  std::lock_guard<std::mutex> guard(gateMutex);
+  gateClosed = false;
+  gateChanged.notify_all();
+}
+
+void busGate() {
+  std::unique_lock<std::mutex> lock(gateMutex);
+  if (gateClosed) {
+    gateReached = true;
+    gateChanged.notify_all();
+    gateChanged.wait(lock, []() { return !gateClosed; });
+  }
+}
+
+void setUp() {
+  static bool initialized = false;
+  if (!initialized) {
+    initDisplay();  // Démarre la tâche d'affichage.
+    Wire.beforeEnd = busGate;
+    initialized = true;
+  }
+  waitForHostTasksIdle();
+  Wire.log.clear();
+}
+
+void post(size_t index, const std::string &text) {
+  updateDisplay(index, text.data(), text.size());
+}
+
+std::vector<PageSpan> spansTo(size_t index) {
+  std::vector<PageSpan> spans;
+  CHECK(decodePageSpans(Wire.log, spans));
+  std::vector<PageSpan> selected;
+  for (const PageSpan &span : spans) {
+    if (sentTo(span, displayLocations[index])) {
+      selected.push_back(span);
+    }
+  }
+  return selected;
+}
+
+// Un rendu d'une seule ligne modifiée envoie exactement une plage (page 0).
+size_t rendersTo(size_t index) {
+  return spansTo(index).size();
+}
+
+// Octets de la dernière plage envoyée à l'écran `index` comparés au rendu attendu de `text`.
+bool lastSpanShows(size_t index, const std::string &text) {
+  const std::vector<PageSpan> spans = spansTo(index);
+  if (spans.empty() || spans.back().page != 0) {
+    return false;
+  }
+  TwoWire scratch;
+  Adafruit_SSD1306 expected(SCREEN_WIDTH, SCREEN_HEIGHT, &scratch, -1);
+  expected.clearDisplay();
+  expected.setCursor(0, 0);
+  expected.write(reinterpret_cast<const uint8_t *>(text.data()), text.size());
+  const PageSpan &span = spans.back();
+  return memcmp(span.data.data(), expected.getBuffer() + span.firstColumn, span.data.size()) == 0;
+}
+
+}  // namespace
+
+TEST(renders_posted_text_on_display_task) {
+  setUp();
+  post(0, "Bonjour");
+  waitForHostTasksIdle();
+  CHECK_EQ(1, rendersTo(0));
+  CHECK(lastSpanShows(0, "Bonjour"));
+}
+
+TEST(latest_post_replaces_pending_one) {
+  setUp();
+  closeGate();
+  post(0, "T0");
+  waitGateReached();  // Tâche d'affichage bloquée sur le bus pendant le rendu de T0.
+
+  // Le producteur ne bloque jamais sur le bus : 50 demandes pendant que la tâche est arrêtée.
+  const auto started = std::chrono::steady_clock::now();
+  for (int i = 1; i <= 50; ++i) {
+    post(0, "T" + std::to_string(i));
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - started;
+  CHECK(elapsed < std::chrono::milliseconds(100));
+
+  openGate();
+  waitForHostTasksIdle();
+  // T0 puis T50 seulement : les demandes intermédiaires ont été remplacées dans la case.
+  CHECK_EQ(2, rendersTo(0));
+  CHECK(lastSpanShows(0, "T50"));
+}
+
+TEST(each_screen_keeps_its_own_slot) {
+  setUp();
+  closeGate();
+  post(0, "A0");
+  waitGateReached();
+  for (int i = 1; i <= 10; ++i) {
+    for (size_t screen = 0; screen < CUE_COUNT; ++screen) {
+      post(screen, std::string(1, static_cast<char>('A' + screen)) + std::to_string(i));
+    }
+  }
+  openGate();
+  waitForHostTasksIdle();
+
+  // Écran 0 : A0 puis A10 ; les autres : leur seule dernière demande.
+  CHECK_EQ(2, rendersTo(0));
+  CHECK(lastSpanShows(0, "A10"));
+  for (size_t screen = 1; screen < CUE_COUNT; ++screen) {
+    CHECK_EQ(1, rendersTo(screen));
+    CHECK(lastSpanShows(screen, std::string(1, static_cast<char>('A' + screen)) + "10"));
+  }
+}
+
+TEST(concurrent_producers_end_on_a_posted_text) {
+  setUp();
+  // Plusieurs tâches (AsyncTCP, loop(), AsyncUDP) postent sur le même écran en même temps.
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < 4; ++producer) {
+    producers.emplace_back([producer]() {
+      for (int i = 0; i < 200; ++i) {
+        post(1, "P" + std::to_string(producer) + "-" + std::to_string(i));
+      }
+    });
+  }
+  for (auto &thread : producers) {
+    thread.join();
+  }
+  post(1, "Fin");
+  waitForHostTasksIdle();
+  CHECK(lastSpanShows(1, "Fin"));
+}
@@ -0,0 +1,111 @@
+#include <string>
+#include <vector>
+
+#include "config.h"
+#include "display_manager.h"
+#include "latency_metrics.h"
+#include "ssd1306_log.h"
+#include "test_support.h"
+
+// Les métriques de latence ne sont pas liées à ce test.
+void markTriggerStage(size_t, LatencyStage) {}
+
+namespace {
+
+std::vector<PageSpan> render(size_t index, const std::string &text) {
+  Wire.log.clear();
+  updateDisplay(index, text.data(), text.size());
+  std::vector<PageSpan> spans;
+  CHECK(decodePageSpans(Wire.log, spans));
+  return spans;
+}
+
+void setUp() {
+  static bool initialized = false;
+  if (!initialized) {
+    initDisplay();
+    initialized = true;
+  }
+}
+
+}  // namespace
+
+TEST(initializes_every_display) {
+  setUp();
+  for (size_t i = 0; i < CUE_COUNT; ++i) {
+    CHECK(isDisplayReady(i));
+  }
+  CHECK(!isDisplayReady(CUE_COUNT));
+}
+
+TEST(first_text_sends_only_touched_page_and_columns) {
+  setUp();
+  const std::vector<PageSpan> spans = render(0, "A");
+  CHECK_EQ(1, spans.size());
+  if (spans.size() == 1) {
+    CHECK(sentTo(spans[0], displayLocations[0]));
+    CHECK_EQ(0, spans[0].page);
+    CHECK_EQ(0, spans[0].firstColumn);
+    CHECK_EQ(4, spans[0].lastColumn);  // Glyphe de 5 colonnes.
+  }
+}
+
+TEST(unchanged_text_sends_nothing) {
+  setUp();
+  render(0, "Rideau");
+  CHECK(render(0, "Rideau").empty());
+  CHECK(render(0, "  Rideau \t").empty());  // Identique une fois nettoyé.
+}
+
+TEST(changed_character_sends_its_columns) {
+  setUp();
+  render(1, "AB");
+  const std::vector<PageSpan> spans = render(1, "AC");
+  CHECK_EQ(1, spans.size());
+  if (spans.size() == 1) {
+    CHECK(sentTo(spans[0], displayLocations[1]));
+    CHECK_EQ(0, spans[0].page);
+    CHECK_EQ(6, spans[0].firstColumn);  // Second caractère : colonnes 6 à 10.
+    CHECK_EQ(10, spans[0].lastColumn);
+  }
+}
+
+TEST(wrapped_text_sends_each_page_in_chunks) {
+  setUp();
+  render(2, "x");
+  // 21 caractères par ligne : la seconde ligne occupe la page 1.
+  const std::vector<PageSpan> spans = render(2, "Entree cour et jardin noir salle");
+  CHECK_EQ(2, spans.size());
+  if (spans.size() == 2) {
+    CHECK_EQ(0, spans[0].page);
+    CHECK_EQ(1, spans[1].page);
+    CHECK(spans[0].data.size() > 31);  // Au-delà d'un paquet I2C...
+    CHECK_EQ(31, spans[0].largestChunk);  // ... découpé à la taille du tampon Wire.
+  }
+
+  // Retour à une ligne : la page 1 est effacée sur toute sa plage précédente.
+  const std::vector<PageSpan> shorter = render(2, "Entree cour et jardin");
+  CHECK_EQ(1, shorter.size());
+  if (shorter.size() == 1) {
+    CHECK_EQ(1, shorter[0].page);
+  }
+}
+
+TEST(empty_text_shows_placeholder) {
+  setUp();
+  render(0, "(vide)");
+  CHECK(render(0, "   ").empty());  // Un texte vide affiche "(vide)" : déjà à l'écran.
+}
+
+TEST(partial_flush_stays_at_400_khz) {
+  setUp();
+  render(1, "x");
+  Wire.clockChanges.clear();
+  const std::vector<PageSpan> spans = render(1, "Entree cour et jardin noir salle");
+  CHECK(!spans.empty());
+  for (const PageSpan &span : spans) {
+    CHECK_EQ(400000, span.slowestClockHz);
+  }
+  // Une transaction pour la fenêtre, sans recadrer l'horloge du bus à chaque commande.
+  CHECK(Wire.clockChanges.empty());
+}
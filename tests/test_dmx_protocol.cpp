@@ -0,0 +1,237 @@
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "dmx_protocol.h"
+#include "test_support.h"
+
+namespace {
+
+constexpr uint8_t kHysteresis = 8;
+// Chemins relatifs à tests/ (make -C tests).
+constexpr char kReplayScript[] = "../tools/dmx_replay.py";
+constexpr char kReplayRecording[] = "data/dmx_hysteresis.txt";
+
+void putBigEndian16(std::vector<uint8_t> &out, uint16_t value) {
+  out.push_back(static_cast<uint8_t>(value >> 8));
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+void putBigEndian32(std::vector<uint8_t> &out, uint32_t value) {
+  putBigEndian16(out, static_cast<uint16_t>(value >> 16));
+  putBigEndian16(out, static_cast<uint16_t>(value));
+}
+
+// Trame sACN de données, même structure que tools/dmx_replay.py.
+std::vector<uint8_t> sacnPacket(uint8_t cidByte, uint8_t priority, uint8_t sequence, const std::vector<uint8_t> &levels,
+                                uint8_t options = 0) {
+  const uint16_t slots = static_cast<uint16_t>(levels.size() + 1);
+  std::vector<uint8_t> out;
+  putBigEndian16(out, 0x0010);
+  putBigEndian16(out, 0);
+  const char identifier[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+  out.insert(out.end(), identifier, identifier + 12);
+  putBigEndian16(out, static_cast<uint16_t>(0x7000 | (110 + slots)));
+  putBigEndian32(out, 0x00000004);
+  out.insert(out.end(), 16, cidByte);
+  putBigEndian16(out, static_cast<uint16_t>(0x7000 | (88 + slots)));
+  putBigEndian32(out, 0x00000002);
+  out.insert(out.end(), 64, 0);  // Nom de la source.
+  out.push_back(priority);
+  putBigEndian16(out, 0);
+  out.push_back(sequence);
+  out.push_back(options);
+  putBigEndian16(out, 1);  // Univers.
+  putBigEndian16(out, static_cast<uint16_t>(0x7000 | (10 + slots)));
+  out.push_back(0x02);
+  out.push_back(0xA1);
+  putBigEndian16(out, 0);
+  putBigEndian16(out, 1);
+  putBigEndian16(out, slots);
+  out.push_back(0);  // Code de départ nul.
+  out.insert(out.end(), levels.begin(), levels.end());
+  return out;
+}
+
+std::vector<uint8_t> artNetPacket(uint16_t universe, uint8_t sequence, const std::vector<uint8_t> &levels) {
+  std::vector<uint8_t> out = {'A', 'r', 't', '-', 'N', 'e', 't', 0, 0x00, 0x50};
+  putBigEndian16(out, 14);
+  out.push_back(sequence);
+  out.push_back(0);
+  out.push_back(static_cast<uint8_t>(universe));
+  out.push_back(static_cast<uint8_t>(universe >> 8));
+  putBigEndian16(out, static_cast<uint16_t>(levels.size()));
+  out.insert(out.end(), levels.begin(), levels.end());
+  return out;
+}
+
+// Suit un canal comme dmx_input.cpp : compte les franchissements du seuil (montées et descentes).
+struct ChannelWatch {
+  uint8_t threshold;
+  bool above = false;
+  int rises = 0;
+  int falls = 0;
+
+  void apply(uint8_t level) {
+    const bool next = dmxLevelAbove(above, level, threshold, kHysteresis);
+    rises += next && !above;
+    falls += !next && above;
+    above = next;
+  }
+};
+
+}  // namespace
+
+TEST(decodes_sacn_frame) {
+  const std::vector<uint8_t> levels = {10, 20, 30};
+  const std::vector<uint8_t> packet = sacnPacket(0xAB, 150, 7, levels);
+  DmxFrame frame;
+  CHECK(decodeSacnFrame(packet.data(), packet.size(), frame));
+  CHECK_EQ(1, frame.universe);
+  CHECK_EQ(7, frame.sequence);
+  CHECK_EQ(150, frame.priority);
+  CHECK(!frame.streamTerminated);
+  CHECK_EQ(0xAB, frame.source[15]);
+  CHECK_EQ(3, frame.slotCount);
+  CHECK_EQ(30, frame.slots[2]);
+
+  std::vector<uint8_t> preview = sacnPacket(0xAB, 100, 1, levels, 0x80);
+  CHECK(!decodeSacnFrame(preview.data(), preview.size(), frame));
+  std::vector<uint8_t> truncated = packet;
+  truncated.pop_back();
+  CHECK(!decodeSacnFrame(truncated.data(), truncated.size(), frame));
+  std::vector<uint8_t> startCode = packet;
+  startCode[125] = 0xDD;  // Priorité par canal : ignorée.
+  CHECK(!decodeSacnFrame(startCode.data(), startCode.size(), frame));
+}
+
+TEST(decodes_artnet_frame) {
+  const std::vector<uint8_t> packet = artNetPacket(0x0102, 9, {1, 2, 3, 4});
+  DmxFrame frame;
+  CHECK(decodeArtNetFrame(packet.data(), packet.size(), frame));
+  CHECK_EQ(0x0102, frame.universe);
+  CHECK_EQ(9, frame.sequence);
+  CHECK_EQ(4, frame.slotCount);
+  CHECK_EQ(4, frame.slots[3]);
+
+  const std::vector<uint8_t> single = artNetPacket(1, 1, {1});  // Moins de 2 canaux.
+  CHECK(!decodeArtNetFrame(single.data(), single.size(), frame));
+  std::vector<uint8_t> poll = packet;
+  poll[9] = 0x20;  // OpPoll.
+  CHECK(!decodeArtNetFrame(poll.data(), poll.size(), frame));
+}
+
+TEST(hysteresis_ignores_oscillation_around_threshold) {
+  ChannelWatch channel{128};
+  for (uint8_t level : {0, 128, 125, 129, 121, 130, 0}) {
+    channel.apply(level);
+  }
+  CHECK_EQ(1, channel.rises);
+  CHECK_EQ(1, channel.falls);
+
+  channel.apply(120);  // Sous le seuil : pas de montée.
+  channel.apply(200);
+  channel.apply(120);  // Exactement seuil - hystérésis : redescend.
+  CHECK_EQ(2, channel.rises);
+  CHECK_EQ(2, channel.falls);
+}
+
+TEST(hysteresis_releases_threshold_below_hysteresis) {
+  // Seuil 4 < hystérésis 8 : le canal doit redescendre à 0, puis pouvoir redéclencher.
+  ChannelWatch channel{4};
+  for (uint8_t level : {0, 10, 0, 6, 3, 0, 4}) {
+    channel.apply(level);
+  }
+  CHECK_EQ(3, channel.rises);
+  CHECK_EQ(2, channel.falls);
+  CHECK(dmxLevelAbove(true, 1, 4, kHysteresis));
+  CHECK(!dmxLevelAbove(true, 0, 8, kHysteresis));
+}
+
+TEST(arbiter_drops_out_of_sequence_and_lower_priority) {
+  DmxSourceArbiter<2> arbiter;
+  const std::vector<uint8_t> levels = {0, 0};
+  DmxFrame frame;
+
+  std::vector<uint8_t> packet = sacnPacket(1, 100, 10, levels);
+  CHECK(decodeSacnFrame(packet.data(), packet.size(), frame));
+  CHECK(arbiter.accept(frame, 0));
+  packet = sacnPacket(1, 100, 9, levels);  // En retard d'une trame.
+  CHECK(decodeSacnFrame(packet.data(), packet.size(), frame));
+  CHECK(!arbiter.accept(frame, 10));
+  packet = sacnPacket(1, 100, 11, levels);
+  CHECK(decodeSacnFrame(packet.data(), packet.size(), frame));
+  CHECK(arbiter.accept(frame, 20));
+
+  packet = sacnPacket(2, 50, 1, levels);  // Autre source, priorité plus basse.
+  CHECK(decodeSacnFrame(packet.data(), packet.size(), frame));
+  CHECK(!arbiter.accept(frame, 30));
+  packet = sacnPacket(2, 50, 2, levels);  // Source prioritaire perdue : la seconde prend la main.
+  CHECK(decodeSacnFrame(packet.data(), packet.size(), frame));
+  CHECK(arbiter.accept(frame, 30 + DMX_SOURCE_TIMEOUT_MS));
+}
+
+// Rejoue data/dmx_hysteresis.txt avec tools/dmx_replay.py vers un port UDP local et applique les
+// trames reçues comme dmx_input.cpp (décodage, arbitrage, seuil avec hystérésis).
+TEST(loopback_replay_crosses_thresholds) {
+  const int sock = socket(AF_INET, SOCK_DGRAM, 0);
+  CHECK(sock >= 0);
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;  // Port éphémère.
+  socklen_t addressLength = sizeof(address);
+  CHECK(bind(sock, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0);
+  CHECK(getsockname(sock, reinterpret_cast<sockaddr *>(&address), &addressLength) == 0);
+  const timeval timeout = {2, 0};
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  const std::string command = std::string("python3 ") + kReplayScript + " " + kReplayRecording +
+                              " --protocol sacn --target 127.0.0.1 --port " +
+                              std::to_string(ntohs(address.sin_port)) + " --rate 200 --hold 0.1 > /dev/null";
+  FILE *replay = popen(command.c_str(), "r");
+  CHECK(replay != nullptr);
+  if (replay == nullptr) {
+    close(sock);
+    return;
+  }
+
+  DmxSourceArbiter<4> arbiter;
+  ChannelWatch channels[2] = {{128}, {4}};
+  int frames = 0;
+  bool terminated = false;
+  uint8_t buffer[700];
+  while (!terminated) {
+    const ssize_t received = recv(sock, buffer, sizeof(buffer), 0);
+    if (received <= 0) {
+      break;  // Délai dépassé : le script n'a pas pu s'exécuter.
+    }
+    DmxFrame frame;
+    if (!decodeSacnFrame(buffer, static_cast<size_t>(received), frame)) {
+      continue;
+    }
+    terminated = frame.streamTerminated;
+    // Horloge de l'arbitre : une milliseconde par trame, loin du délai de perte de la source.
+    if (!arbiter.accept(frame, static_cast<uint32_t>(frames)) || frame.slotCount < 2) {
+      continue;
+    }
+    ++frames;
+    channels[0].apply(frame.slots[0]);
+    channels[1].apply(frame.slots[1]);
+  }
+  CHECK(pclose(replay) == 0);
+  close(sock);
+
+  CHECK(terminated);
+  CHECK(frames > 50);
+  CHECK_EQ(2, channels[0].rises);  // 130, puis 128 après être passé à 100 (124 ne relâche pas).
+  CHECK_EQ(1, channels[0].falls);
+  CHECK_EQ(2, channels[1].rises);  // Seuil 4 : relâché à 0, redéclenché à 6.
+  CHECK_EQ(1, channels[1].falls);
+}
@@ -0,0 +1,189 @@
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "multicast_protocol.h"
+#include "test_support.h"
+
+namespace {
+
+// Construit un datagramme multicast (little-endian, voir multicast_protocol.h).
+struct Datagram {
+  std::vector<uint8_t> bytes;
+
+  explicit Datagram(uint8_t entryCount, uint16_t group = 7, uint32_t sender = 0xA1B2C3D4, uint32_t sequence = 42) {
+    bytes = {'S', 'C', 'M', MULTICAST_VERSION};
+    u16(group);
+    bytes.push_back(0);
+    bytes.push_back(entryCount);
+    u32(sender);
+    u32(sequence);
+  }
+
+  Datagram &u16(uint16_t value) {
+    bytes.push_back(static_cast<uint8_t>(value));
+    bytes.push_back(static_cast<uint8_t>(value >> 8));
+    return *this;
+  }
+  Datagram &u32(uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+      bytes.push_back(static_cast<uint8_t>(value >> shift));
+    }
+    return *this;
+  }
+  Datagram &entry(uint16_t position, uint8_t actions, uint32_t durationMs, const char *text = "") {
+    const size_t length = strlen(text);
+    u16(position);
+    bytes.push_back(actions);
+    u32(durationMs);
+    bytes.push_back(static_cast<uint8_t>(length));
+    bytes.insert(bytes.end(), text, text + length);
+    return *this;
+  }
+
+  bool decode(MulticastPacket &packet) const { return decodeMulticastPacket(bytes.data(), bytes.size(), packet); }
+};
+
+}  // namespace
+
+TEST(decodes_header_and_entries) {
+  Datagram datagram(3, 0x0102, 0xA1B2C3D4, 0xFFFFFFF0);
+  datagram.entry(5, MULTICAST_ACTION_TRIGGER, 1500)
+      .entry(9, MULTICAST_ACTION_SET_TEXT | MULTICAST_ACTION_PERSIST, 0, "Rideau")
+      .entry(MULTICAST_NO_POSITION, MULTICAST_ACTION_TRIGGER | MULTICAST_ACTION_SET_TEXT, 0x01020304, "");
+
+  MulticastPacket packet;
+  CHECK(datagram.decode(packet));
+  CHECK_EQ(0x0102, packet.group);
+  CHECK_EQ(3, packet.entryCount);
+  CHECK_EQ(0xA1B2C3D4, packet.sender);
+  CHECK_EQ(0xFFFFFFF0, packet.sequence);
+  CHECK(packet.entries == datagram.bytes.data() + MULTICAST_HEADER_SIZE);
+
+  size_t offset = 0;
+  MulticastEntry entry;
+  readMulticastEntry(packet, offset, entry);
+  CHECK_EQ(5, entry.position);
+  CHECK(entry.trigger() && !entry.hasText() && !entry.persist());
+  CHECK_EQ(1500, entry.durationMs);
+  CHECK_EQ(0, entry.textLength);
+
+  readMulticastEntry(packet, offset, entry);
+  CHECK_EQ(9, entry.position);
+  CHECK(!entry.trigger() && entry.hasText() && entry.persist());
+  CHECK(std::string(entry.text, entry.textLength) == "Rideau");
+
+  readMulticastEntry(packet, offset, entry);
+  CHECK_EQ(MULTICAST_NO_POSITION, entry.position);
+  CHECK(entry.trigger() && entry.hasText());
+  CHECK_EQ(0x01020304, entry.durationMs);
+  CHECK_EQ(datagram.bytes.size() - MULTICAST_HEADER_SIZE, offset);
+}
+
+TEST(empty_datagram_is_valid) {
+  MulticastPacket packet;
+  CHECK(Datagram(0).decode(packet));
+  CHECK_EQ(0, packet.entryCount);
+}
+
+TEST(rejects_bad_header_and_version) {
+  MulticastPacket packet;
+  CHECK(!decodeMulticastPacket(nullptr, 0, packet));
+
+  Datagram valid(1);
+  valid.entry(1, MULTICAST_ACTION_TRIGGER, 0);
+  CHECK(valid.decode(packet));
+  for (size_t byte = 0; byte < 4; ++byte) {
+    Datagram corrupted = valid;
+    corrupted.bytes[byte] ^= 0x20;  // 'S' -> 's', version 1 -> 33...
+    CHECK(!corrupted.decode(packet));
+  }
+  Datagram nextVersion = valid;
+  nextVersion.bytes[3] = MULTICAST_VERSION + 1;
+  CHECK(!nextVersion.decode(packet));
+
+  // En-tête incomplet, jusqu'à un octet près.
+  for (size_t length = 0; length < MULTICAST_HEADER_SIZE; ++length) {
+    CHECK(!decodeMulticastPacket(Datagram(0).bytes.data(), length, packet));
+  }
+}
+
+TEST(rejects_length_mismatch) {
+  MulticastPacket packet;
+  Datagram trailing(1);
+  trailing.entry(1, MULTICAST_ACTION_TRIGGER, 0);
+  trailing.bytes.push_back(0);  // Octet en trop après la dernière entrée.
+  CHECK(!trailing.decode(packet));
+
+  Datagram tooManyEntries(2);  // Annonce deux entrées, n'en contient qu'une.
+  tooManyEntries.entry(1, MULTICAST_ACTION_TRIGGER, 0, "Top");
+  CHECK(!tooManyEntries.decode(packet));
+
+  Datagram tooFewEntries(1);
+  tooFewEntries.entry(1, MULTICAST_ACTION_TRIGGER, 0).entry(2, MULTICAST_ACTION_TRIGGER, 0);
+  CHECK(!tooFewEntries.decode(packet));
+}
+
+TEST(rejects_every_truncation) {
+  Datagram datagram(2);
+  datagram.entry(3, MULTICAST_ACTION_SET_TEXT, 0, "Noir salle").entry(4, MULTICAST_ACTION_TRIGGER, 250, "Go");
+  MulticastPacket packet;
+  CHECK(datagram.decode(packet));
+  // Coupé dans un en-tête d'entrée ou dans un texte : jamais de lecture au-delà du datagramme.
+  for (size_t length = MULTICAST_HEADER_SIZE; length < datagram.bytes.size(); ++length) {
+    const std::vector<uint8_t> truncated(datagram.bytes.begin(), datagram.bytes.begin() + length);
+    CHECK(!decodeMulticastPacket(truncated.data(), truncated.size(), packet));
+  }
+
+  Datagram overlongText(1);
+  overlongText.entry(1, MULTICAST_ACTION_SET_TEXT, 0, "abc");
+  overlongText.bytes[MULTICAST_HEADER_SIZE + MULTICAST_ENTRY_HEADER_SIZE - 1] = 4;
+  CHECK(!overlongText.decode(packet));
+}
+
+TEST(sequence_filter_drops_duplicates_and_reordering) {
+  MulticastSequenceFilter<4> filter;
+  CHECK(filter.accept(1, 10));
+  CHECK(!filter.accept(1, 10));  // Copie redondante.
+  CHECK(filter.accept(1, 12));
+  CHECK(!filter.accept(1, 11));  // Arrivé après le suivant.
+  CHECK(!filter.accept(1, 12));
+  CHECK(filter.accept(1, 13));
+}
+
+TEST(sequence_filter_wraps_around) {
+  MulticastSequenceFilter<4> filter;
+  CHECK(filter.accept(1, 0xFFFFFFFE));
+  CHECK(filter.accept(1, 0xFFFFFFFF));
+  CHECK(filter.accept(1, 0));
+  CHECK(filter.accept(1, 1));
+  CHECK(!filter.accept(1, 0xFFFFFFFF));  // Antérieur modulo 2^32.
+  CHECK(!filter.accept(1, 0));
+  // Un saut de plus d'une demi-plage est vu comme un retour en arrière.
+  CHECK(!filter.accept(1, 1 + 0x80000000u));
+  CHECK(filter.accept(1, 0x80000000u));
+}
+
+TEST(sequence_filter_tracks_senders_independently) {
+  MulticastSequenceFilter<4> filter;
+  CHECK(filter.accept(1, 100));
+  CHECK(filter.accept(2, 5));    // Autre émetteur, séquence plus basse : accepté.
+  CHECK(filter.accept(3, 100));  // Même séquence qu'un autre émetteur : accepté.
+  CHECK(!filter.accept(2, 5));
+  CHECK(!filter.accept(1, 99));
+  CHECK(filter.accept(2, 6));
+  CHECK(filter.accept(1, 101));
+  CHECK(!filter.accept(3, 100));
+}
+
+TEST(sequence_filter_forgets_least_recent_sender) {
+  MulticastSequenceFilter<2> filter;
+  CHECK(filter.accept(1, 10));
+  CHECK(filter.accept(2, 10));
+  CHECK(filter.accept(1, 11));   // L'émetteur 2 devient le moins récent.
+  CHECK(filter.accept(3, 10));   // Remplace l'émetteur 2.
+  CHECK(!filter.accept(1, 11));  // L'émetteur 1 est toujours suivi.
+  CHECK(!filter.accept(3, 10));
+  CHECK(filter.accept(2, 10));   // Oublié : sa copie est acceptée de nouveau.
+}
@@ -0,0 +1,227 @@
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "osc_protocol.h"
+#include "test_support.h"
+
+namespace {
+
+// Construit un paquet OSC octet par octet (chaînes complétées à 4 octets, big-endian).
+struct Packet {
+  std::vector<uint8_t> bytes;
+
+  Packet &string(const char *text) {
+    const size_t length = strlen(text);
+    bytes.insert(bytes.end(), text, text + length);
+    bytes.push_back(0);
+    pad();
+    return *this;
+  }
+  Packet &u32(uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      bytes.push_back(static_cast<uint8_t>(value >> shift));
+    }
+    return *this;
+  }
+  Packet &u64(uint64_t value) {
+    u32(static_cast<uint32_t>(value >> 32));
+    return u32(static_cast<uint32_t>(value));
+  }
+  Packet &blob(const uint8_t *data, uint32_t length) {
+    u32(length);
+    bytes.insert(bytes.end(), data, data + length);
+    pad();
+    return *this;
+  }
+  Packet &raw(const std::vector<uint8_t> &data) {
+    bytes.insert(bytes.end(), data.begin(), data.end());
+    return *this;
+  }
+  // Élément de bundle : taille puis contenu.
+  Packet &element(const Packet &content) {
+    u32(static_cast<uint32_t>(content.bytes.size()));
+    return raw(content.bytes);
+  }
+  void pad() {
+    while (bytes.size() % 4 != 0) {
+      bytes.push_back(0);
+    }
+  }
+};
+
+Packet bundle(uint64_t timetag) {
+  Packet packet;
+  packet.string("#bundle").u64(timetag);
+  return packet;
+}
+
+struct Received {
+  std::string address;
+  std::string typeTags;
+  uint64_t timetag;
+};
+
+void collect(const OscMessage &message, uint64_t timetag, void *context) {
+  static_cast<std::vector<Received> *>(context)->push_back({message.address, message.typeTags, timetag});
+}
+
+bool parse(const Packet &packet, std::vector<Received> &received) {
+  return parseOscPacket(packet.bytes.data(), packet.bytes.size(), collect, &received);
+}
+
+constexpr int64_t kNtpToUnixSeconds = 2208988800LL;
+constexpr int64_t kNowUnixUs = 1700000000LL * 1000000LL;
+
+uint64_t timetagAt(int64_t unixUs) {
+  const uint64_t seconds = static_cast<uint64_t>(unixUs / 1000000 + kNtpToUnixSeconds);
+  const uint64_t fraction = (static_cast<uint64_t>(unixUs % 1000000) << 32) / 1000000;
+  return seconds << 32 | fraction;
+}
+
+}  // namespace
+
+TEST(parses_message_arguments) {
+  const uint8_t payload[3] = {1, 2, 3};
+  Packet packet;
+  packet.string("/stagecue/cue/1/text").string(",sibT").string("Bonjour").u32(0xFFFFFFFE).blob(payload, 3);
+
+  std::vector<Received> received;
+  CHECK(parse(packet, received));
+  CHECK_EQ(1, received.size());
+  CHECK(received[0].address == "/stagecue/cue/1/text");
+  CHECK(received[0].typeTags == "sibT");
+  CHECK_EQ(OSC_TIMETAG_IMMEDIATE, received[0].timetag);
+
+  OscMessage message;
+  message.address = "/x";
+  message.typeTags = "sibT";
+  message.arguments = packet.bytes.data() + 24 + 8;  // Après l'adresse (24) et les types (8).
+  message.argumentsLength = packet.bytes.size() - 32;
+  OscArgumentReader reader(message);
+  OscArgument argument;
+  CHECK(reader.next(argument));
+  CHECK(argument.type == 's' && strcmp(argument.string, "Bonjour") == 0);
+  CHECK(reader.next(argument));
+  CHECK_EQ(-2, argument.integer);
+  CHECK(reader.next(argument));
+  CHECK(argument.type == 'b' && argument.length == 3 && memcmp(argument.blob, payload, 3) == 0);
+  CHECK(reader.next(argument));
+  CHECK(argument.type == 'T' && argument.integer == 1);
+  CHECK(!reader.next(argument));
+}
+
+TEST(accepts_missing_type_tag_string) {
+  Packet packet;
+  packet.string("/stagecue/cue/2/go");
+  std::vector<Received> received;
+  CHECK(parse(packet, received));
+  CHECK_EQ(1, received.size());
+  CHECK(received[0].typeTags.empty());
+
+  // Des octets après l'adresse sans virgule ne sont pas une chaîne de types.
+  packet.u32(42);
+  received.clear();
+  CHECK(!parse(packet, received));
+  CHECK(received.empty());
+}
+
+TEST(rejects_truncated_string_and_blob) {
+  std::vector<Received> received;
+
+  Packet unterminated;  // Chaîne sans NUL dans le paquet.
+  unterminated.string("/a").string(",s");
+  unterminated.raw({'a', 'b', 'c', 'd'});
+  CHECK(!parse(unterminated, received));
+
+  const uint8_t payload[8] = {};
+  Packet blob;
+  blob.string("/a").string(",b").blob(payload, 8);
+  blob.bytes[8 + 3] = 12;  // Taille annoncée au-delà des 8 octets présents.
+  CHECK(!parse(blob, received));
+
+  Packet missing;  // Type annoncé, argument absent.
+  missing.string("/a").string(",i");
+  CHECK(!parse(missing, received));
+
+  Packet unaligned;
+  unaligned.string("/a");
+  unaligned.bytes.push_back(0);
+  CHECK(!parse(unaligned, received));
+  CHECK(received.empty());
+}
+
+TEST(nested_bundles_carry_their_timetag) {
+  Packet first;
+  first.string("/stagecue/cue/1/go").string(",");
+  Packet second;
+  second.string("/stagecue/cue/2/go").string(",");
+  Packet inner = bundle(200);
+  inner.element(second);
+  Packet outer = bundle(100);
+  outer.element(first).element(inner);
+
+  std::vector<Received> received;
+  CHECK(parse(outer, received));
+  CHECK_EQ(2, received.size());
+  CHECK(received[0].address == "/stagecue/cue/1/go");
+  CHECK_EQ(100, received[0].timetag);
+  CHECK(received[1].address == "/stagecue/cue/2/go");
+  CHECK_EQ(200, received[1].timetag);
+}
+
+TEST(invalid_bundle_has_no_effect) {
+  Packet good;
+  good.string("/stagecue/cue/1/go").string(",");
+  Packet bad;
+  bad.string("/stagecue/cue/2/go").string(",i");  // Argument manquant.
+  Packet packet = bundle(OSC_TIMETAG_IMMEDIATE);
+  packet.element(good).element(bad);
+
+  // Validation complète avant le premier message : aucun message rendu.
+  std::vector<Received> received;
+  CHECK(!parse(packet, received));
+  CHECK(received.empty());
+
+  Packet overrun = bundle(OSC_TIMETAG_IMMEDIATE);
+  overrun.u32(64).raw(good.bytes);  // Taille d'élément au-delà du paquet.
+  CHECK(!parse(overrun, received));
+  CHECK(received.empty());
+}
+
+TEST(limits_bundle_depth) {
+  Packet message;
+  message.string("/a").string(",");
+  Packet packet = message;
+  for (size_t depth = 0; depth < OSC_MAX_BUNDLE_DEPTH; ++depth) {
+    Packet wrapper = bundle(OSC_TIMETAG_IMMEDIATE);
+    wrapper.element(packet);
+    packet = wrapper;
+  }
+  std::vector<Received> received;
+  CHECK(parse(packet, received));
+
+  Packet deeper = bundle(OSC_TIMETAG_IMMEDIATE);
+  deeper.element(packet);
+  received.clear();
+  CHECK(!parse(deeper, received));
+  CHECK(received.empty());
+}
+
+TEST(plans_timetags) {
+  const int64_t maxLeadUs = 600LL * 1000000LL;
+  int64_t leadUs = -1;
+
+  CHECK(planOscTimetag(OSC_TIMETAG_IMMEDIATE, kNowUnixUs, maxLeadUs, leadUs) == OscTimetagPlan::Immediate);
+  CHECK(planOscTimetag(timetagAt(kNowUnixUs - 1000), kNowUnixUs, maxLeadUs, leadUs) == OscTimetagPlan::Immediate);
+  CHECK_EQ(0, leadUs);
+
+  CHECK(planOscTimetag(timetagAt(kNowUnixUs + 250000), kNowUnixUs, maxLeadUs, leadUs) ==
+        OscTimetagPlan::Scheduled);
+  // La fraction 32 bits arrondit vers le bas : une microseconde d'écart au plus.
+  CHECK(leadUs >= 249999 && leadUs <= 250000);
+
+  CHECK(planOscTimetag(timetagAt(kNowUnixUs + maxLeadUs + 1000000), kNowUnixUs, maxLeadUs, leadUs) ==
+        OscTimetagPlan::Rejected);
+}
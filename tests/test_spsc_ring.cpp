@@ -0,0 +1,81 @@
+#include <thread>
+
+#include "spsc_ring.h"
+#include "test_support.h"
+
+TEST(empty_ring_pops_nothing) {
+  SpscRing<uint32_t, 4> ring;
+  uint32_t item = 42;
+  CHECK(ring.empty());
+  CHECK(!ring.pop(item));
+  CHECK_EQ(42, item);
+}
+
+TEST(full_ring_rejects_push) {
+  SpscRing<uint32_t, 4> ring;
+  for (uint32_t i = 0; i < 4; ++i) {
+    CHECK(ring.push(i));
+  }
+  CHECK(!ring.push(99));
+
+  // Une place libérée accepte de nouveau un élément, sans écraser les plus anciens.
+  uint32_t item = 0;
+  CHECK(ring.pop(item));
+  CHECK_EQ(0, item);
+  CHECK(ring.push(4));
+  CHECK(!ring.push(5));
+  for (uint32_t expected = 1; expected <= 4; ++expected) {
+    CHECK(ring.pop(item));
+    CHECK_EQ(expected, item);
+  }
+  CHECK(ring.empty());
+}
+
+TEST(wraps_around_the_slots_in_order) {
+  SpscRing<uint32_t, 4> ring;
+  uint32_t next = 0;
+  uint32_t expected = 0;
+  // Remplissages partiels de tailles variables : les indices font de nombreux tours du tableau.
+  for (uint32_t round = 0; round < 1000; ++round) {
+    const uint32_t batch = 1 + round % 4;
+    for (uint32_t i = 0; i < batch; ++i) {
+      CHECK(ring.push(next++));
+    }
+    uint32_t item = 0;
+    while (ring.pop(item)) {
+      CHECK_EQ(expected, item);
+      ++expected;
+    }
+    CHECK(ring.empty());
+  }
+  CHECK_EQ(next, expected);
+}
+
+TEST(single_producer_single_consumer_keeps_order) {
+  constexpr uint32_t kItems = 200000;
+  SpscRing<uint32_t, 8> ring;
+  std::thread producer([&ring]() {
+    for (uint32_t i = 0; i < kItems;) {
+      if (ring.push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();  // File pleine (indispensable sur une machine à un seul cœur).
+      }
+    }
+  });
+
+  uint32_t expected = 0;
+  uint32_t outOfOrder = 0;
+  while (expected < kItems) {
+    uint32_t item = 0;
+    if (ring.pop(item)) {
+      outOfOrder += item != expected;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  CHECK_EQ(0, outOfOrder);
+  CHECK(ring.empty());
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+// Mini-cadre de tests hôte : un exécutable par fichier test_*.cpp, sans dépendance externe.
+//   TEST(nom) { CHECK(condition); CHECK_EQ(attendu, obtenu); }
+// main() exécute tous les tests déclarés et rend 1 si une vérification a échoué.
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace test {
+
+using TestFunction = void (*)();
+
+struct TestCase {
+  const char *name;
+  TestFunction run;
+  TestCase *next;
+};
+
+inline TestCase *&registry() {
+  static TestCase *head = nullptr;
+  return head;
+}
+
+inline int &failures() {
+  static int count = 0;
+  return count;
+}
+
+struct Registrar {
+  Registrar(TestCase &test) {
+    // Ajout en fin de liste : les tests s'exécutent dans l'ordre du fichier.
+    TestCase **tail = &registry();
+    while (*tail != nullptr) {
+      tail = &(*tail)->next;
+    }
+    *tail = &test;
+  }
+};
+
+inline void fail(const char *file, int line, const char *expression) {
+  ++failures();
+  fprintf(stderr, "  %s:%d: échec : %s\n", file, line, expression);
+}
+
+inline void failEqual(const char *file, int line, const char *expression, long long expected, long long actual) {
+  ++failures();
+  fprintf(stderr, "  %s:%d: échec : %s (attendu %lld, obtenu %lld)\n", file, line, expression, expected, actual);
+}
+
+}  // namespace test
+
+#define TEST(name)                                              \
+  void test_##name();                                           \
+  test::TestCase testCase_##name{#name, test_##name, nullptr};  \
+  test::Registrar testRegistrar_##name{testCase_##name};        \
+  void test_##name()
+
+#define CHECK(condition)                                 \
+  do {                                                   \
+    if (!(condition)) {                                  \
+      test::fail(__FILE__, __LINE__, #condition);        \
+    }                                                    \
+  } while (0)
+
+#define CHECK_EQ(expected, actual)                                                                      \
+  do {                                                                                                  \
+    const long long checkExpected = static_cast<long long>(expected);                                  \
+    const long long checkActual = static_cast<long long>(actual);                                      \
+    if (checkExpected != checkActual) {                                                                \
+      test::failEqual(__FILE__, __LINE__, #expected " == " #actual, checkExpected, checkActual);       \
+    }                                                                                                   \
+  } while (0)
+
+int main() {
+  int run = 0;
+  for (test::TestCase *test = test::registry(); test != nullptr; test = test->next) {
+    const int before = test::failures();
+    test->run();
+    printf("%s %s\n", test::failures() == before ? "[ OK ]" : "[FAIL]", test->name);
+    ++run;
+  }
+  printf("%d tests, %d vérifications en échec\n", run, test::failures());
+  return test::failures() == 0 ? 0 : 1;
+}
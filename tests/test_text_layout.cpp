@@ -0,0 +1,158 @@
+#include <ctype.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "text_layout.h"
+#include "test_support.h"
+
+namespace {
+
+constexpr uint16_t kWidth = 128;
+constexpr size_t kMaxLines = 8;
+
+// Largeur rendue par Adafruit_GFX::getTextBounds() pour la police par défaut, taille 1, sans
+// retour automatique : 6 px par caractère, '\r' ignoré (une ligne ne contient pas de '\n').
+uint16_t gfxTextWidth(const std::string &line) {
+  uint16_t width = 0;
+  for (char c : line) {
+    width += c == '\r' ? 0 : 6;
+  }
+  return width;
+}
+
+std::string trimmed(const std::string &text) {
+  size_t start = 0;
+  size_t end = text.size();
+  while (start < end && isspace(static_cast<unsigned char>(text[start]))) {
+    ++start;
+  }
+  while (end > start && isspace(static_cast<unsigned char>(text[end - 1]))) {
+    --end;
+  }
+  return text.substr(start, end - start);
+}
+
+// Boucle d'origine de renderWrappedText() (String remplacé par std::string, print() par la
+// collecte des lignes) : plus long préfixe qui tient, mesuré par getTextBounds.
+std::vector<std::string> referenceLayout(const std::string &text) {
+  std::vector<std::string> printed;
+  size_t start = 0;
+  while (start < text.size() && printed.size() < kMaxLines) {
+    const size_t newline = text.find('\n', start);
+    const size_t end = newline != std::string::npos ? newline : text.size();
+    std::string line = text.substr(start, end - start);
+
+    while (!line.empty() && printed.size() < kMaxLines) {
+      if (gfxTextWidth(line) <= kWidth) {
+        printed.push_back(line);
+        break;
+      }
+      size_t breakIndex = line.size();
+      while (breakIndex > 0) {
+        const std::string candidate = line.substr(0, breakIndex);
+        if (gfxTextWidth(candidate) <= kWidth) {
+          printed.push_back(candidate);
+          line = trimmed(line.substr(breakIndex));
+          break;
+        }
+        --breakIndex;
+      }
+      if (breakIndex == 0) {
+        printed.push_back(line.substr(0, kWidth / 6));
+        line.erase(0, kWidth / 6);
+      }
+    }
+    start = end + 1;
+  }
+  return printed;
+}
+
+std::vector<std::string> newLayout(const std::string &text) {
+  TextLine lines[kMaxLines];
+  const size_t count = layoutWrappedText(text.data(), text.size(), kWidth, lines, kMaxLines);
+  std::vector<std::string> printed;
+  for (size_t i = 0; i < count; ++i) {
+    printed.push_back(text.substr(lines[i].start, lines[i].length));
+  }
+  return printed;
+}
+
+bool sameLayout(const std::string &text) {
+  const bool same = referenceLayout(text) == newLayout(text);
+  if (!same) {
+    fprintf(stderr, "  différence pour \"%s\"\n", text.c_str());
+  }
+  return same;
+}
+
+std::string randomText(size_t maxLength) {
+  static const char *const pieces[] = {"a", "b", "Z", " ", "  ", "\t", "\n", "\r", "é", "€", "jardin", "."};
+  std::string text;
+  const size_t target = static_cast<size_t>(rand()) % (maxLength + 1);
+  while (text.size() < target) {
+    text += pieces[static_cast<size_t>(rand()) % (sizeof(pieces) / sizeof(pieces[0]))];
+  }
+  return text.substr(0, target);
+}
+
+template <typename Layout>
+double nanosecondsPerCall(Layout layout, const std::vector<std::string> &texts, int rounds) {
+  size_t sink = 0;
+  const auto started = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; ++round) {
+    for (const std::string &text : texts) {
+      sink += layout(text);
+    }
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - started;
+  if (sink == static_cast<size_t>(-1)) {
+    printf("%zu\n", sink);  // Empêche l'élimination des appels.
+  }
+  return std::chrono::duration<double, std::nano>(elapsed).count() / (static_cast<double>(rounds) * texts.size());
+}
+
+}  // namespace
+
+TEST(matches_reference_on_known_cases) {
+  CHECK(sameLayout(""));
+  CHECK(sameLayout("Cue 1"));
+  CHECK(sameLayout("Entrée côté cour, rideau à mi-hauteur, noir salle"));
+  CHECK(sameLayout("aaaaaaaaaaaaaaaaaaaaa"));   // 21 caractères : 126 px, tient.
+  CHECK(sameLayout("aaaaaaaaaaaaaaaaaaaaaa"));  // 22 caractères : coupé.
+  CHECK(sameLayout("ligne 1\n\nligne 3\n"));   // Ligne vide ignorée.
+  CHECK(sameLayout("   espaces en tête conservés sur la première ligne"));
+  CHECK(sameLayout("coupe                         au milieu d'espaces"));
+  CHECK(sameLayout("aaaaaaaaaaaaaaaaaaaaa\r\rb"));  // '\r' sans largeur.
+  CHECK(sameLayout(std::string(200, 'x')));          // Au-delà de 8 lignes.
+}
+
+TEST(matches_reference_on_random_texts) {
+  srand(7);
+  int differences = 0;
+  for (int i = 0; i < 20000; ++i) {
+    differences += sameLayout(randomText(i % 2 == 0 ? 64 : 200)) ? 0 : 1;
+  }
+  CHECK_EQ(0, differences);
+}
+
+TEST(benchmark_against_reference) {
+  srand(11);
+  std::vector<std::string> texts;
+  for (int i = 0; i < 256; ++i) {
+    texts.push_back(randomText(64));
+  }
+  const double reference = nanosecondsPerCall([](const std::string &text) { return referenceLayout(text).size(); },
+                                              texts, 20);
+  const double current = nanosecondsPerCall(
+      [](const std::string &text) {
+        TextLine lines[kMaxLines];
+        return layoutWrappedText(text.data(), text.size(), kWidth, lines, kMaxLines);
+      },
+      texts, 200);
+  printf("  mise en page (64 octets max) : boucle getTextBounds %.0f ns/appel, layoutWrappedText %.0f ns/appel\n",
+         reference, current);
+  CHECK(current < reference);
+}
@@ -0,0 +1,70 @@
+#include "text_layout.h"
+
+namespace {
+
+// Équivalent de isspace() tel qu'utilisé par String::trim().
+bool isTrimmable(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+}  // namespace
+
+size_t layoutWrappedText(const char *text, size_t length, uint16_t maxWidth, TextLine *lines, size_t maxLines,
+                         const GlyphWidthTable &widths) {
+  if (text == nullptr || lines == nullptr) {
+    return 0;
+  }
+
+  // Coupe brutale lorsqu'aucun glyphe ne tient sur la ligne.
+  const size_t fallbackChars = maxWidth / GFX_CLASSIC_FONT_ADVANCE;
+  size_t count = 0;
+  size_t segmentStart = 0;
+
+  while (segmentStart < length && count < maxLines) {
+    size_t segmentEnd = segmentStart;
+    while (segmentEnd < length && text[segmentEnd] != '\n') {
+      ++segmentEnd;
+    }
+
+    size_t lineStart = segmentStart;
+    size_t lineEnd = segmentEnd;
+    while (lineStart < lineEnd && count < maxLines) {
+      uint32_t width = 0;
+      size_t cut = lineStart;
+      while (cut < lineEnd) {
+        const uint8_t glyphWidth = widths[static_cast<uint8_t>(text[cut])];
+        if (width + glyphWidth > maxWidth) {
+          break;
+        }
+        width += glyphWidth;
+        ++cut;
+      }
+
+      if (cut == lineEnd) {
+        lines[count++] = {static_cast<uint16_t>(lineStart), static_cast<uint16_t>(lineEnd - lineStart)};
+        break;
+      }
+
+      if (cut == lineStart) {
+        const size_t remaining = lineEnd - lineStart;
+        const size_t take = remaining < fallbackChars ? remaining : fallbackChars;
+        lines[count++] = {static_cast<uint16_t>(lineStart), static_cast<uint16_t>(take)};
+        lineStart += take;
+        continue;
+      }
+
+      lines[count++] = {static_cast<uint16_t>(lineStart), static_cast<uint16_t>(cut - lineStart)};
+      lineStart = cut;
+      while (lineStart < lineEnd && isTrimmable(text[lineStart])) {
+        ++lineStart;
+      }
+      while (lineEnd > lineStart && isTrimmable(text[lineEnd - 1])) {
+        --lineEnd;
+      }
+    }
+
+    segmentStart = segmentEnd + 1;
+  }
+
+  return count;
+}
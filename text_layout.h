@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Mise en page du texte des écrans OLED sans allocation.
+// -----------------------------------------------------------------------------
+
+// Police GFX par défaut (glcdfont 5x7) : 5 px de glyphe + 1 px d'espacement par caractère.
+constexpr uint8_t GFX_CLASSIC_FONT_ADVANCE = 6;
+
+// Table des largeurs (px) indexée par octet, calculée à la compilation comme le fait
+// Adafruit_GFX::charBounds() : '\n' et '\r' n'avancent pas le curseur.
+struct GlyphWidthTable {
+  uint8_t widths[256];
+
+  constexpr explicit GlyphWidthTable(uint8_t advance) : widths() {
+    for (size_t c = 0; c < 256; ++c) {
+      widths[c] = (c == '\n' || c == '\r') ? 0 : advance;
+    }
+  }
+
+  constexpr uint8_t operator[](uint8_t c) const { return widths[c]; }
+};
+
+constexpr GlyphWidthTable kClassicFontWidths(GFX_CLASSIC_FONT_ADVANCE);
+
+struct TextLine {
+  uint16_t start;
+  uint16_t length;
+};
+
+// Découpe `text` en lignes d'au plus `maxWidth` pixels, en un seul passage et sans copie.
+// Reproduit le comportement historique : découpage sur '\n', coupe au plus long préfixe
+// qui tient, suppression des espaces autour du reste. Retourne le nombre de lignes écrites.
+size_t layoutWrappedText(const char *text, size_t length, uint16_t maxWidth, TextLine *lines, size_t maxLines,
+                         const GlyphWidthTable &widths = kClassicFontWidths);
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Prépare l'interface Web pour le système de fichiers de l'ESP32 ou pour la flash du firmware.
+
+Les fichiers de data/ sont compressés en gzip ; les feuilles de style et scripts sont
+renommés avec une empreinte de leur contenu (app.<hash>.js) et les pages HTML réécrites
+pour y faire référence.
+
+Deux sorties possibles :
+  * un dossier à téléverser sur LittleFS/SPIFFS (variantes .gz + assets.manifest lu par le
+    firmware pour l'ETag et la politique de cache) ;
+  * avec --embed, le fichier embedded_assets.cpp : les mêmes fichiers sous forme de tableaux
+    constexpr compilés dans le firmware, servis sans système de fichiers.
+
+Usage : python3 tools/build_assets.py [--source data] [--output build/data]
+        python3 tools/build_assets.py --embed [embedded_assets.cpp]
+"""
+
+import argparse
+import gzip
+import hashlib
+import re
+import shutil
+from dataclasses import dataclass
+from pathlib import Path
+
+MANIFEST_NAME = "assets.manifest"
+HASH_LENGTH = 10
+BYTES_PER_LINE = 16
+
+CONTENT_TYPES = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+# Les pages gardent leur URL (/, /wifi) : elles sont revalidées à chaque chargement.
+PAGE_SUFFIXES = {".html"}
+
+REFERENCE_PATTERN = re.compile(r'(?P<attr>href|src)="(?P<name>[^"?#:]+)"')
+
+
+@dataclass
+class Asset:
+    url: str
+    etag: str
+    immutable: bool
+    content_type: str
+    payload: bytes  # Contenu compressé en gzip.
+
+
+def content_hash(data: bytes) -> str:
+    return hashlib.sha256(data).hexdigest()[:HASH_LENGTH]
+
+
+def compress(data: bytes) -> bytes:
+    # mtime=0 : sortie reproductible d'une compilation à l'autre.
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def fingerprinted_name(path: Path, digest: str) -> str:
+    return f"{path.stem}.{digest}{path.suffix}"
+
+
+def rewrite_references(html: str, renamed: dict) -> str:
+    def replace(match):
+        name = match.group("name").lstrip("/")
+        if name not in renamed:
+            return match.group(0)
+        return f'{match.group("attr")}="{renamed[name]}"'
+
+    return REFERENCE_PATTERN.sub(replace, html)
+
+
+def collect_assets(source: Path) -> list:
+    files = sorted(p for p in source.iterdir() if p.is_file() and p.suffix in CONTENT_TYPES)
+    renamed = {}
+    assets = []
+
+    for path in files:
+        if path.suffix in PAGE_SUFFIXES:
+            continue
+        data = path.read_bytes()
+        digest = content_hash(data)
+        name = fingerprinted_name(path, digest)
+        renamed[path.name] = name
+        assets.append(Asset(f"/{name}", digest, True, CONTENT_TYPES[path.suffix], compress(data)))
+
+    for path in files:
+        if path.suffix not in PAGE_SUFFIXES:
+            continue
+        data = rewrite_references(path.read_text(encoding="utf-8"), renamed).encode("utf-8")
+        assets.append(Asset(f"/{path.name}", content_hash(data), False, CONTENT_TYPES[path.suffix], compress(data)))
+
+    return assets
+
+
+def write_folder(assets: list, output: Path) -> None:
+    if output.exists():
+        shutil.rmtree(output)
+    output.mkdir(parents=True)
+
+    for asset in assets:
+        (output / f"{asset.url.lstrip('/')}.gz").write_bytes(asset.payload)
+
+    # Une entrée par ligne : chemin<TAB>etag<TAB>immuable(0/1)<TAB>type MIME.
+    lines = [f"{a.url}\t{a.etag}\t{int(a.immutable)}\t{a.content_type}" for a in assets]
+    (output / MANIFEST_NAME).write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+
+def format_bytes(payload: bytes) -> str:
+    rows = []
+    for offset in range(0, len(payload), BYTES_PER_LINE):
+        chunk = payload[offset:offset + BYTES_PER_LINE]
+        rows.append("    " + ", ".join(f"0x{byte:02x}" for byte in chunk) + ",")
+    return "\n".join(rows)
+
+
+def write_embedded(assets: list, output: Path) -> None:
+    parts = [
+        "// Généré par tools/build_assets.py --embed à partir de data/ : ne pas modifier à la main.",
+        '#include "embedded_assets.h"',
+        "",
+        "namespace {",
+        "",
+    ]
+    for index, asset in enumerate(assets):
+        parts.append(f"// {asset.url} ({len(asset.payload)} octets compressés)")
+        parts.append(f"constexpr uint8_t kAsset{index}[] PROGMEM = {{")
+        parts.append(format_bytes(asset.payload))
+        parts.append("};")
+        parts.append("")
+    parts.append("}  // namespace")
+    parts.append("")
+    parts.append("const EmbeddedAsset embeddedAssets[] = {")
+    for index, asset in enumerate(assets):
+        immutable = "true" if asset.immutable else "false"
+        parts.append(f'    {{"{asset.url}", kAsset{index}, sizeof(kAsset{index}), "{asset.content_type}", '
+                     f'"\\"{asset.etag}\\"", {immutable}}},')
+    parts.append("};")
+    parts.append("")
+    parts.append("const size_t embeddedAssetCount = sizeof(embeddedAssets) / sizeof(embeddedAssets[0]);")
+    output.write_text("\n".join(parts) + "\n", encoding="utf-8")
+
+
+def main():
+    root = Path(__file__).resolve().parent.parent
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--source", type=Path, default=root / "data")
+    parser.add_argument("--output", type=Path, default=root / "build" / "data")
+    parser.add_argument("--embed", type=Path, nargs="?", const=root / "embedded_assets.cpp",
+                        help="génère le fichier C++ des ressources embarquées au lieu du dossier")
+    args = parser.parse_args()
+
+    assets = collect_assets(args.source)
+    for asset in assets:
+        policy = "immutable" if asset.immutable else "revalidate"
+        print(f"{asset.url:32} {asset.etag} {policy:10} {len(asset.payload)} octets")
+
+    if args.embed is not None:
+        write_embedded(assets, args.embed)
+        print(f"{len(assets)} ressources embarquées dans {args.embed}")
+    else:
+        write_folder(assets, args.output)
+        print(f"{len(assets)} fichiers écrits dans {args.output}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Rejoue un enregistrement d'univers DMX en sACN (E1.31) ou en Art-Net.
+
+Comme une console, l'univers complet est réémis en continu (44 trames/s par défaut) ; les lignes
+de l'enregistrement ne décrivent que les changements :
+
+    # délai_ms canal=niveau ...
+    0     1=0 2=0
+    500   1=255          (cue 1 : franchit le seuil)
+    1500  1=0 2=200
+
+Usage : python3 tools/dmx_replay.py enregistrement.txt --target 192.168.1.50
+        python3 tools/dmx_replay.py enregistrement.txt --protocol artnet --target 255.255.255.255
+
+Sans --target, les trames sACN partent vers l'adresse multicast de l'univers et les trames
+Art-Net vers 127.0.0.1 (essai en boucle locale sous Linux).
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+import uuid
+
+SACN_PORT = 5568
+ARTNET_PORT = 6454
+UNIVERSE_SIZE = 512
+
+ACN_PACKET_IDENTIFIER = b"ASC-E1.17\x00\x00\x00"
+VECTOR_ROOT_DATA = 0x00000004
+VECTOR_FRAMING_DATA = 0x00000002
+OPTION_STREAM_TERMINATED = 0x40
+
+
+def flags_and_length(length: int) -> int:
+    return 0x7000 | length
+
+
+def sacn_packet(cid: bytes, source_name: str, universe: int, priority: int, sequence: int, levels: bytes,
+                terminated: bool = False) -> bytes:
+    slots = b"\x00" + levels  # Code de départ nul.
+    dmp = struct.pack("!HBBHHH", flags_and_length(10 + len(slots)), 0x02, 0xA1, 0, 1, len(slots)) + slots
+    name = source_name.encode("utf-8")[:63].ljust(64, b"\x00")
+    options = OPTION_STREAM_TERMINATED if terminated else 0
+    framing = struct.pack("!HI", flags_and_length(77 + len(dmp)), VECTOR_FRAMING_DATA) + name + \
+        struct.pack("!BHBBH", priority, 0, sequence, options, universe) + dmp
+    root = struct.pack("!HH", 0x0010, 0) + ACN_PACKET_IDENTIFIER + \
+        struct.pack("!HI", flags_and_length(22 + len(framing)), VECTOR_ROOT_DATA) + cid
+    return root + framing
+
+
+def artnet_packet(universe: int, sequence: int, levels: bytes) -> bytes:
+    return b"Art-Net\x00" + struct.pack("<H", 0x5000) + struct.pack("!H", 14) + \
+        struct.pack("BBBB", sequence, 0, universe & 0xFF, (universe >> 8) & 0x7F) + \
+        struct.pack("!H", len(levels)) + levels
+
+
+def load_recording(path: str) -> list:
+    events = []
+    with open(path, encoding="utf-8") as recording:
+        for number, line in enumerate(recording, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            delay, *changes = line.split()
+            levels = {}
+            for change in changes:
+                channel, _, level = change.partition("=")
+                channel, level = int(channel), int(level)
+                if not 1 <= channel <= UNIVERSE_SIZE or not 0 <= level <= 255:
+                    sys.exit(f"{path}:{number} : canal ou niveau hors limites ({change})")
+                levels[channel] = level
+            events.append((float(delay) / 1000, levels))
+    return events
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("recording")
+    parser.add_argument("--protocol", choices=("sacn", "artnet"), default="sacn")
+    parser.add_argument("--universe", type=int, default=1)
+    parser.add_argument("--priority", type=int, default=100, help="priorité sACN (0-200)")
+    parser.add_argument("--target", help="adresse de destination (unicast ou diffusion)")
+    parser.add_argument("--port", type=int)
+    parser.add_argument("--rate", type=float, default=44.0, help="trames par seconde")
+    parser.add_argument("--hold", type=float, default=1.0, help="secondes d'émission après le dernier changement")
+    args = parser.parse_args()
+
+    events = load_recording(args.recording)
+    if args.protocol == "sacn":
+        target = args.target or f"239.255.{args.universe >> 8}.{args.universe & 0xFF}"
+        port = args.port or SACN_PORT
+    else:
+        target = args.target or "127.0.0.1"
+        port = args.port or ARTNET_PORT
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+    cid = uuid.uuid4().bytes
+    levels = bytearray(UNIVERSE_SIZE)
+    sequence = 0
+    period = 1.0 / args.rate
+
+    def send(terminated=False):
+        nonlocal sequence
+        # Art-Net réserve la séquence 0 ("désactivée") : le compteur boucle sur 1..255.
+        sequence = sequence % 255 + 1 if args.protocol == "artnet" else (sequence + 1) & 0xFF
+        if args.protocol == "sacn":
+            packet = sacn_packet(cid, "StageCue replay", args.universe, args.priority, sequence, bytes(levels),
+                                 terminated)
+        else:
+            packet = artnet_packet(args.universe, sequence, bytes(levels))
+        sock.sendto(packet, (target, port))
+
+    start = time.monotonic()
+    next_frame = start
+    elapsed = 0.0
+    frames = 0
+    for delay, changes in events + [(args.hold, {})]:
+        elapsed += delay
+        deadline = start + elapsed
+        while next_frame < deadline:
+            time.sleep(max(0.0, next_frame - time.monotonic()))
+            send()
+            frames += 1
+            next_frame += period
+        for channel, level in changes.items():
+            levels[channel - 1] = level
+        if changes:
+            print(f"{elapsed * 1000:8.0f} ms  " + " ".join(f"{c}={v}" for c, v in sorted(changes.items())))
+
+    if args.protocol == "sacn":
+        for _ in range(3):  # E1.31 §6.2.6 : trois trames de fin de flux.
+            send(terminated=True)
+    print(f"{frames} trames {args.protocol} émises vers {target}:{port}, univers {args.universe}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Endurance : enchaîne les déclenchements avec des textes de longueur variable et relève le tas.
+
+Chaque déclenchement passe par /api/cues/trigger avec un nouveau texte (1 à 80 octets, accents
+compris), ce qui exerce le nettoyage, la persistance différée, l'affichage et la diffusion.
+/api/health est relevé périodiquement : mémoire libre, minimum atteint et plus grand bloc
+allouable. Un plus grand bloc qui décroît alors que la mémoire libre reste stable signale une
+fragmentation du tas.
+
+Usage : python3 tools/soak_test.py --host 192.168.1.50 --triggers 10000 --sample 500
+        python3 tools/soak_test.py --host stagecue.local --token secret --cues 3
+"""
+
+import argparse
+import json
+import random
+import sys
+import time
+import urllib.error
+import urllib.parse
+import urllib.request
+
+WORDS = ["Entrée", "côté", "cour", "jardin", "noir", "salle", "plein", "feu", "rideau", "top", "acte", "scène"]
+
+
+def random_text(rng: random.Random) -> str:
+    target = rng.randint(1, 80)
+    text = ""
+    while len(text.encode("utf-8")) < target:
+        text += rng.choice(WORDS) + " "
+    if rng.random() < 0.1:
+        text = "  " + text + "\t"  # Blancs à retirer par le nettoyage.
+    return text
+
+
+def request(args, path: str, form: dict = None) -> dict:
+    url = f"http://{args.host}{path}"
+    data = urllib.parse.urlencode(form).encode("utf-8") if form is not None else None
+    headers = {"X-StageCue-Token": args.token} if args.token else {}
+    with urllib.request.urlopen(urllib.request.Request(url, data=data, headers=headers), timeout=5) as response:
+        return json.loads(response.read().decode("utf-8"))
+
+
+def sample(args, count: int, started: float) -> dict:
+    health = request(args, "/api/health")
+    free, largest = health.get("heapFree", 0), health.get("heapLargestBlock", 0)
+    ratio = largest / free if free else 0.0
+    print(f"{count:8d} {time.monotonic() - started:8.1f} {free:10d} {health.get('heapMinFree', 0):10d} "
+          f"{largest:10d} {ratio:8.1%}")
+    return health
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", required=True)
+    parser.add_argument("--token", default="")
+    parser.add_argument("--triggers", type=int, default=10000)
+    parser.add_argument("--sample", type=int, default=500, help="déclenchements entre deux relevés")
+    parser.add_argument("--cues", type=int, default=3, help="nombre de cues de l'appareil")
+    parser.add_argument("--duration", type=int, default=200, help="durée d'activation (ms)")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    started = time.monotonic()
+    errors = 0
+    print(f"{'déclench.':>8} {'s':>8} {'libre':>10} {'min libre':>10} {'plus grand':>10} {'bloc/libre':>8}")
+    first = sample(args, 0, started)
+    last = first
+    for count in range(1, args.triggers + 1):
+        form = {"cue": rng.randrange(args.cues), "text": random_text(rng), "duration": args.duration}
+        try:
+            request(args, "/api/cues/trigger", form)
+        except (urllib.error.URLError, TimeoutError) as error:
+            errors += 1
+            print(f"erreur au déclenchement {count} : {error}", file=sys.stderr)
+        if count % args.sample == 0 or count == args.triggers:
+            last = sample(args, count, started)
+
+    print(f"\n{args.triggers} déclenchements, {errors} erreurs")
+    print(f"plus grand bloc : {first.get('heapLargestBlock', 0)} → {last.get('heapLargestBlock', 0)} octets ; "
+          f"libre : {first.get('heapFree', 0)} → {last.get('heapFree', 0)} octets ; "
+          f"minimum libre : {last.get('heapMinFree', 0)} octets")
+
+
+if __name__ == "__main__":
+    main()
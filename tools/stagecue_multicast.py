@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""Émet (ou écoute) les datagrammes multicast de déclenchement StageCue.
+
+Un seul datagramme pilote toutes les positions de scène d'un groupe d'appareils, quel que soit
+leur nombre ; il est répété pour résister aux pertes, les copies étant écartées par les
+appareils grâce au numéro de séquence. Le format est décrit dans multicast_protocol.h.
+
+Usage : python3 tools/stagecue_multicast.py send --go 1 --go 4:2500 --text 2="Entrée côté cour"
+        python3 tools/stagecue_multicast.py listen
+
+Essai local sous Linux (boucle locale) : lancer `listen --interface 127.0.0.1` dans un terminal,
+puis `send --interface 127.0.0.1 ...` dans un autre.
+"""
+
+import argparse
+import random
+import socket
+import struct
+import sys
+import time
+
+MAGIC = b"SCM"
+VERSION = 1
+HEADER = struct.Struct("<3sBHBBII")
+ENTRY = struct.Struct("<HBIB")
+
+ACTION_TRIGGER = 0x01
+ACTION_SET_TEXT = 0x02
+ACTION_PERSIST = 0x04
+
+DEFAULT_ADDRESS = "239.255.42.42"
+DEFAULT_PORT = 4210
+MAX_DATAGRAM = 1472  # Charge utile UDP d'une trame Ethernet sans fragmentation.
+
+
+def encode_packet(group: int, sender: int, sequence: int, entries: list) -> bytes:
+    if len(entries) > 0xFF:
+        raise ValueError("255 entrées au plus par datagramme")
+    parts = [HEADER.pack(MAGIC, VERSION, group, 0, len(entries), sender, sequence)]
+    for position, actions, duration_ms, text in entries:
+        payload = text.encode("utf-8")
+        if len(payload) > 0xFF:
+            raise ValueError(f"texte trop long pour la position {position}")
+        parts.append(ENTRY.pack(position, actions, duration_ms, len(payload)))
+        parts.append(payload)
+    packet = b"".join(parts)
+    if len(packet) > MAX_DATAGRAM:
+        raise ValueError(f"datagramme de {len(packet)} octets : scinder les entrées")
+    return packet
+
+
+def decode_packet(data: bytes):
+    if len(data) < HEADER.size:
+        raise ValueError("datagramme tronqué")
+    magic, version, group, _, count, sender, sequence = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("en-tête inconnu")
+    offset = HEADER.size
+    entries = []
+    for _ in range(count):
+        if len(data) - offset < ENTRY.size:
+            raise ValueError("entrée tronquée")
+        position, actions, duration_ms, length = ENTRY.unpack_from(data, offset)
+        offset += ENTRY.size
+        if len(data) - offset < length:
+            raise ValueError("texte tronqué")
+        text = data[offset:offset + length].decode("utf-8", errors="replace")
+        offset += length
+        entries.append((position, actions, duration_ms, text))
+    if offset != len(data):
+        raise ValueError("octets excédentaires")
+    return group, sender, sequence, entries
+
+
+def parse_go(value: str):
+    position, _, duration = value.partition(":")
+    return int(position), ACTION_TRIGGER, int(duration or 0), ""
+
+
+def parse_text(value: str):
+    position, separator, text = value.partition("=")
+    if not separator:
+        raise argparse.ArgumentTypeError("format attendu : POSITION=TEXTE")
+    return int(position), ACTION_SET_TEXT, 0, text
+
+
+def merge_entries(go: list, texts: list, persist: bool) -> list:
+    # Une entrée par position : le texte est appliqué avant le déclenchement.
+    merged = {}
+    for position, actions, duration_ms, text in texts + go:
+        current = merged.setdefault(position, [0, 0, ""])
+        current[0] |= actions
+        if actions & ACTION_SET_TEXT:
+            current[2] = text
+            if persist:
+                current[0] |= ACTION_PERSIST
+        if actions & ACTION_TRIGGER:
+            current[1] = duration_ms
+    return [(position, a, d, t) for position, (a, d, t) in sorted(merged.items())]
+
+
+def send(args) -> None:
+    entries = merge_entries(args.go, args.text, args.persist)
+    if not entries:
+        sys.exit("rien à envoyer : utiliser --go et/ou --text")
+    sender = args.sender if args.sender is not None else random.getrandbits(32)
+    # Horloge en ms : les séquences restent croissantes d'une exécution à l'autre.
+    sequence = int(time.time() * 1000) & 0xFFFFFFFF
+    packet = encode_packet(args.group, sender, sequence, entries)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, args.ttl)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+    if args.interface:
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(args.interface))
+    for copy in range(args.repeat):
+        if copy > 0:
+            time.sleep(args.interval_ms / 1000)
+        sock.sendto(packet, (args.address, args.port))
+    sock.close()
+    print(f"{len(entries)} position(s), {len(packet)} octets, séquence {sequence}, émetteur {sender:#010x}, "
+          f"{args.repeat} envoi(s) vers {args.address}:{args.port}")
+
+
+def listen(args) -> None:
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", args.port))
+    membership = socket.inet_aton(args.address) + socket.inet_aton(args.interface or "0.0.0.0")
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, membership)
+    print(f"Écoute de {args.address}:{args.port} (Ctrl+C pour quitter)")
+
+    last_sequences = {}
+    while True:
+        data, origin = sock.recvfrom(2048)
+        try:
+            group, sender, sequence, entries = decode_packet(data)
+        except ValueError as error:
+            print(f"{origin[0]} : datagramme invalide ({error})")
+            continue
+        last = last_sequences.get(sender)
+        # Même règle que l'appareil : séquences comparées modulo 2^32.
+        if last is not None and not 0 < (sequence - last) & 0xFFFFFFFF < 0x80000000:
+            print(f"{origin[0]} : copie écartée (émetteur {sender:#010x}, séquence {sequence})")
+            continue
+        last_sequences[sender] = sequence
+        print(f"{origin[0]} : groupe {group}, émetteur {sender:#010x}, séquence {sequence}")
+        for position, actions, duration_ms, text in entries:
+            flags = [name for bit, name in ((ACTION_TRIGGER, "go"), (ACTION_SET_TEXT, "texte"),
+                                            (ACTION_PERSIST, "persistant")) if actions & bit]
+            details = f" durée {duration_ms} ms" if duration_ms else ""
+            print(f"  position {position}: {', '.join(flags)}{details}{f' « {text} »' if text else ''}")
+
+
+def main():
+    network = argparse.ArgumentParser(add_help=False)
+    network.add_argument("--address", default=DEFAULT_ADDRESS)
+    network.add_argument("--port", type=int, default=DEFAULT_PORT)
+    network.add_argument("--interface", help="adresse IPv4 de l'interface à utiliser (ex. 127.0.0.1)")
+
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    send_parser = commands.add_parser("send", parents=[network], help="émet un datagramme de déclenchement")
+    send_parser.add_argument("--group", type=int, default=0, help="groupe visé (0 = tous les appareils)")
+    send_parser.add_argument("--go", type=parse_go, action="append", default=[], metavar="POSITION[:DURÉE_MS]")
+    send_parser.add_argument("--text", type=parse_text, action="append", default=[], metavar="POSITION=TEXTE")
+    send_parser.add_argument("--persist", action="store_true", help="enregistre les textes en mémoire non volatile")
+    send_parser.add_argument("--repeat", type=int, default=3, help="nombre d'envois du même datagramme")
+    send_parser.add_argument("--interval-ms", type=float, default=5.0, help="délai entre deux envois")
+    send_parser.add_argument("--ttl", type=int, default=1)
+    send_parser.add_argument("--sender", type=lambda v: int(v, 0), help="identifiant d'émetteur (aléatoire par défaut)")
+    send_parser.set_defaults(handler=send)
+
+    listen_parser = commands.add_parser("listen", parents=[network], help="affiche les datagrammes reçus")
+    listen_parser.set_defaults(handler=listen)
+
+    args = parser.parse_args()
+    try:
+        args.handler(args)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
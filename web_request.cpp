@@ -0,0 +1,65 @@
+#include "web_request.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+
+bool authTokenMatches(const String &token) {
+  if (strlen(API_AUTH_TOKEN) == 0) {
+    return true;
+  }
+  return token == API_AUTH_TOKEN;
+}
+
+bool isAuthorized(AsyncWebServerRequest *request) {
+  if (strlen(API_AUTH_TOKEN) == 0) {
+    return true;
+  }
+
+  if (request->hasHeader("X-StageCue-Token")) {
+    const auto header = request->getHeader("X-StageCue-Token");
+    if (authTokenMatches(header->value())) {
+      return true;
+    }
+  }
+
+  if (request->hasHeader("Authorization")) {
+    const auto header = request->getHeader("Authorization");
+    String value = header->value();
+    value.trim();
+    if (value.startsWith("Bearer ")) {
+      String token = value.substring(7);
+      token.trim();
+      if (authTokenMatches(token)) {
+        return true;
+      }
+    }
+  }
+
+  if (request->hasParam("token")) {
+    if (authTokenMatches(request->getParam("token")->value())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+String urlDecode(const String &text) {
+  String decoded;
+  decoded.reserve(text.length());
+  for (size_t i = 0; i < text.length(); ++i) {
+    char c = text[i];
+    if (c == '+') {
+      decoded += ' ';
+    } else if (c == '%' && i + 2 < text.length()) {
+      char hex[3] = {text[i + 1], text[i + 2], '\0'};
+      decoded += static_cast<char>(strtoul(hex, nullptr, 16));
+      i += 2;
+    } else {
+      decoded += c;
+    }
+  }
+  return decoded;
+}
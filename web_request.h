@@ -0,0 +1,15 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// Lecture des requêtes HTTP sans état : contrôle du jeton d'API et décodage des formulaires.
+// Séparé de web_server.cpp pour être mesuré sur l'hôte (tests/bench_hot_paths.cpp).
+
+// Jeton comparé à API_AUTH_TOKEN (toujours vrai si aucun jeton n'est configuré).
+bool authTokenMatches(const String &token);
+// Jeton lu dans l'en-tête X-StageCue-Token, un en-tête "Authorization: Bearer" ou le paramètre
+// `token`.
+bool isAuthorized(AsyncWebServerRequest *request);
+// Décode un champ application/x-www-form-urlencoded ('+' et séquences %XX).
+String urlDecode(const String &text);
@@ -24,10 +24,28 @@
 #include <WiFi.h>
 #include <esp_system.h>
 
+#include <atomic>
+#include <memory>
+#include <new>
+
 #include "config.h"
+#include "asset_cache.h"
+#include "binary_protocol.h"
+#include "clock_offset.h"
+#include "cue_list.h"
+#include "cue_persistence.h"
+#include "cue_timers.h"
 #include "cues.h"
 #include "display_manager.h"
+#include "embedded_assets.h"
+#include "latency_metrics.h"
+#include "web_request.h"
 #include "wifi_portal.h"
+#include "wifi_scan.h"
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#endif
 
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
@@ -36,6 +54,7 @@ namespace {
 
 bool fsMounted = false;
 fs::FS *activeFs = nullptr;
+bool embeddedUiAvailable = false;
 
 bool mountFileSystem() {
   if (fsMounted) {
@@ -49,14 +68,6 @@ bool mountFileSystem() {
     Serial.println("[FS] ✅ LittleFS monté");
     return true;
   }
-
-  Serial.println("[FS] ⚠️ Échec de montage de LittleFS, tentative de formatage...");
-  if (LittleFS.format() && LittleFS.begin(false)) {
-    activeFs = &LittleFS;
-    fsMounted = true;
-    Serial.println("[FS] ✅ LittleFS formaté et monté");
-    return true;
-  }
 #endif
 
 #if STAGECUE_HAS_SPIFFS
@@ -67,59 +78,117 @@ bool mountFileSystem() {
     Serial.println("[FS] ✅ SPIFFS monté");
     return true;
   }
-
-  Serial.println("[FS] ⚠️ Échec de montage de SPIFFS, tentative de formatage...");
-  if (SPIFFS.format() && SPIFFS.begin(false)) {
-    activeFs = &SPIFFS;
-    fsMounted = true;
-    Serial.println("[FS] ✅ SPIFFS formaté et monté");
-    return true;
-  }
 #endif
 
-  Serial.println("[FS] ❌ Aucun système de fichiers disponible");
+  // Pas de formatage : le firmware n'écrit jamais sur le système de fichiers, qui ne sert qu'à
+  // remplacer l'interface embarquée. Un formatage retarderait le démarrage sans rien apporter.
+  Serial.println("[FS] ℹ️ Aucun système de fichiers monté, interface embarquée uniquement");
   return false;
 }
 
-bool authTokenMatches(const String &token) {
-  if (strlen(API_AUTH_TOKEN) == 0) {
-    return true;
+// Interface produite par tools/build_assets.py : chaque fichier n'existe qu'en variante .gz,
+// décrite par une ligne du manifeste (chemin, empreinte, immuable, type MIME).
+constexpr const char *kAssetManifestPath = "/assets.manifest";
+constexpr size_t kMaxCompressedAssets = 16;
+
+CompressedAsset compressedAssets[kMaxCompressedAssets];
+size_t compressedAssetCount = 0;
+
+void loadAssetManifest() {
+  compressedAssetCount = 0;
+  File manifest = activeFs->open(kAssetManifestPath, "r");
+  if (!manifest) {
+    return;
+  }
+  while (manifest.available() && compressedAssetCount < kMaxCompressedAssets) {
+    if (parseAssetManifestLine(manifest.readStringUntil('\n'), compressedAssets[compressedAssetCount])) {
+      ++compressedAssetCount;
+    }
   }
-  return token == API_AUTH_TOKEN;
+  manifest.close();
+  Serial.printf("[Web] 🗜️ %u fichiers compressés référencés par le manifeste\n",
+                static_cast<unsigned>(compressedAssetCount));
 }
 
-bool isAuthorized(AsyncWebServerRequest *request) {
-  if (strlen(API_AUTH_TOKEN) == 0) {
-    return true;
+const CompressedAsset *findCompressedAsset(const char *path) {
+  for (size_t i = 0; i < compressedAssetCount; ++i) {
+    if (compressedAssets[i].path == path) {
+      return &compressedAssets[i];
+    }
   }
+  return nullptr;
+}
 
-  if (request->hasHeader("X-StageCue-Token")) {
-    const auto header = request->getHeader("X-StageCue-Token");
-    if (authTokenMatches(header->value())) {
-      return true;
-    }
+// Corps gzip, ou 304 si le client a déjà cette version (politique de cache : asset_cache.h).
+template <typename MakeBody>
+void sendGzipAsset(AsyncWebServerRequest *request, const String &etag, bool immutable, MakeBody makeBody) {
+  const char *ifNoneMatch =
+      request->hasHeader("If-None-Match") ? request->getHeader("If-None-Match")->value().c_str() : nullptr;
+  const AssetCacheDecision cache = decideAssetCache(ifNoneMatch, etag.c_str(), immutable);
+  AsyncWebServerResponse *response = nullptr;
+  if (cache.notModified) {
+    response = request->beginResponse(304);
+  } else {
+    response = makeBody();
+    response->addHeader("Content-Encoding", "gzip");
   }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cache.cacheControl);
+  request->send(response);
+}
 
-  if (request->hasHeader("Authorization")) {
-    const auto header = request->getHeader("Authorization");
-    String value = header->value();
-    value.trim();
-    if (value.startsWith("Bearer ")) {
-      String token = value.substring(7);
-      token.trim();
-      if (authTokenMatches(token)) {
-        return true;
-      }
-    }
+void serveCompressedAsset(const char *route, const CompressedAsset &asset) {
+  server.on(route, HTTP_GET, [&asset](AsyncWebServerRequest *request) {
+    sendGzipAsset(request, asset.etag, asset.immutable,
+                  [&]() { return request->beginResponse(*activeFs, asset.path + ".gz", asset.contentType); });
+  });
+}
+
+// Lecture directe depuis la flash du firmware, sans système de fichiers ni copie intermédiaire.
+void serveEmbeddedAsset(const char *route, const EmbeddedAsset &asset) {
+  server.on(route, HTTP_GET, [&asset](AsyncWebServerRequest *request) {
+    sendGzipAsset(request, asset.etag, asset.immutable, [&]() {
+      return request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+    });
+  });
+}
+
+// Un fichier présent sur le système de fichiers (brut ou via le manifeste) remplace la version embarquée.
+bool isOverriddenByFileSystem(const char *path) {
+  if (!fsMounted || activeFs == nullptr) {
+    return false;
   }
+  return findCompressedAsset(path) != nullptr || activeFs->exists(path);
+}
 
-  if (request->hasParam("token")) {
-    if (authTokenMatches(request->getParam("token")->value())) {
-      return true;
+size_t registerEmbeddedAssets() {
+  size_t registered = 0;
+  for (size_t i = 0; i < embeddedAssetCount; ++i) {
+    const EmbeddedAsset &asset = embeddedAssets[i];
+    if (isOverriddenByFileSystem(asset.path)) {
+      continue;
+    }
+    serveEmbeddedAsset(asset.path, asset);
+    if (strcmp(asset.path, "/index.html") == 0) {
+      serveEmbeddedAsset("/", asset);
+    } else if (strcmp(asset.path, "/wifi.html") == 0) {
+      serveEmbeddedAsset("/wifi", asset);
     }
+    ++registered;
   }
+  return registered;
+}
 
-  return false;
+void registerCompressedAssets() {
+  for (size_t i = 0; i < compressedAssetCount; ++i) {
+    serveCompressedAsset(compressedAssets[i].path.c_str(), compressedAssets[i]);
+  }
+  if (const CompressedAsset *index = findCompressedAsset("/index.html")) {
+    serveCompressedAsset("/", *index);
+  }
+  if (const CompressedAsset *wifi = findCompressedAsset("/wifi.html")) {
+    serveCompressedAsset("/wifi", *wifi);
+  }
 }
 
 void sendUnauthorized(AsyncWebServerRequest *request) {
@@ -134,14 +203,8 @@ bool requireAuth(AsyncWebServerRequest *request) {
   return false;
 }
 
-String urlDecode(const String &text);
-
-bool validateWebSocketClient(AsyncWebSocketClient *client) {
-  if (strlen(API_AUTH_TOKEN) == 0) {
-    return true;
-  }
-
-  String url = client->url();
+// Recherche un paramètre dans la chaîne de requête d'une URL (valeur décodée).
+bool findQueryParam(const String &url, const char *name, String &value) {
   int queryIndex = url.indexOf('?');
   if (queryIndex < 0) {
     return false;
@@ -154,10 +217,11 @@ bool validateWebSocketClient(AsyncWebSocketClient *client) {
     int eq = pair.indexOf('=');
     if (eq >= 0) {
       String key = pair.substring(0, eq);
-      String value = pair.substring(eq + 1);
       key.trim();
-      value.trim();
-      if (key == "token" && authTokenMatches(urlDecode(value))) {
+      if (key == name) {
+        value = pair.substring(eq + 1);
+        value.trim();
+        value = urlDecode(value);
         return true;
       }
     }
@@ -170,22 +234,395 @@ bool validateWebSocketClient(AsyncWebSocketClient *client) {
   return false;
 }
 
-String urlDecode(const String &text) {
-  String decoded;
-  decoded.reserve(text.length());
-  for (size_t i = 0; i < text.length(); ++i) {
-    char c = text[i];
-    if (c == '+') {
-      decoded += ' ';
-    } else if (c == '%' && i + 2 < text.length()) {
-      char hex[3] = {text[i + 1], text[i + 2], '\0'};
-      decoded += static_cast<char>(strtoul(hex, nullptr, 16));
-      i += 2;
+bool validateWebSocketClient(AsyncWebSocketClient *client) {
+  if (strlen(API_AUTH_TOKEN) == 0) {
+    return true;
+  }
+
+  String token;
+  return findQueryParam(client->url(), "token", token) && authTokenMatches(token);
+}
+
+// Version connue du client (?since=<version>&epoch=<époque>) pour une resynchronisation différentielle.
+struct SyncPoint {
+  bool present = false;
+  uint32_t epoch = 0;
+  uint32_t version = 0;
+};
+
+SyncPoint parseSyncPoint(const String &since, const String &epoch) {
+  SyncPoint point;
+  if (since.isEmpty() || epoch.isEmpty()) {
+    return point;
+  }
+  point.present = true;
+  point.version = strtoul(since.c_str(), nullptr, 10);
+  point.epoch = strtoul(epoch.c_str(), nullptr, 10);
+  return point;
+}
+
+SyncPoint webSocketSyncPoint(AsyncWebSocketClient *client) {
+  String since;
+  String epoch;
+  const String url = client->url();
+  findQueryParam(url, "since", since);
+  findQueryParam(url, "epoch", epoch);
+  return parseSyncPoint(since, epoch);
+}
+
+SyncPoint requestSyncPoint(AsyncWebServerRequest *request) {
+  if (!request->hasParam("since") || !request->hasParam("epoch")) {
+    return SyncPoint();
+  }
+  return parseSyncPoint(request->getParam("since")->value(), request->getParam("epoch")->value());
+}
+
+WsProtocol negotiateWebSocketProtocol(AsyncWebSocketClient *client) {
+  String proto;
+  if (findQueryParam(client->url(), "proto", proto) && proto == "bin") {
+    return WsProtocol::Binary;
+  }
+  return WsProtocol::Json;
+}
+
+// Table des clients, écrite par la tâche AsyncTCP (connexion, déconnexion) sous wsClientsLock et
+// lue par loop() sous le même verrou. La comptabilité de file vit à part, dans wsQueues.
+struct WsClientSlot {
+  uint32_t id = 0;  // 0 = emplacement libre (AsyncWebSocket numérote à partir de 1).
+  WsProtocol protocol = WsProtocol::Json;
+  uint32_t generation = 0;  // Nouvelle à chaque connexion : loop() repère un emplacement réattribué.
+  // Horloge du contrôleur, estimée par les échanges clockProbe / clockEcho (tâche AsyncTCP uniquement).
+  ClockOffsetEstimator<CLOCK_SYNC_WINDOW> clock{CLOCK_SYNC_MAX_ROUND_TRIP_US, CLOCK_SYNC_DRIFT_PPM};
+};
+
+WsClientSlot wsClients[WS_MAX_CLIENTS];
+uint32_t nextWsGeneration = 1;
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE wsClientsLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockWsClients() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&wsClientsLock);
+#endif
+}
+
+void unlockWsClients() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&wsClientsLock);
+#endif
+}
+
+// Identité d'un emplacement, copiée sous le verrou (generation 0 = libre).
+struct WsClientRef {
+  uint32_t id = 0;
+  WsProtocol protocol = WsProtocol::Json;
+  uint32_t generation = 0;
+};
+
+WsClientRef wsClientRef(size_t index) {
+  lockWsClients();
+  const WsClientRef ref{wsClients[index].id, wsClients[index].protocol, wsClients[index].generation};
+  unlockWsClients();
+  return ref;
+}
+
+// Tâche AsyncTCP uniquement (seule à modifier la table) : lecture sans verrou.
+WsClientSlot *findWsClient(uint32_t id) {
+  for (auto &slot : wsClients) {
+    if (slot.id == id) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+bool registerWsClient(uint32_t id, WsProtocol protocol) {
+  WsClientSlot *slot = findWsClient(0);
+  if (slot == nullptr) {
+    return false;
+  }
+  // Horloge remise à zéro avant publication : loop() ne la lit jamais.
+  slot->clock = ClockOffsetEstimator<CLOCK_SYNC_WINDOW>(CLOCK_SYNC_MAX_ROUND_TRIP_US, CLOCK_SYNC_DRIFT_PPM);
+  lockWsClients();
+  slot->id = id;
+  slot->protocol = protocol;
+  slot->generation = nextWsGeneration++;
+  if (nextWsGeneration == 0) {
+    nextWsGeneration = 1;
+  }
+  unlockWsClients();
+  return true;
+}
+
+void unregisterWsClient(uint32_t id) {
+  WsClientSlot *slot = findWsClient(id);
+  if (slot == nullptr) {
+    return;
+  }
+  lockWsClients();
+  slot->id = 0;
+  slot->generation = 0;
+  unlockWsClients();
+}
+
+// Contre-pression, par emplacement (loop() uniquement) : tailles des diffusions encore dans la
+// file de la bibliothèque, de la plus ancienne à la plus récente (la file se vide dans l'ordre).
+// Remise à zéro dès que la génération de l'emplacement change : un client qui réutilise un
+// emplacement n'hérite jamais de la file de son prédécesseur.
+struct WsQueueState {
+  // Atomiques : relus par /api/metrics depuis la tâche AsyncTCP.
+  std::atomic<uint32_t> generation{0};
+  std::atomic<uint32_t> queuedBytes{0};
+  uint16_t queuedSizes[WS_CLIENT_HARD_QUEUE_DEPTH] = {};
+  size_t queuedHead = 0;
+  size_t queuedCount = 0;
+  bool stale = false;  // Trames d'état retenues : delta à envoyer depuis staleSince.
+  uint32_t staleSince = 0;
+  bool overBudget = false;
+  uint32_t overBudgetSinceMs = 0;
+  bool closing = false;
+
+  void reset(uint32_t newGeneration) {
+    queuedBytes.store(0, std::memory_order_relaxed);
+    queuedHead = 0;
+    queuedCount = 0;
+    stale = false;
+    staleSince = 0;
+    overBudget = false;
+    overBudgetSinceMs = 0;
+    closing = false;
+    generation.store(newGeneration, std::memory_order_relaxed);
+  }
+};
+
+WsQueueState wsQueues[WS_MAX_CLIENTS];
+
+WsQueueState &wsQueueFor(size_t index, uint32_t generation) {
+  WsQueueState &queue = wsQueues[index];
+  if (queue.generation.load(std::memory_order_relaxed) != generation) {
+    queue.reset(generation);
+  }
+  return queue;
+}
+
+// Compteurs exposés par /api/metrics (écrits depuis loop()).
+std::atomic<uint32_t> wsCollapsedFrames{0};
+std::atomic<uint32_t> wsDroppedMessages{0};
+std::atomic<uint32_t> wsResyncs{0};
+std::atomic<uint32_t> wsStalledDisconnects{0};
+uint32_t lastClientCleanupMs = 0;
+
+enum class WsPressure : uint8_t { Healthy, Congested, OverBudget };
+
+// Retire de la comptabilité les diffusions déjà parties : la bibliothèque ne rend que la
+// profondeur de sa file, qui inclut aussi les réponses directes (non comptées en octets).
+size_t observeQueue(WsQueueState &queue, AsyncWebSocketClient *client) {
+  const size_t depth = client->queueLen();
+  while (queue.queuedCount > depth) {
+    queue.queuedBytes.fetch_sub(queue.queuedSizes[queue.queuedHead], std::memory_order_relaxed);
+    queue.queuedHead = (queue.queuedHead + 1) % WS_CLIENT_HARD_QUEUE_DEPTH;
+    --queue.queuedCount;
+  }
+  return depth;
+}
+
+void recordQueued(WsQueueState &queue, size_t length) {
+  if (queue.queuedCount == WS_CLIENT_HARD_QUEUE_DEPTH) {
+    queue.queuedBytes.fetch_sub(queue.queuedSizes[queue.queuedHead], std::memory_order_relaxed);
+    queue.queuedHead = (queue.queuedHead + 1) % WS_CLIENT_HARD_QUEUE_DEPTH;
+    --queue.queuedCount;
+  }
+  const uint16_t size = static_cast<uint16_t>(length < 0xFFFF ? length : 0xFFFF);
+  queue.queuedSizes[(queue.queuedHead + queue.queuedCount) % WS_CLIENT_HARD_QUEUE_DEPTH] = size;
+  ++queue.queuedCount;
+  queue.queuedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+WsPressure assessPressure(WsQueueState &queue, size_t depth, uint32_t nowMs) {
+  const uint32_t bytes = queue.queuedBytes.load(std::memory_order_relaxed);
+  if (depth >= WS_CLIENT_HARD_QUEUE_DEPTH || bytes >= WS_CLIENT_HARD_QUEUE_BYTES) {
+    if (!queue.overBudget) {
+      queue.overBudget = true;
+      queue.overBudgetSinceMs = nowMs;
+    }
+    return WsPressure::OverBudget;
+  }
+  queue.overBudget = false;
+  if (depth >= WS_CLIENT_SOFT_QUEUE_DEPTH || bytes >= WS_CLIENT_SOFT_QUEUE_BYTES) {
+    return WsPressure::Congested;
+  }
+  return WsPressure::Healthy;
+}
+
+// Remplace toutes les trames d'état retenues par un seul delta (ou un snapshot si le journal ne
+// remonte plus jusqu'à staleSince) : seul le dernier état de chaque cue est envoyé.
+void sendResync(WsProtocol protocol, WsQueueState &queue, AsyncWebSocketClient *client) {
+  size_t length = 0;
+  if (protocol == WsProtocol::Binary) {
+    std::unique_ptr<uint8_t[]> frame(new (std::nothrow) uint8_t[CUE_SNAPSHOT_FRAME_CAPACITY]);
+    if (!frame) {
+      return;
+    }
+    length = buildCueDeltaFrame(cueStateEpoch(), queue.staleSince, frame.get(), CUE_SNAPSHOT_FRAME_CAPACITY);
+    client->binary(frame.get(), length);
+  } else {
+    const String payload = buildCueDeltaJson(cueStateEpoch(), queue.staleSince);
+    length = payload.length();
+    client->text(payload);
+  }
+  recordQueued(queue, length);
+  queue.stale = false;
+  wsResyncs.fetch_add(1, std::memory_order_relaxed);
+}
+
+// `stateVersion` : version du journal pour une trame d'état fusionnable, 0 pour les autres messages.
+void deliverToWebSocketClients(WsProtocol protocol, AsyncWebSocketMessageBuffer *buffer, uint32_t stateVersion) {
+  if (buffer == nullptr) {
+    return;
+  }
+
+  const uint32_t nowMs = millis();
+  buffer->lock();
+  for (size_t i = 0; i < WS_MAX_CLIENTS; ++i) {
+    const WsClientRef ref = wsClientRef(i);
+    if (ref.id == 0 || ref.protocol != protocol) {
+      continue;
+    }
+    WsQueueState &queue = wsQueueFor(i, ref.generation);
+    if (queue.closing) {
+      continue;
+    }
+    AsyncWebSocketClient *client = ws.client(ref.id);
+    if (client == nullptr || client->status() != WS_CONNECTED) {
+      continue;
+    }
+    const WsPressure pressure = assessPressure(queue, observeQueue(queue, client), nowMs);
+    if (stateVersion != 0) {
+      if (queue.stale || pressure != WsPressure::Healthy) {
+        if (!queue.stale) {
+          // Le client a reçu toutes les trames jusqu'à la précédente.
+          queue.stale = true;
+          queue.staleSince = stateVersion - 1;
+        }
+        if (pressure == WsPressure::Healthy) {
+          sendResync(protocol, queue, client);  // Le delta inclut déjà cette version.
+        } else {
+          wsCollapsedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        continue;
+      }
+    } else if (pressure == WsPressure::OverBudget) {
+      wsDroppedMessages.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    if (protocol == WsProtocol::Binary) {
+      client->binary(buffer);
     } else {
-      decoded += c;
+      client->text(buffer);
+    }
+    recordQueued(queue, buffer->length());
+  }
+  buffer->unlock();
+  ws._cleanBuffers();
+}
+
+void appendMetric(String &out, const char *name, const char *type, const char *help, uint32_t value) {
+  out += F("# HELP ");
+  out += name;
+  out += ' ';
+  out += help;
+  out += F("\n# TYPE ");
+  out += name;
+  out += ' ';
+  out += type;
+  out += '\n';
+  out += name;
+  out += ' ';
+  out += value;
+  out += '\n';
+}
+
+// Profondeur et octets en file par client, puis compteurs de contre-pression (format Prometheus).
+String buildWebSocketMetrics() {
+  String out;
+  out.reserve(WS_MAX_CLIENTS * 110 + 1024);
+  out += F("# HELP stagecue_ws_client_queue_messages Messages en file pour chaque client WebSocket.\n");
+  out += F("# TYPE stagecue_ws_client_queue_messages gauge\n");
+  String bytes;
+  bytes.reserve(WS_MAX_CLIENTS * 50 + 128);
+  bytes += F("# HELP stagecue_ws_client_queue_bytes Octets diffusés encore en file pour chaque client WebSocket.\n");
+  bytes += F("# TYPE stagecue_ws_client_queue_bytes gauge\n");
+  for (size_t i = 0; i < WS_MAX_CLIENTS; ++i) {
+    const WsClientRef ref = wsClientRef(i);
+    if (ref.id == 0) {
+      continue;
     }
+    AsyncWebSocketClient *client = ws.client(ref.id);
+    if (client == nullptr) {
+      continue;
+    }
+    // Comptabilité pas encore rattachée à ce client par loop() : rien de diffusé pour lui.
+    const WsQueueState &queue = wsQueues[i];
+    const uint32_t queuedBytes = queue.generation.load(std::memory_order_relaxed) == ref.generation
+                                     ? queue.queuedBytes.load(std::memory_order_relaxed)
+                                     : 0;
+    char line[96];
+    snprintf(line, sizeof(line), "stagecue_ws_client_queue_messages{client=\"%lu\"} %u\n",
+             static_cast<unsigned long>(ref.id), static_cast<unsigned>(client->queueLen()));
+    out += line;
+    snprintf(line, sizeof(line), "stagecue_ws_client_queue_bytes{client=\"%lu\"} %lu\n",
+             static_cast<unsigned long>(ref.id), static_cast<unsigned long>(queuedBytes));
+    bytes += line;
+  }
+  out += bytes;
+  appendMetric(out, "stagecue_ws_collapsed_frames_total", "counter",
+               "Trames d'état remplacées par un delta pour un client en retard.", wsCollapsedFrames.load());
+  appendMetric(out, "stagecue_ws_dropped_messages_total", "counter",
+               "Diffusions écartées pour un client au-delà de son budget.", wsDroppedMessages.load());
+  appendMetric(out, "stagecue_ws_resyncs_total", "counter", "Deltas de resynchronisation envoyés.",
+               wsResyncs.load());
+  appendMetric(out, "stagecue_ws_stalled_disconnects_total", "counter",
+               "Clients déconnectés après être restés au-delà de leur budget.", wsStalledDisconnects.load());
+  return out;
+}
+
+void sendBinaryError(AsyncWebSocketClient *client, BinaryErrorCode code) {
+  uint8_t frame[BINARY_HEADER_SIZE];
+  client->binary(frame, writeBinaryError(frame, sizeof(frame), code));
+}
+
+void handleBinaryFrame(AsyncWebSocketClient *client, const uint8_t *data, size_t len, uint32_t receivedAtUs) {
+  BinaryCommand command;
+  if (!decodeBinaryCommand(data, len, command)) {
+    sendBinaryError(client, BinaryErrorCode::InvalidFrame);
+    return;
+  }
+
+  if (command.opcode == BinaryOpcode::Ping) {
+    uint8_t frame[BINARY_HEADER_SIZE];
+    client->binary(frame, writeBinaryPong(frame, sizeof(frame)));
+    return;
+  }
+
+  if (command.cue >= CUE_COUNT) {
+    sendBinaryError(client, BinaryErrorCode::InvalidCue);
+    return;
+  }
+
+  if (command.hasText()) {
+    setCueText(command.cue, command.text, command.textLength, command.persist());
+  }
+
+  if (command.opcode == BinaryOpcode::SetText) {
+    uint8_t frame[binaryCueStateSize(MAX_CUE_TEXT_LENGTH)];
+    client->binary(frame, buildCueStateFrame(command.cue, frame, sizeof(frame)));
+  } else {
+    beginTriggerTrace(command.cue, TriggerSource::WebSocket, receivedAtUs);
+    triggerCue(command.cue);
   }
-  return decoded;
 }
 
 String wifiStatusToString(wl_status_t status) {
@@ -216,6 +653,7 @@ void sendJson(AsyncWebServerRequest *request, uint16_t statusCode, const JsonDoc
 }
 
 void handleTriggerRequest(AsyncWebServerRequest *request) {
+  const uint32_t receivedAtUs = latencyTimestampUs();
   if (!request->hasParam("cue", true)) {
     request->send(400, "application/json", "{\"error\":\"missing_cue\"}");
     return;
@@ -231,10 +669,378 @@ void handleTriggerRequest(AsyncWebServerRequest *request) {
     setCueText(static_cast<size_t>(cueIndex), request->getParam("text", true)->value(), true);
   }
 
-  triggerCue(static_cast<size_t>(cueIndex));
+  uint32_t durationMs = 0;
+  if (request->hasParam("duration", true)) {
+    durationMs = strtoul(request->getParam("duration", true)->value().c_str(), nullptr, 10);
+  }
+
+  beginTriggerTrace(static_cast<size_t>(cueIndex), TriggerSource::Http, receivedAtUs);
+  triggerCue(static_cast<size_t>(cueIndex), durationMs);
   request->send(200, "application/json", buildCueStateJson(static_cast<size_t>(cueIndex)));
 }
 
+// Document des commandes reçues (WebSocket et /api/cues/batch), dimensionné pour un lot complet.
+// Tous les gestionnaires s'exécutent dans la tâche AsyncTCP : une seule instance suffit et évite
+// de réserver plusieurs kilo-octets sur sa pile à chaque message.
+constexpr size_t kCommandJsonCapacity = JSON_OBJECT_SIZE(6) + JSON_ARRAY_SIZE(CUE_BATCH_MAX_OPERATIONS) +
+                                        CUE_BATCH_MAX_OPERATIONS * JSON_OBJECT_SIZE(6);
+using CommandJsonDocument = StaticJsonDocument<kCommandJsonCapacity>;
+CommandJsonDocument commandDocument;
+
+void sendWsError(AsyncWebSocketClient *client, const char *message) {
+  StaticJsonDocument<JSON_OBJECT_SIZE(2)> errorDoc;
+  errorDoc["type"] = "error";
+  errorDoc["message"] = message;
+  String response;
+  serializeJson(errorDoc, response);
+  client->text(response);
+}
+
+// Valide toutes les opérations avant d'en appliquer une seule : un lot invalide n'a aucun effet.
+// Chaque opération reprend le format d'un message WebSocket ("trigger" par défaut, ou "setText").
+const char *parseCueBatch(JsonArrayConst list, CueOperation *operations, size_t &count) {
+  if (list.isNull() || list.size() == 0) {
+    return "missing_operations";
+  }
+  if (list.size() > CUE_BATCH_MAX_OPERATIONS) {
+    return "too_many_operations";
+  }
+
+  count = 0;
+  for (JsonObjectConst entry : list) {
+    const char *type = entry["type"] | "trigger";
+    const bool trigger = strcmp(type, "trigger") == 0;
+    if (!trigger && strcmp(type, "setText") != 0) {
+      return "invalid_operation";
+    }
+
+    JsonVariantConst cue = entry.containsKey("cue") ? entry["cue"] : entry["index"];
+    if (!cue.is<int>() || cue.as<int>() < 0 || static_cast<size_t>(cue.as<int>()) >= CUE_COUNT) {
+      return "invalid_cue";
+    }
+
+    CueOperation &operation = operations[count++];
+    operation.index = static_cast<size_t>(cue.as<int>());
+    operation.text = entry["text"].as<const char *>();
+    operation.textLength = operation.text != nullptr ? strlen(operation.text) : 0;
+    operation.persist = entry["persist"] | true;
+    operation.trigger = trigger;
+    operation.durationMs = entry["duration"] | 0U;
+  }
+  return nullptr;
+}
+
+// Retourne nullptr si le lot a été appliqué, sinon le code d'erreur.
+const char *runCueBatch(JsonVariantConst root, TriggerSource source, uint32_t receivedAtUs, size_t &applied) {
+  CueOperation operations[CUE_BATCH_MAX_OPERATIONS];
+  const char *error = parseCueBatch(root["ops"], operations, applied);
+  if (error != nullptr) {
+    return error;
+  }
+
+  for (size_t i = 0; i < applied; ++i) {
+    if (operations[i].trigger) {
+      beginTriggerTrace(operations[i].index, source, receivedAtUs);
+    }
+  }
+  applyCueBatch(operations, applied);
+  return nullptr;
+}
+
+// Le corps JSON est accumulé dans _tempObject (libéré par AsyncWebServerRequest).
+template <size_t MaxSize>
+void collectRequestBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+  if (total > MaxSize) {
+    return;
+  }
+  if (index == 0) {
+    request->_tempObject = malloc(total);
+  }
+  if (request->_tempObject != nullptr && index + len <= total) {
+    memcpy(static_cast<uint8_t *>(request->_tempObject) + index, data, len);
+  }
+}
+
+void handleBatchRequest(AsyncWebServerRequest *request) {
+  const uint32_t receivedAtUs = latencyTimestampUs();
+  if (request->_tempObject == nullptr) {
+    const bool tooLarge = request->contentLength() > CUE_BATCH_MAX_BODY_SIZE;
+    request->send(tooLarge ? 413 : 400, "application/json",
+                  tooLarge ? "{\"error\":\"body_too_large\"}" : "{\"error\":\"missing_body\"}");
+    return;
+  }
+
+  CommandJsonDocument &doc = commandDocument;
+  if (deserializeJson(doc, static_cast<char *>(request->_tempObject), request->contentLength())) {
+    request->send(400, "application/json", "{\"error\":\"invalid_json\"}");
+    return;
+  }
+
+  size_t applied = 0;
+  const char *error = runCueBatch(doc.as<JsonVariantConst>(), TriggerSource::Http, receivedAtUs, applied);
+  StaticJsonDocument<JSON_OBJECT_SIZE(1)> response;
+  if (error != nullptr) {
+    response["error"] = error;
+    sendJson(request, 400, response);
+    return;
+  }
+  response["applied"] = applied;
+  sendJson(request, 200, response);
+}
+
+// Compilation d'une liste de cues : document dimensionné pour la liste la plus longue, alloué sur
+// le tas le temps du téléversement seulement.
+constexpr size_t kCueListJsonCapacity =
+    JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(CUE_LIST_MAX_STEPS) + CUE_LIST_MAX_STEPS * JSON_OBJECT_SIZE(6);
+
+void handleCueListUpload(AsyncWebServerRequest *request) {
+  if (request->_tempObject == nullptr) {
+    const bool tooLarge = request->contentLength() > CUE_LIST_MAX_BODY_SIZE;
+    request->send(tooLarge ? 413 : 400, "application/json",
+                  tooLarge ? "{\"error\":\"body_too_large\"}" : "{\"error\":\"missing_body\"}");
+    return;
+  }
+
+  DynamicJsonDocument doc(kCueListJsonCapacity);
+  if (doc.capacity() == 0) {
+    request->send(503, "application/json", "{\"error\":\"out_of_memory\"}");
+    return;
+  }
+  // Entrée modifiable : les chaînes sont référencées sur place pendant la compilation.
+  if (deserializeJson(doc, static_cast<char *>(request->_tempObject), request->contentLength())) {
+    request->send(400, "application/json", "{\"error\":\"invalid_json\"}");
+    return;
+  }
+
+  const char *error = loadCueList(doc.as<JsonVariantConst>());
+  if (error != nullptr) {
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> response;
+    response["error"] = error;
+    sendJson(request, 400, response);
+    return;
+  }
+  request->send(200, "application/json", buildCueListStatusJson());
+}
+
+// Commandes de liste partagées par WebSocket et HTTP ("listGo", "listBack", "listJump", "listStop").
+const char *runCueListCommand(const String &action, JsonVariantConst step) {
+  if (action == "listGo") {
+    cueListGo();
+  } else if (action == "listBack") {
+    if (!cueListBack()) {
+      return "no_previous_step";
+    }
+  } else if (action == "listJump") {
+    if (!step.is<int>() || step.as<int>() < 0 || !cueListJump(static_cast<size_t>(step.as<int>()))) {
+      return "invalid_step";
+    }
+  } else if (action == "listStop") {
+    cueListStop();
+  } else {
+    return "invalid_command";
+  }
+  return nullptr;
+}
+
+void registerCueListCommand(const char *route, const char *action) {
+  server.on(route, HTTP_POST, [action](AsyncWebServerRequest *request) {
+    if (!requireAuth(request)) {
+      return;
+    }
+    StaticJsonDocument<JSON_OBJECT_SIZE(1)> params;
+    if (request->hasParam("step", true)) {
+      params["step"] = request->getParam("step", true)->value().toInt();
+    }
+    const char *error = runCueListCommand(action, params["step"]);
+    if (error != nullptr) {
+      StaticJsonDocument<JSON_OBJECT_SIZE(1)> response;
+      response["error"] = error;
+      sendJson(request, 400, response);
+      return;
+    }
+    request->send(200, "application/json", buildCueListStatusJson());
+  });
+}
+
+// Le balayage est asynchrone : résultats en cache s'ils sont récents, sinon 202 avec un jeton à
+// rappeler (/scan?token=N) ; la fin du balayage est aussi annoncée aux clients WebSocket.
+void handleScanRequest(AsyncWebServerRequest *request) {
+  uint32_t token = 0;
+  if (request->hasParam("token")) {
+    token = strtoul(request->getParam("token")->value().c_str(), nullptr, 10);
+  }
+
+  const std::shared_ptr<const WiFiScanResults> results = latestWiFiScan(token);
+  if (!results) {
+    token = requestWiFiScan();
+    StaticJsonDocument<JSON_OBJECT_SIZE(2)> doc;
+    doc["status"] = "scanning";
+    doc["token"] = token;
+    sendJson(request, 202, doc);
+    return;
+  }
+
+  // Écrit réseau par réseau : aucune limite imposée par la taille d'un document JSON.
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  response->print('[');
+  bool first = true;
+  for (const WiFiScanNetwork &network : results->networks) {
+    StaticJsonDocument<JSON_OBJECT_SIZE(3)> entry;
+    entry["ssid"] = network.ssid;
+    entry["rssi"] = network.rssi;
+    entry["secure"] = network.secure;
+    if (!first) {
+      response->print(',');
+    }
+    serializeJson(entry, *response);
+    first = false;
+  }
+  response->print(']');
+  response->addHeader("X-Scan-Token", String(results->token));
+  request->send(response);
+}
+
+// Synchronisation d'horloge : le contrôleur demande une sonde ("clockSync"), la renvoie aussitôt
+// avec sa propre heure en µs ("clockEcho" : t1 recopié, time), et l'appareil en déduit l'écart.
+// Répéter l'échange (une rafale au départ, puis toutes les quelques secondes) affine le filtre.
+void sendClockProbe(AsyncWebSocketClient *client) {
+  StaticJsonDocument<JSON_OBJECT_SIZE(2)> doc;
+  doc["type"] = "clockProbe";
+  doc["t1"] = cueClockUs();
+  String payload;
+  serializeJson(doc, payload);
+  client->text(payload);
+}
+
+void handleClockEcho(AsyncWebSocketClient *client, JsonVariantConst root, uint64_t receivedAtUs) {
+  WsClientSlot *slot = findWsClient(client->id());
+  if (slot == nullptr) {
+    return;
+  }
+  if (!root["t1"].is<uint64_t>() || !root["time"].is<int64_t>()) {
+    sendWsError(client, "invalid_clock_sample");
+    return;
+  }
+  if (!slot->clock.addSample(root["t1"].as<uint64_t>(), root["time"].as<int64_t>(), receivedAtUs)) {
+    sendWsError(client, "clock_sample_rejected");
+    return;
+  }
+
+  const ClockEstimate estimate = slot->clock.estimate(receivedAtUs);
+  StaticJsonDocument<JSON_OBJECT_SIZE(4)> doc;
+  doc["type"] = "clockStatus";
+  doc["offsetUs"] = estimate.offsetUs;
+  doc["uncertaintyUs"] = estimate.uncertaintyUs;
+  doc["samples"] = slot->clock.sampleCount();
+  String payload;
+  serializeJson(doc, payload);
+  client->text(payload);
+}
+
+// Déclenchement programmé en attente : client à qui rendre compte de l'écart obtenu.
+struct ScheduledTrigger {
+  uint32_t clientId = 0;  // 0 = aucun.
+  int64_t controllerAtUs = 0;
+  uint32_t uncertaintyUs = 0;
+};
+
+ScheduledTrigger scheduledTriggers[CUE_COUNT];
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE scheduledLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockScheduled() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&scheduledLock);
+#endif
+}
+
+void unlockScheduled() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&scheduledLock);
+#endif
+}
+
+// "at" est exprimé dans l'horloge du contrôleur (µs entières) et converti avec l'écart estimé
+// pour ce client ; un instant déjà passé déclenche immédiatement (l'écart rapporté le montre).
+const char *scheduleTriggerAt(AsyncWebSocketClient *client, JsonVariantConst root, size_t index) {
+  const WsClientSlot *slot = findWsClient(client->id());
+  const uint64_t now = cueClockUs();
+  const ClockEstimate estimate = slot != nullptr ? slot->clock.estimate(now) : ClockEstimate();
+  if (!estimate.valid) {
+    return "clock_not_synced";
+  }
+  if (!root["at"].is<int64_t>()) {
+    return "invalid_time";
+  }
+
+  const int64_t controllerAtUs = root["at"].as<int64_t>();
+  const int64_t localAtUs = controllerAtUs - estimate.offsetUs;
+  if (localAtUs < 0) {
+    return "invalid_time";
+  }
+  if (static_cast<uint64_t>(localAtUs) > now + static_cast<uint64_t>(TRIGGER_AT_MAX_LEAD_MS) * 1000ULL) {
+    return "out_of_range";
+  }
+
+  lockScheduled();
+  scheduledTriggers[index].clientId = client->id();
+  scheduledTriggers[index].controllerAtUs = controllerAtUs;
+  scheduledTriggers[index].uncertaintyUs = estimate.uncertaintyUs;
+  unlockScheduled();
+
+  triggerCueAt(index, static_cast<uint64_t>(localAtUs), root["duration"] | 0U);
+  return nullptr;
+}
+
+// Appelé depuis loop() lorsque la LED s'est allumée : l'écart est mesuré sur l'horloge locale,
+// l'incertitude de synchronisation s'y ajoute côté contrôleur.
+void reportScheduledTrigger(size_t index, uint64_t targetUs, uint64_t firedAtUs) {
+  lockScheduled();
+  const ScheduledTrigger trigger = scheduledTriggers[index];
+  scheduledTriggers[index] = ScheduledTrigger();
+  unlockScheduled();
+
+  const int64_t skewUs = static_cast<int64_t>(firedAtUs - targetUs);
+  Serial.printf("[Cue] ⏱️ Cue %u déclenché à l'instant programmé (écart %ld µs)\n", static_cast<unsigned>(index),
+                static_cast<long>(skewUs));
+
+  AsyncWebSocketClient *client = trigger.clientId != 0 ? ws.client(trigger.clientId) : nullptr;
+  if (client == nullptr || client->status() != WS_CONNECTED) {
+    return;
+  }
+
+  StaticJsonDocument<JSON_OBJECT_SIZE(5)> doc;
+  doc["type"] = "triggerAtResult";
+  doc["cue"] = static_cast<uint8_t>(index);
+  doc["at"] = trigger.controllerAtUs;
+  doc["skewUs"] = skewUs;
+  doc["uncertaintyUs"] = trigger.uncertaintyUs;
+  String payload;
+  serializeJson(doc, payload);
+  client->text(payload);
+}
+
+void broadcastScanComplete(uint32_t token, size_t count) {
+  if (countWebSocketClients(WsProtocol::Json) == 0) {
+    return;
+  }
+
+  StaticJsonDocument<JSON_OBJECT_SIZE(3)> doc;
+  doc["type"] = "scan";
+  doc["token"] = token;
+  doc["count"] = count;
+
+  const size_t length = measureJson(doc);
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer(length);
+  if (buffer == nullptr) {
+    return;
+  }
+  serializeJson(doc, reinterpret_cast<char *>(buffer->get()), length + 1);
+  sendToWebSocketClients(WsProtocol::Json, buffer);
+}
+
 }  // namespace
 
 // 🎯 WebSocket: gestion des événements
@@ -247,55 +1053,110 @@ void onWebSocketEvent(AsyncWebSocket *serverPtr, AsyncWebSocketClient *client,
         client->close(1008);
         return;
       }
-      Serial.printf("[WS] 🔌 Client #%u connecté\n", client->id());
-      client->text(buildCueSnapshotJson());
+      const WsProtocol protocol = negotiateWebSocketProtocol(client);
+      if (!registerWsClient(client->id(), protocol)) {
+        Serial.printf("[WS] ⚠️ Rejet de la connexion #%u (trop de clients)\n", client->id());
+        client->close(1013);
+        return;
+      }
+      Serial.printf("[WS] 🔌 Client #%u connecté (%s)\n", client->id(),
+                    protocol == WsProtocol::Binary ? "binaire" : "JSON");
+      const SyncPoint sync = webSocketSyncPoint(client);
+      if (protocol == WsProtocol::Binary) {
+        // Jusqu'à ~4 Ko pour 64 cues : alloué sur le tas plutôt que sur la pile AsyncTCP.
+        std::unique_ptr<uint8_t[]> frame(new (std::nothrow) uint8_t[CUE_SNAPSHOT_FRAME_CAPACITY]);
+        if (!frame) {
+          client->close(1011);
+          return;
+        }
+        const size_t length =
+            sync.present ? buildCueDeltaFrame(sync.epoch, sync.version, frame.get(), CUE_SNAPSHOT_FRAME_CAPACITY)
+                         : buildCueSnapshotFrame(frame.get(), CUE_SNAPSHOT_FRAME_CAPACITY);
+        client->binary(frame.get(), length);
+      } else {
+        client->text(sync.present ? buildCueDeltaJson(sync.epoch, sync.version) : buildCueSnapshotJson());
+      }
       break;
     }
     case WS_EVT_DISCONNECT:
+      unregisterWsClient(client->id());
       Serial.printf("[WS] ❌ Client #%u déconnecté\n", client->id());
       break;
     case WS_EVT_DATA: {
+      const uint32_t receivedAtUs = latencyTimestampUs();
+      const uint64_t receivedAtClockUs = cueClockUs();
       AwsFrameInfo *info = reinterpret_cast<AwsFrameInfo *>(arg);
-      if (!(info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT)) {
+      if (!(info->final && info->index == 0 && info->len == len)) {
+        return;
+      }
+      if (info->opcode == WS_BINARY) {
+        handleBinaryFrame(client, data, len, receivedAtUs);
+        return;
+      }
+      if (info->opcode != WS_TEXT) {
         return;
       }
 
-      String message(reinterpret_cast<const char *>(data), len);
-      StaticJsonDocument<384> doc;
-      DeserializationError err = deserializeJson(doc, message);
+      CommandJsonDocument &doc = commandDocument;
+      DeserializationError err = deserializeJson(doc, reinterpret_cast<char *>(data), len);
       if (err) {
-        Serial.printf("[WS] ❗ JSON invalide reçu: %s\n", message.c_str());
-        StaticJsonDocument<64> errorDoc;
-        errorDoc["type"] = "error";
-        errorDoc["message"] = "invalid_json";
-        String response;
-        serializeJson(errorDoc, response);
-        client->text(response);
+        Serial.printf("[WS] ❗ JSON invalide reçu (%u octets): %s\n", static_cast<unsigned>(len), err.c_str());
+        sendWsError(client, "invalid_json");
         return;
       }
 
       const String action = doc["type"] | String("trigger");
+      if (action == "batch") {
+        size_t applied = 0;
+        const char *error = runCueBatch(doc.as<JsonVariantConst>(), TriggerSource::WebSocket, receivedAtUs, applied);
+        if (error != nullptr) {
+          sendWsError(client, error);
+        }
+        return;
+      }
+      if (action == "listStatus") {
+        client->text(buildCueListStatusJson());
+        return;
+      }
+      if (action.startsWith("list")) {
+        const char *error = runCueListCommand(action, doc["step"]);
+        if (error != nullptr) {
+          sendWsError(client, error);
+        }
+        return;
+      }
+      if (action == "clockSync") {
+        sendClockProbe(client);
+        return;
+      }
+      if (action == "clockEcho") {
+        handleClockEcho(client, doc.as<JsonVariantConst>(), receivedAtClockUs);
+        return;
+      }
+
       const int cueIndex = doc.containsKey("cue") ? doc["cue"].as<int>() : doc["index"].as<int>();
       if (cueIndex < 0 || static_cast<size_t>(cueIndex) >= CUE_COUNT) {
-        StaticJsonDocument<96> errorDoc;
-        errorDoc["type"] = "error";
-        errorDoc["message"] = "invalid_cue";
-        String response;
-        serializeJson(errorDoc, response);
-        client->text(response);
+        sendWsError(client, "invalid_cue");
         return;
       }
 
       const bool persist = doc["persist"] | true;
 
       if (doc.containsKey("text")) {
-        setCueText(static_cast<size_t>(cueIndex), String(doc["text"].as<const char *>()), persist);
+        const char *text = doc["text"] | "";
+        setCueText(static_cast<size_t>(cueIndex), text, strlen(text), persist);
       }
 
       if (action == "setText") {
         client->text(buildCueStateJson(static_cast<size_t>(cueIndex)));
       } else if (action == "trigger") {
-        triggerCue(static_cast<size_t>(cueIndex));
+        beginTriggerTrace(static_cast<size_t>(cueIndex), TriggerSource::WebSocket, receivedAtUs);
+        triggerCue(static_cast<size_t>(cueIndex), doc["duration"] | 0U);
+      } else if (action == "triggerAt") {
+        const char *error = scheduleTriggerAt(client, doc.as<JsonVariantConst>(), static_cast<size_t>(cueIndex));
+        if (error != nullptr) {
+          sendWsError(client, error);
+        }
       } else if (action == "ping") {
         StaticJsonDocument<64> pongDoc;
         pongDoc["type"] = "pong";
@@ -312,13 +1173,74 @@ void onWebSocketEvent(AsyncWebSocket *serverPtr, AsyncWebSocketClient *client,
   }
 }
 
-void startWebServer() {
-  if (!mountFileSystem()) {
-    Serial.println("[Web] ⚠️ Lancement du serveur sans fichiers statiques");
+size_t countWebSocketClients(WsProtocol protocol) {
+  size_t count = 0;
+  lockWsClients();
+  for (const auto &slot : wsClients) {
+    if (slot.id != 0 && slot.protocol == protocol) {
+      ++count;
+    }
   }
+  unlockWsClients();
+  return count;
+}
+
+void sendToWebSocketClients(WsProtocol protocol, AsyncWebSocketMessageBuffer *buffer) {
+  deliverToWebSocketClients(protocol, buffer, 0);
+}
+
+void sendCueStateToWebSocketClients(WsProtocol protocol, AsyncWebSocketMessageBuffer *buffer, uint32_t version) {
+  deliverToWebSocketClients(protocol, buffer, version);
+}
+
+void serviceWebSocketClients() {
+  const uint32_t nowMs = millis();
+  for (size_t i = 0; i < WS_MAX_CLIENTS; ++i) {
+    const WsClientRef ref = wsClientRef(i);
+    if (ref.id == 0) {
+      continue;
+    }
+    WsQueueState &queue = wsQueueFor(i, ref.generation);
+    if (queue.closing) {
+      continue;
+    }
+    AsyncWebSocketClient *client = ws.client(ref.id);
+    if (client == nullptr || client->status() != WS_CONNECTED) {
+      continue;
+    }
+    const size_t depth = observeQueue(queue, client);
+    const WsPressure pressure = assessPressure(queue, depth, nowMs);
+    if (queue.stale && pressure == WsPressure::Healthy) {
+      sendResync(ref.protocol, queue, client);
+    } else if (pressure == WsPressure::OverBudget && nowMs - queue.overBudgetSinceMs >= WS_CLIENT_STALL_TIMEOUT_MS) {
+      Serial.printf("[WS] 🐢 Client #%lu déconnecté (file saturée : %u messages, %lu octets)\n",
+                    static_cast<unsigned long>(ref.id), static_cast<unsigned>(depth),
+                    static_cast<unsigned long>(queue.queuedBytes.load(std::memory_order_relaxed)));
+      queue.closing = true;
+      client->close(1013);
+      wsStalledDisconnects.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  if (nowMs - lastClientCleanupMs >= WS_CLIENT_CLEANUP_INTERVAL_MS) {
+    ws.cleanupClients();
+    lastClientCleanupMs = nowMs;
+  }
+}
+
+void startWebServer() {
+  mountFileSystem();
 
   DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
 
+  if (fsMounted && activeFs != nullptr) {
+    loadAssetManifest();
+    registerCompressedAssets();
+  }
+
+  // Routes exactes enregistrées avant serveStatic : elles sont prioritaires sur ce dernier.
+  embeddedUiAvailable = registerEmbeddedAssets() > 0;
+
   if (fsMounted && activeFs != nullptr) {
     auto &rootHandler = server.serveStatic("/", *activeFs, "/");
     rootHandler.setDefaultFile("index.html");
@@ -326,7 +1248,7 @@ void startWebServer() {
 
     auto &wifiHandler = server.serveStatic("/wifi", *activeFs, "/wifi.html");
     wifiHandler.setCacheControl("max-age=60");
-  } else {
+  } else if (!embeddedUiAvailable) {
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
       request->send(503, "text/plain", "Interface non disponible : téléversez les fichiers SPIFFS/LittleFS");
     });
@@ -343,7 +1265,9 @@ void startWebServer() {
     if (!requireAuth(request)) {
       return;
     }
-    request->send(200, "application/json", buildCueSnapshotJson());
+    const SyncPoint sync = requestSyncPoint(request);
+    request->send(200, "application/json",
+                  sync.present ? buildCueDeltaJson(sync.epoch, sync.version) : buildCueSnapshotJson());
   });
 
   server.on("/api/cues/trigger", HTTP_POST, [](AsyncWebServerRequest *request) {
@@ -353,6 +1277,38 @@ void startWebServer() {
     handleTriggerRequest(request);
   });
 
+  server.on(
+      "/api/cues/batch", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        if (!requireAuth(request)) {
+          return;
+        }
+        handleBatchRequest(request);
+      },
+      nullptr, collectRequestBody<CUE_BATCH_MAX_BODY_SIZE>);
+
+  server.on("/api/cuelist", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!requireAuth(request)) {
+      return;
+    }
+    request->send(200, "application/json", buildCueListStatusJson());
+  });
+
+  server.on(
+      "/api/cuelist", HTTP_POST,
+      [](AsyncWebServerRequest *request) {
+        if (!requireAuth(request)) {
+          return;
+        }
+        handleCueListUpload(request);
+      },
+      nullptr, collectRequestBody<CUE_LIST_MAX_BODY_SIZE>);
+
+  registerCueListCommand("/api/cuelist/go", "listGo");
+  registerCueListCommand("/api/cuelist/back", "listBack");
+  registerCueListCommand("/api/cuelist/jump", "listJump");
+  registerCueListCommand("/api/cuelist/stop", "listStop");
+
   server.on("/api/cues/text", HTTP_POST, [](AsyncWebServerRequest *request) {
     if (!requireAuth(request)) {
       return;
@@ -375,30 +1331,33 @@ void startWebServer() {
     if (!requireAuth(request)) {
       return;
     }
-    StaticJsonDocument<256> doc;
+    StaticJsonDocument<384> doc;
     doc["device"] = DEVICE_NAME;
     doc["wifiStatus"] = wifiStatusToString(WiFi.status());
     doc["ip"] = WiFi.status() == WL_CONNECTED ? WiFi.localIP().toString() : String();
     doc["ssid"] = WiFi.SSID();
     doc["portalActive"] = isPortalActive();
     doc["uptimeMs"] = millis();
+    doc["wifiConnectMs"] = wifiConnectedAtMs();
+    // Fragmentation : plus grand bloc allouable comparé à la mémoire libre (tools/soak_test.py).
+    doc["heapFree"] = ESP.getFreeHeap();
+    doc["heapMinFree"] = ESP.getMinFreeHeap();
+    doc["heapLargestBlock"] = ESP.getMaxAllocHeap();
     sendJson(request, 200, doc);
   });
 
+  server.on("/api/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!requireAuth(request)) {
+      return;
+    }
+    request->send(200, "text/plain; version=0.0.4", buildLatencyMetrics() + buildWebSocketMetrics());
+  });
+
   server.on("/scan", HTTP_GET, [](AsyncWebServerRequest *request) {
     if (!isPortalActive() && !requireAuth(request)) {
       return;
     }
-    int n = WiFi.scanNetworks();
-    StaticJsonDocument<512> doc;
-    JsonArray array = doc.to<JsonArray>();
-    for (int i = 0; i < n; ++i) {
-      JsonObject network = array.createNestedObject();
-      network["ssid"] = WiFi.SSID(i);
-      network["rssi"] = WiFi.RSSI(i);
-      network["secure"] = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
-    }
-    sendJson(request, 200, doc);
+    handleScanRequest(request);
   });
 
   server.on("/save_wifi", HTTP_POST, [](AsyncWebServerRequest *request) {
@@ -425,17 +1384,23 @@ void startWebServer() {
     }
 
     request->send(200, "text/plain", "Identifiants sauvegardés. Redémarrage...");
-    request->onDisconnect([]() { ESP.restart(); });
+    request->onDisconnect([]() {
+      flushCuePersistence();
+      ESP.restart();
+    });
   });
 
   server.onNotFound([](AsyncWebServerRequest *request) {
-    if (fsMounted) {
+    if (fsMounted || embeddedUiAvailable) {
       request->send(404, "application/json", "{\"error\":\"not_found\"}");
     } else {
       request->send(503, "application/json", "{\"error\":\"filesystem_unavailable\"}");
     }
   });
 
+  setWiFiScanCompleteHandler(broadcastScanComplete);
+  setCueScheduledStartHandler(reportScheduledTrigger);
+
   ws.onEvent(onWebSocketEvent);
   ws.enable(true);
   server.addHandler(&ws);
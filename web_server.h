@@ -1,5 +1,18 @@
 #pragma once
 
 #include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// Protocole négocié par chaque client WebSocket (/ws?proto=bin pour le binaire).
+enum class WsProtocol : uint8_t { Json, Binary };
 
 void startWebServer();
+size_t countWebSocketClients(WsProtocol protocol);
+// Remet un tampon partagé à tous les clients connectés utilisant `protocol` ; écarté pour les
+// clients dont la file dépasse le budget dur (WS_CLIENT_HARD_QUEUE_*).
+void sendToWebSocketClients(WsProtocol protocol, AsyncWebSocketMessageBuffer *buffer);
+// Trame d'état de la version `version` du journal : un client en retard ne la reçoit pas, il
+// recevra à la place un seul delta depuis sa dernière version dès que sa file se sera vidée.
+void sendCueStateToWebSocketClients(WsProtocol protocol, AsyncWebSocketMessageBuffer *buffer, uint32_t version);
+// Surveillance des files par client, resynchronisations en attente et nettoyage (depuis loop()).
+void serviceWebSocketClients();
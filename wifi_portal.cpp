@@ -8,6 +8,7 @@
 #endif
 
 #include "config.h"
+#include "wifi_scan.h"
 
 namespace {
 
@@ -20,7 +21,35 @@ DNSServer dnsServer;
 constexpr const char *kPrefsNamespace = "wifi_cfg";
 constexpr const char *kSsidKey = "ssid";
 constexpr const char *kPassKey = "pass";
+constexpr const char *kBssidKey = "bssid";
+constexpr const char *kChannelKey = "channel";
 constexpr uint8_t kDnsPort = 53;
+constexpr size_t kBssidLength = 6;
+
+// Connexion pilotée depuis loop() : aucune attente bloquante, les cues restent réactifs pendant
+// l'association. Une première tentative rapide vise le point d'accès et le canal mémorisés
+// (pas de balayage), puis WIFI_MAX_RETRIES tentatives classiques avant le portail captif.
+enum class WiFiPhase : uint8_t {
+  Idle,
+  Connecting,
+  RetryWait,
+  Connected,
+  Portal,
+};
+
+struct ConnectionState {
+  WiFiPhase phase = WiFiPhase::Idle;
+  String ssid;
+  String password;
+  bool fastAttempt = false;  // Tentative en cours avec BSSID/canal mémorisés.
+  uint8_t attempt = 0;       // Tentatives classiques déjà lancées.
+  uint32_t phaseStartMs = 0;
+  uint32_t connectedAtMs = 0;  // millis() à la première connexion (0 = jamais).
+  uint8_t cachedBssid[kBssidLength] = {0};
+  uint8_t cachedChannel = 0;  // 0 = aucun point d'accès mémorisé.
+};
+
+ConnectionState connection;
 
 bool ensurePrefs() {
   if (!prefsReady) {
@@ -55,41 +84,116 @@ void applyWiFiPowerSettings() {
   }
 }
 
-bool connectToNetwork(const String &ssid, const String &password) {
-  if (ssid.isEmpty()) {
+void enterPhase(WiFiPhase phase) {
+  connection.phase = phase;
+  connection.phaseStartMs = millis();
+}
+
+bool loadCachedAccessPoint() {
+  connection.cachedChannel = 0;
+  if (wifiPrefs.getBytes(kBssidKey, connection.cachedBssid, kBssidLength) != kBssidLength) {
     return false;
   }
+  connection.cachedChannel = wifiPrefs.getUChar(kChannelKey, 0);
+  return connection.cachedChannel != 0;
+}
 
-  WiFi.mode(WIFI_STA);
-  WiFi.persistent(false);
-  WiFi.setHostname(DEVICE_NAME);
-  applyWiFiPowerSettings();
+// Mémorise le point d'accès obtenu ; n'écrit en NVS que s'il a changé.
+void rememberAccessPoint() {
+  const uint8_t *bssid = WiFi.BSSID();
+  const int32_t channel = WiFi.channel();
+  if (bssid == nullptr || channel <= 0 || channel > UINT8_MAX) {
+    return;
+  }
+  if (connection.cachedChannel == channel && memcmp(connection.cachedBssid, bssid, kBssidLength) == 0) {
+    return;
+  }
 
-  Serial.printf("[WiFi] 🔌 Connexion au réseau '%s'\n", ssid.c_str());
+  memcpy(connection.cachedBssid, bssid, kBssidLength);
+  connection.cachedChannel = static_cast<uint8_t>(channel);
+  wifiPrefs.putBytes(kBssidKey, connection.cachedBssid, kBssidLength);
+  wifiPrefs.putUChar(kChannelKey, connection.cachedChannel);
+}
 
-  for (uint8_t attempt = 0; attempt < WIFI_MAX_RETRIES; ++attempt) {
-    WiFi.disconnect(true, true);
-    delay(50);
-    WiFi.begin(ssid.c_str(), password.isEmpty() ? nullptr : password.c_str());
+void forgetAccessPoint() {
+  connection.cachedChannel = 0;
+  wifiPrefs.remove(kBssidKey);
+  wifiPrefs.remove(kChannelKey);
+}
 
-    const uint32_t start = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_CONNECT_TIMEOUT_MS) {
-      delay(250);
-    }
+void beginAttempt(bool fast) {
+  const char *password = connection.password.isEmpty() ? nullptr : connection.password.c_str();
+  connection.fastAttempt = fast;
+  WiFi.disconnect(false, true);
+  if (fast) {
+    WiFi.begin(connection.ssid.c_str(), password, connection.cachedChannel, connection.cachedBssid);
+  } else {
+    ++connection.attempt;
+    WiFi.begin(connection.ssid.c_str(), password);
+  }
+  enterPhase(WiFiPhase::Connecting);
+}
 
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.printf("[WiFi] ✅ Connecté à '%s' (%s)\n", ssid.c_str(), WiFi.localIP().toString().c_str());
-      stopPortal();
-      return true;
-    }
+void startPortalMode();
+
+void onAttemptFailed() {
+  if (connection.fastAttempt) {
+    Serial.println("[WiFi] ⚠️ Point d'accès mémorisé injoignable, recherche complète");
+    forgetAccessPoint();
+  } else {
+    Serial.printf("[WiFi] ⚠️ Tentative %u échouée\n", static_cast<unsigned>(connection.attempt));
+  }
 
-    Serial.printf("[WiFi] ⚠️ Tentative %u échouée\n", static_cast<unsigned>(attempt + 1));
-    WiFi.disconnect(true);
-    delay(200);
+  if (!connection.fastAttempt && connection.attempt >= WIFI_MAX_RETRIES) {
+    Serial.println("[WiFi] ❌ Impossible de se connecter au réseau enregistré");
+    startPortalMode();
+    return;
   }
 
-  Serial.println("[WiFi] ❌ Impossible de se connecter au réseau enregistré");
-  return false;
+  WiFi.disconnect(false, true);
+  enterPhase(WiFiPhase::RetryWait);
+}
+
+void onConnected() {
+  if (connection.connectedAtMs == 0) {
+    connection.connectedAtMs = millis();
+  }
+  Serial.printf("[WiFi] ✅ Connecté à '%s' (%s) en %lu ms depuis le démarrage%s\n", connection.ssid.c_str(),
+                WiFi.localIP().toString().c_str(), static_cast<unsigned long>(connection.connectedAtMs),
+                connection.fastAttempt ? " (reconnexion rapide)" : "");
+  rememberAccessPoint();
+  stopPortal();
+  enterPhase(WiFiPhase::Connected);
+}
+
+void advanceConnection() {
+  const uint32_t elapsed = millis() - connection.phaseStartMs;
+  switch (connection.phase) {
+    case WiFiPhase::Connecting: {
+      const wl_status_t status = WiFi.status();
+      if (status == WL_CONNECTED) {
+        onConnected();
+        return;
+      }
+      // La tentative rapide abandonne dès que le point d'accès visé est absent.
+      const bool rejected = connection.fastAttempt && (status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED);
+      const uint32_t timeout = connection.fastAttempt ? WIFI_FAST_CONNECT_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS;
+      if (rejected || elapsed >= timeout) {
+        onAttemptFailed();
+      }
+      break;
+    }
+    case WiFiPhase::RetryWait:
+      if (elapsed >= WIFI_RETRY_DELAY_MS) {
+        beginAttempt(false);
+      }
+      break;
+    case WiFiPhase::Idle:
+    case WiFiPhase::Connected:
+    case WiFiPhase::Portal:
+    default:
+      break;
+  }
 }
 
 void startPortalMode() {
@@ -114,6 +218,7 @@ void startPortalMode() {
   dnsServer.start(kDnsPort, "*", portalIp);
   portalModeActive = true;
 
+  enterPhase(WiFiPhase::Portal);
   Serial.println("[WiFi] 📶 Portail captif actif");
   Serial.printf("[WiFi]    SSID : %s\n", FALLBACK_AP_SSID);
   Serial.printf("[WiFi]    IP   : %s\n", portalIp.toString().c_str());
@@ -121,20 +226,20 @@ void startPortalMode() {
 
 }  // namespace
 
-bool startWiFiWithPortal() {
-  String ssid;
-  String password;
-  bool connected = false;
-
-  if (ensurePrefs() && loadWiFiCredentials(ssid, password) && !ssid.isEmpty()) {
-    connected = connectToNetwork(ssid, password);
-  }
-
-  if (!connected) {
+void startWiFiWithPortal() {
+  if (!ensurePrefs() || !loadWiFiCredentials(connection.ssid, connection.password)) {
     startPortalMode();
+    return;
   }
 
-  return connected;
+  WiFi.mode(WIFI_STA);
+  WiFi.persistent(false);
+  WiFi.setHostname(DEVICE_NAME);
+  applyWiFiPowerSettings();
+
+  Serial.printf("[WiFi] 🔌 Connexion au réseau '%s'\n", connection.ssid.c_str());
+  connection.attempt = 0;
+  beginAttempt(loadCachedAccessPoint());
 }
 
 bool saveWiFiCredentials(const String &ssid, const String &password) {
@@ -144,6 +249,7 @@ bool saveWiFiCredentials(const String &ssid, const String &password) {
 
   bool ok = wifiPrefs.putString(kSsidKey, ssid) && wifiPrefs.putString(kPassKey, password);
   if (ok) {
+    forgetAccessPoint();
     Serial.printf("[WiFi] 💾 Identifiants enregistrés pour '%s'\n", ssid.c_str());
   }
   return ok;
@@ -165,6 +271,7 @@ void forgetWiFiCredentials() {
   }
   wifiPrefs.remove(kSsidKey);
   wifiPrefs.remove(kPassKey);
+  forgetAccessPoint();
   Serial.println("[WiFi] 🧹 Identifiants oubliés");
 }
 
@@ -172,7 +279,13 @@ bool isPortalActive() {
   return portalModeActive;
 }
 
-void handleWiFiPortal() {
+uint32_t wifiConnectedAtMs() {
+  return connection.connectedAtMs;
+}
+
+void updateWiFi() {
+  advanceConnection();
+  serviceWiFiScan();
   if (portalModeActive) {
     dnsServer.processNextRequest();
   }
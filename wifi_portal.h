@@ -2,10 +2,13 @@
 
 #include <Arduino.h>
 
-bool startWiFiWithPortal();
+// Lance la connexion sans bloquer ; updateWiFi() la fait progresser depuis loop().
+void startWiFiWithPortal();
 bool saveWiFiCredentials(const String &ssid, const String &password);
 bool loadWiFiCredentials(String &ssid, String &password);
 void forgetWiFiCredentials();
 bool isPortalActive();
-void handleWiFiPortal();
+// Instant (millis()) de la première connexion depuis le démarrage, 0 tant qu'elle n'a pas eu lieu.
+uint32_t wifiConnectedAtMs();
+void updateWiFi();
 
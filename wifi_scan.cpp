@@ -0,0 +1,144 @@
+#include "wifi_scan.h"
+
+#include <WiFi.h>
+
+#include <new>
+
+#include "config.h"
+
+#if defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#endif
+
+namespace {
+
+// Seul loop() appelle l'API de balayage du pilote ; les requêtes HTTP ne font qu'incrémenter
+// requestedToken et lire le dernier résultat publié.
+std::shared_ptr<const WiFiScanResults> latestResults;
+uint32_t requestedToken = 0;
+uint32_t completedToken = 0;
+uint32_t runningToken = 0;  // 0 = aucun balayage en cours.
+WiFiScanCompleteHandler completeHandler = nullptr;
+
+#if defined(ESP_PLATFORM)
+portMUX_TYPE scanLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+void lockScan() {
+#if defined(ESP_PLATFORM)
+  portENTER_CRITICAL(&scanLock);
+#endif
+}
+
+void unlockScan() {
+#if defined(ESP_PLATFORM)
+  portEXIT_CRITICAL(&scanLock);
+#endif
+}
+
+std::shared_ptr<const WiFiScanResults> collectResults(uint32_t token, int16_t count) {
+  std::shared_ptr<WiFiScanResults> results(new (std::nothrow) WiFiScanResults());
+  if (!results) {
+    return nullptr;
+  }
+  results->token = token;
+  results->completedAtMs = millis();
+
+  if (count > 0) {
+    results->networks.reserve(static_cast<size_t>(count));
+    for (int16_t i = 0; i < count; ++i) {
+      WiFiScanNetwork network = {};
+      strlcpy(network.ssid, WiFi.SSID(i).c_str(), sizeof(network.ssid));
+      network.rssi = static_cast<int8_t>(WiFi.RSSI(i));
+      network.secure = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
+      results->networks.push_back(network);
+    }
+  }
+  return results;
+}
+
+void publishResults(uint32_t token, int16_t count) {
+  std::shared_ptr<const WiFiScanResults> results = collectResults(token, count);
+  WiFi.scanDelete();
+  if (!results) {
+    Serial.println("[WiFi] ⚠️ Mémoire insuffisante pour conserver le résultat du balayage");
+  }
+
+  lockScan();
+  if (results) {
+    latestResults.swap(results);
+  }
+  completedToken = token;
+  runningToken = 0;
+  unlockScan();
+
+  // L'ancien résultat (désormais dans `results`) est libéré ici, hors section critique.
+  const size_t found = count > 0 ? static_cast<size_t>(count) : 0;
+  Serial.printf("[WiFi] 🔍 Balayage #%lu terminé : %u réseau(x)\n", static_cast<unsigned long>(token),
+                static_cast<unsigned>(found));
+  if (completeHandler != nullptr) {
+    completeHandler(token, found);
+  }
+}
+
+}  // namespace
+
+void setWiFiScanCompleteHandler(WiFiScanCompleteHandler handler) {
+  completeHandler = handler;
+}
+
+uint32_t requestWiFiScan() {
+  lockScan();
+  if (requestedToken == completedToken) {
+    ++requestedToken;
+  }
+  const uint32_t token = requestedToken;
+  unlockScan();
+  return token;
+}
+
+std::shared_ptr<const WiFiScanResults> latestWiFiScan(uint32_t minToken) {
+  lockScan();
+  std::shared_ptr<const WiFiScanResults> results = latestResults;
+  unlockScan();
+
+  if (!results) {
+    return nullptr;
+  }
+  if (minToken != 0) {
+    return results->token >= minToken ? results : nullptr;
+  }
+  return millis() - results->completedAtMs < WIFI_SCAN_CACHE_TTL_MS ? results : nullptr;
+}
+
+void serviceWiFiScan() {
+  lockScan();
+  const uint32_t running = runningToken;
+  const uint32_t pending = requestedToken != completedToken ? requestedToken : 0;
+  unlockScan();
+
+  if (running != 0) {
+    const int16_t status = WiFi.scanComplete();
+    if (status == WIFI_SCAN_RUNNING) {
+      return;
+    }
+    if (status == WIFI_SCAN_FAILED) {
+      Serial.println("[WiFi] ⚠️ Échec du balayage des réseaux");
+    }
+    publishResults(running, status);
+    return;
+  }
+
+  if (pending == 0) {
+    return;
+  }
+
+  if (WiFi.scanNetworks(true) == WIFI_SCAN_FAILED) {
+    Serial.println("[WiFi] ⚠️ Impossible de lancer le balayage des réseaux");
+    publishResults(pending, WIFI_SCAN_FAILED);
+    return;
+  }
+  lockScan();
+  runningToken = pending;
+  unlockScan();
+}
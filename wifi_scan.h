@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+#include <vector>
+
+struct WiFiScanNetwork {
+  char ssid[33];
+  int8_t rssi;
+  bool secure;
+};
+
+// Résultat immuable d'un balayage, partagé entre loop() et les requêtes HTTP en cours.
+struct WiFiScanResults {
+  uint32_t token = 0;  // Jeton de la demande qui a produit ces résultats.
+  uint32_t completedAtMs = 0;
+  std::vector<WiFiScanNetwork> networks;
+};
+
+using WiFiScanCompleteHandler = void (*)(uint32_t token, size_t count);
+
+void setWiFiScanCompleteHandler(WiFiScanCompleteHandler handler);
+// Programme un balayage asynchrone (ou rejoint celui déjà prévu) et retourne son jeton.
+uint32_t requestWiFiScan();
+// Résultats produits par le jeton `minToken` ou un plus récent ; sans jeton (0), seuls des
+// résultats de moins de WIFI_SCAN_CACHE_TTL_MS sont rendus. nullptr si aucun ne convient.
+std::shared_ptr<const WiFiScanResults> latestWiFiScan(uint32_t minToken);
+// Lance les balayages demandés et récupère leurs résultats (appelé depuis loop()).
+void serviceWiFiScan();